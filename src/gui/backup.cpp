@@ -87,7 +87,7 @@ std::filesystem::path compressDirectory(const std::filesystem::path& dir) {
 void createBackup(const std::filesystem::path& sourceDir,
                   const std::filesystem::path& destDir) {
   auto logger = getLogger();
-  if (logger) {
+  if (isTraceLoggingEnabled(logger)) {
     logger->trace("Creating backup of {} in {}",
                   sourceDir.u8string(),
                   destDir.u8string());
@@ -0,0 +1,251 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/message_strings.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+
+#include <boost/locale.hpp>
+
+namespace loot {
+namespace {
+using boost::locale::translate;
+
+// Tables are never destroyed so that references to them stay valid after the
+// language changes, but that happens at most a couple of times per run.
+std::mutex messageStringsMutex;
+std::vector<std::unique_ptr<const MessageStrings>> loadedMessageStrings;
+std::atomic<const MessageStrings*> currentMessageStrings{nullptr};
+
+const MessageStrings& loadMessageStrings(bool reload) {
+  std::lock_guard<std::mutex> guard(messageStringsMutex);
+
+  // Another thread may have loaded the strings while this one was waiting.
+  const auto current = currentMessageStrings.load(std::memory_order_acquire);
+  if (!reload && current != nullptr) {
+    return *current;
+  }
+
+  loadedMessageStrings.push_back(std::make_unique<const MessageStrings>());
+  const auto strings = loadedMessageStrings.back().get();
+  currentMessageStrings.store(strings, std::memory_order_release);
+
+  return *strings;
+}
+
+bool isDigits(std::string_view text) {
+  if (text.empty()) {
+    return false;
+  }
+
+  for (const auto character : text) {
+    if (character < '0' || character > '9') {
+      return false;
+    }
+  }
+
+  return true;
+}
+}
+
+MessageFormat::MessageFormat(std::string formatString) :
+    formatString(std::move(formatString)) {
+  isParsed = parse();
+}
+
+const std::string& MessageFormat::str() const { return formatString; }
+
+bool MessageFormat::parse() {
+  std::string literal;
+  for (size_t i = 0; i < formatString.size(); i += 1) {
+    const auto character = formatString[i];
+    if (character != '{' && character != '}') {
+      literal += character;
+      continue;
+    }
+
+    if (i + 1 < formatString.size() && formatString[i + 1] == character) {
+      // An escaped brace.
+      literal += character;
+      i += 1;
+      continue;
+    }
+
+    if (character == '}') {
+      return false;
+    }
+
+    const auto end = formatString.find('}', i + 1);
+    if (end == std::string::npos) {
+      return false;
+    }
+
+    const auto indexText =
+        std::string_view(formatString).substr(i + 1, end - i - 1);
+    if (!isDigits(indexText)) {
+      return false;
+    }
+
+    literalLength += literal.size();
+    segments.push_back(Segment{std::move(literal),
+                               std::stoul(std::string(indexText))});
+    literal.clear();
+    i = end;
+  }
+
+  literalLength += literal.size();
+  segments.push_back(Segment{std::move(literal), std::nullopt});
+
+  return true;
+}
+
+std::string MessageFormat::format(const std::string* arguments,
+                                  size_t count) const {
+  size_t length = literalLength;
+  for (const auto& segment : segments) {
+    if (segment.argumentIndex.has_value()) {
+      if (segment.argumentIndex.value() >= count) {
+        throw std::invalid_argument(
+            "The format string \"" + formatString +
+            "\" references an argument that was not given");
+      }
+
+      length += arguments[segment.argumentIndex.value()].size();
+    }
+  }
+
+  std::string result;
+  result.reserve(length);
+  for (const auto& segment : segments) {
+    result += segment.text;
+    if (segment.argumentIndex.has_value()) {
+      result += arguments[segment.argumentIndex.value()];
+    }
+  }
+
+  return result;
+}
+
+MessageStrings::MessageStrings() :
+    missingMaster(translate("This plugin requires \"{0}\" to be "
+                            "installed, but it is missing.")
+                      .str()),
+    inactiveMaster(translate("This plugin requires \"{0}\" to be "
+                             "active, but it is inactive.")
+                       .str()),
+    incompatibility(translate("This plugin is incompatible with \"{0}\", but "
+                              "both are present.")
+                        .str()),
+    lightPluginRequiresNonMaster(
+        translate("This plugin is a light master and requires the non-master "
+                  "plugin \"{0}\". This can cause issues in-game, and sorting "
+                  "will fail while this plugin is installed.")
+            .str()),
+    invalidLightPlugin(
+        translate("This plugin contains records that have FormIDs outside "
+                  "the valid range for an ESL plugin. Using this plugin "
+                  "will cause irreversible damage to your game saves.")
+            .str()),
+    invalidOverridePlugin(
+        translate("This plugin is an overlay plugin but adds new records. "
+                  "Using this plugin may cause irreversible damage to your "
+                  "game saves.")
+            .str()),
+    invalidHeaderVersion(translate(
+                             /* translators: A header is the part of a file
+                                that stores data like file name and version. */
+                             "This plugin has a header version of {0}, which "
+                             "is less than the game's minimum supported "
+                             "header version of {1}.")
+                             .str()),
+    missingGroup(translate("This plugin belongs to the group "
+                           "\"{0}\", which does not exist.")
+                     .str()),
+    bashTagsOverride(
+        translate("This plugin has a BashTags file that will override the "
+                  "suggestions made by LOOT for the following Bash Tags: {0}.")
+            .str()),
+    conditionEvaluationError(translate("\"{0}\" contains a condition that "
+                                       "could not be evaluated. Details: {1}")
+                                 .str()),
+    location(translate("Location").str()),
+    numberedLocation(translate("Location {0}").str()),
+    cleaningFoundThree(translate("{0} found {1}, {2} and {3}.").str()),
+    cleaningFoundTwo(translate("{0} found {1} and {2}.").str()),
+    cleaningFoundOne(translate("{0} found {1}.").str()),
+    cleaningFoundDirtyEdits(translate("{0} found dirty edits.").str()),
+    unsortedLoadOrder(
+        translate("You have not sorted your load order this session.").str()),
+    tooManyActiveNormalPlugins(translate("You have {0} active normal plugins "
+                                         "but the game only supports up to "
+                                         "{1}.")
+                                   .str()),
+    tooManyActivePlugins(translate("You have {0} active plugins but the "
+                                   "game only supports up to {1}.")
+                             .str()),
+    tooManyActiveLightPlugins(translate("You have {0} active light plugins "
+                                        "but the game only supports up to "
+                                        "{1}.")
+                                  .str()),
+    mwseRequired(translate("Do not launch Morrowind without the use of MWSE or "
+                           "it will cause severe damage to your game.")
+                     .str()),
+    sharedFEIndex(
+        translate("You have a normal plugin and at least one light plugin "
+                  "sharing the FE load order index. Deactivate a normal "
+                  "plugin or all your light plugins to avoid potential "
+                  "issues.")
+            .str()),
+    caseSensitiveGamePath(
+        translate(
+            /* translators: The placeholder is for the current game's name. */
+            "{0} is installed in a case-sensitive location. This may "
+            "cause issues as the game, mods and LOOT may assume that "
+            "filesystem paths are not case-sensitive, which is the default "
+            "on Windows.")
+            .str()),
+    caseSensitiveGameLocalPath(
+        translate(
+            /* translators: The placeholder is for the current game's name. */
+            "{0}'s local application data is stored in a case-sensitive "
+            "location. This may cause issues as the game, mods and LOOT "
+            "may assume that filesystem paths are not case-sensitive, "
+            "which is the default on Windows.")
+            .str()) {}
+
+const MessageStrings& GetMessageStrings() {
+  const auto strings = currentMessageStrings.load(std::memory_order_acquire);
+  if (strings != nullptr) {
+    return *strings;
+  }
+
+  return loadMessageStrings(false);
+}
+
+void LoadMessageStrings() { loadMessageStrings(true); }
+}
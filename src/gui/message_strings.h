@@ -0,0 +1,132 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_MESSAGE_STRINGS
+#define LOOT_GUI_MESSAGE_STRINGS
+
+#include <spdlog/fmt/fmt.h>
+
+#include <array>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace loot {
+// A format string that only uses positional placeholders like "{0}" (and
+// escaped braces), split into its literal and placeholder segments up front so
+// that formatting it is just string concatenation. Format strings that use
+// anything else (e.g. format specs) are passed to fmt::format() instead.
+class MessageFormat {
+public:
+  MessageFormat() = default;
+  explicit MessageFormat(std::string formatString);
+
+  const std::string& str() const;
+
+  template<typename... Args>
+  std::string format(const Args&... args) const {
+    if (!isParsed) {
+      return fmt::format(fmt::runtime(formatString), args...);
+    }
+
+    const std::array<std::string, sizeof...(Args)> arguments{
+        toArgument(args)...};
+    return format(arguments.data(), arguments.size());
+  }
+
+private:
+  struct Segment {
+    std::string text;
+    // The index of the argument that follows the text, if any.
+    std::optional<size_t> argumentIndex;
+  };
+
+  std::string formatString;
+  std::vector<Segment> segments;
+  size_t literalLength{0};
+  bool isParsed{false};
+
+  bool parse();
+  std::string format(const std::string* arguments, size_t count) const;
+
+  template<typename T>
+  static std::string toArgument(const T& value) {
+    if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+      return std::string(std::string_view(value));
+    } else {
+      return fmt::to_string(value);
+    }
+  }
+};
+
+// The translated text of messages that may be generated for every plugin, so
+// that generating them doesn't involve looking up the message catalogue or
+// parsing format strings.
+struct MessageStrings {
+  // Translates the strings using the current global locale.
+  MessageStrings();
+
+  MessageFormat missingMaster;
+  MessageFormat inactiveMaster;
+  MessageFormat incompatibility;
+  MessageFormat lightPluginRequiresNonMaster;
+  std::string invalidLightPlugin;
+  std::string invalidOverridePlugin;
+  MessageFormat invalidHeaderVersion;
+  MessageFormat missingGroup;
+  MessageFormat bashTagsOverride;
+
+  MessageFormat conditionEvaluationError;
+  std::string location;
+  MessageFormat numberedLocation;
+
+  MessageFormat cleaningFoundThree;
+  MessageFormat cleaningFoundTwo;
+  MessageFormat cleaningFoundOne;
+  MessageFormat cleaningFoundDirtyEdits;
+
+  std::string unsortedLoadOrder;
+  MessageFormat tooManyActiveNormalPlugins;
+  MessageFormat tooManyActivePlugins;
+  MessageFormat tooManyActiveLightPlugins;
+  std::string mwseRequired;
+  std::string sharedFEIndex;
+  MessageFormat caseSensitiveGamePath;
+  MessageFormat caseSensitiveGameLocalPath;
+};
+
+// Returns the strings that were translated the last time LoadMessageStrings()
+// was called, calling it first if it has not yet been called.
+const MessageStrings& GetMessageStrings();
+
+// Translates the message strings for the current global locale, so should be
+// called whenever it is changed. References to previously loaded strings
+// remain valid.
+void LoadMessageStrings();
+}
+
+#endif
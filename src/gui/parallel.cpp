@@ -0,0 +1,152 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2014 WrinklyNinja
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/parallel.h"
+
+#include <algorithm>
+
+namespace loot {
+ThreadPool::ThreadPool(size_t threadCount) {
+  threads.reserve(threadCount);
+  for (size_t i = 0; i < threadCount; ++i) {
+    threads.emplace_back([this]() { run(); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+  }
+  condition.notify_all();
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+size_t ThreadPool::size() const { return threads.size(); }
+
+size_t ThreadPool::getBusyThreadCount() const { return busyThreadCount; }
+
+void ThreadPool::submit(std::function<void()> task) {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    tasks.push_back(std::move(task));
+  }
+  condition.notify_one();
+}
+
+void ThreadPool::run() {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      condition.wait(lock, [this]() { return stopping || !tasks.empty(); });
+
+      if (tasks.empty()) {
+        return;
+      }
+
+      task = std::move(tasks.front());
+      tasks.pop_front();
+    }
+
+    busyThreadCount += 1;
+    task();
+    busyThreadCount -= 1;
+  }
+}
+
+ThreadPool& GetThreadPool() {
+  static ThreadPool pool(
+      std::max(std::thread::hardware_concurrency(), 2u) - 1);
+
+  return pool;
+}
+
+namespace detail {
+ParallelMapState::ParallelMapState(size_t workerCount, size_t chunkCount) :
+    workerCount(workerCount),
+    chunkCount(chunkCount),
+    partitions(std::make_unique<Partition[]>(workerCount)) {
+  for (size_t i = 0; i < workerCount; ++i) {
+    partitions[i].next = i * chunkCount / workerCount;
+    partitions[i].end = (i + 1) * chunkCount / workerCount;
+  }
+}
+
+std::optional<size_t> ParallelMapState::claimChunk(size_t worker) {
+  for (size_t i = 0; i < workerCount; ++i) {
+    auto& partition = partitions[(worker + i) % workerCount];
+
+    // Check before incrementing so that exhausted partitions aren't bumped
+    // indefinitely by workers looking for chunks to steal.
+    if (partition.next.load(std::memory_order_relaxed) >= partition.end) {
+      continue;
+    }
+
+    const auto chunk = partition.next.fetch_add(1, std::memory_order_relaxed);
+    if (chunk < partition.end) {
+      return chunk;
+    }
+  }
+
+  return std::nullopt;
+}
+
+void ParallelMapState::completeChunk() {
+  std::lock_guard<std::mutex> lock(mutex);
+  completedChunks += 1;
+  if (completedChunks == chunkCount) {
+    condition.notify_all();
+  }
+}
+
+void ParallelMapState::waitForAllChunks() {
+  std::unique_lock<std::mutex> lock(mutex);
+  condition.wait(lock, [this]() { return completedChunks == chunkCount; });
+}
+
+void ParallelMapState::recordError(size_t index) {
+  auto current = firstErrorIndex.load();
+  while (index < current &&
+         !firstErrorIndex.compare_exchange_weak(current, index)) {
+  }
+}
+
+size_t ParallelMapState::getFirstErrorIndex() const {
+  return firstErrorIndex.load();
+}
+
+size_t GetParallelMapChunkSize(size_t inputSize, size_t workerCount) {
+  // Aim for several chunks per worker so that there's something to steal when
+  // some elements are much slower to map than others.
+  static constexpr size_t CHUNKS_PER_WORKER = 4;
+
+  return std::max(inputSize / (workerCount * CHUNKS_PER_WORKER), size_t(1));
+}
+}
+}
@@ -0,0 +1,264 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2014 WrinklyNinja
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_PARALLEL
+#define LOOT_GUI_PARALLEL
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace loot {
+// A fixed-size pool of worker threads that run submitted tasks in FIFO order.
+class ThreadPool {
+public:
+  explicit ThreadPool(size_t threadCount);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  size_t size() const;
+
+  // The number of threads that are currently running a task.
+  size_t getBusyThreadCount() const;
+
+  void submit(std::function<void()> task);
+
+private:
+  std::mutex mutex;
+  std::condition_variable condition;
+  std::deque<std::function<void()>> tasks;
+  bool stopping{false};
+  std::atomic<size_t> busyThreadCount{0};
+  std::vector<std::thread> threads;
+
+  void run();
+};
+
+// Get the pool that is shared by all of LOOT's parallel algorithms. It has one
+// fewer thread than the hardware supports (but at least one), because the
+// thread that starts a parallel algorithm also takes part in it.
+ThreadPool& GetThreadPool();
+
+namespace detail {
+class ParallelMapState {
+public:
+  static constexpr size_t NO_ERROR_INDEX = std::numeric_limits<size_t>::max();
+
+  ParallelMapState(size_t workerCount, size_t chunkCount);
+
+  // Claim the next chunk for the given worker, first from the worker's own
+  // partition of chunks and then by stealing from the other workers'.
+  std::optional<size_t> claimChunk(size_t worker);
+
+  void completeChunk();
+
+  void waitForAllChunks();
+
+  void recordError(size_t index);
+
+  size_t getFirstErrorIndex() const;
+
+private:
+  struct Partition {
+    std::atomic<size_t> next{0};
+    size_t end{0};
+  };
+
+  size_t workerCount;
+  size_t chunkCount;
+  std::unique_ptr<Partition[]> partitions;
+  std::atomic<size_t> firstErrorIndex{NO_ERROR_INDEX};
+
+  std::mutex mutex;
+  std::condition_variable condition;
+  size_t completedChunks{0};
+};
+
+size_t GetParallelMapChunkSize(size_t inputSize, size_t workerCount);
+
+// Uninitialised storage for a fixed number of values that are each constructed
+// at most once, in any order and from any thread, so that values can be
+// constructed in place without needing to be default-constructible.
+template<typename T>
+class ParallelMapOutputs {
+public:
+  explicit ParallelMapOutputs(size_t size) :
+      storage(std::make_unique<Storage[]>(size)), isConstructed(size, 0) {}
+
+  ~ParallelMapOutputs() {
+    for (size_t i = 0; i < isConstructed.size(); i += 1) {
+      if (isConstructed[i] != 0) {
+        get(i)->~T();
+      }
+    }
+  }
+
+  ParallelMapOutputs(const ParallelMapOutputs&) = delete;
+  ParallelMapOutputs& operator=(const ParallelMapOutputs&) = delete;
+
+  // Construct the value at the given index from the result of calling
+  // factory. If factory returns a T by value, the value is constructed
+  // directly in its storage without being copied or moved.
+  template<typename Factory>
+  void construct(size_t index, const Factory& factory) {
+    new (static_cast<void*>(storage[index].bytes)) T(factory());
+    isConstructed[index] = 1;
+  }
+
+  // Move all the values into a vector. All values must have been constructed.
+  std::vector<T> release() {
+    std::vector<T> values;
+    values.reserve(isConstructed.size());
+
+    for (size_t i = 0; i < isConstructed.size(); i += 1) {
+      values.push_back(std::move(*get(i)));
+    }
+
+    return values;
+  }
+
+private:
+  struct Storage {
+    alignas(T) std::byte bytes[sizeof(T)];
+  };
+
+  std::unique_ptr<Storage[]> storage;
+  // Each element is written by only one thread, and unlike std::vector<bool>
+  // elements don't share storage, so they can be written concurrently.
+  std::vector<char> isConstructed;
+
+  T* get(size_t index) {
+    return std::launder(reinterpret_cast<T*>(storage[index].bytes));
+  }
+};
+}
+
+// Map each of the given inputs to an output by calling mapper on the calling
+// thread and on the threads of the given pool. Work is split into chunks that
+// idle workers steal from busy workers, so slow elements don't leave threads
+// idle. Outputs are constructed in place as they are mapped, so they don't
+// need to be default-constructible, and are moved into the returned vector
+// once all inputs have been mapped.
+//
+// If the mapper throws for any inputs, a std::runtime_error is thrown with the
+// message of the exception thrown for the lowest-index input, so the error
+// that is reported does not depend on thread scheduling.
+//
+// At most maxWorkerCount threads, including the calling thread, map inputs at
+// once. This is useful when the mapper is limited by I/O rather than CPU time.
+template<typename Input, typename Mapper>
+auto ParallelMap(const std::vector<Input>& inputs,
+                 const Mapper& mapper,
+                 ThreadPool& pool = GetThreadPool(),
+                 size_t maxWorkerCount = std::numeric_limits<size_t>::max())
+    -> std::vector<std::decay_t<std::invoke_result_t<const Mapper&,
+                                                     const Input&>>> {
+  typedef std::decay_t<std::invoke_result_t<const Mapper&, const Input&>>
+      Output;
+
+  if (inputs.empty()) {
+    return {};
+  }
+
+  detail::ParallelMapOutputs<Output> outputs(inputs.size());
+
+  const auto workerCount = std::min(
+      {pool.size() + 1, inputs.size(), std::max<size_t>(maxWorkerCount, 1)});
+  const auto chunkSize = detail::GetParallelMapChunkSize(inputs.size(),
+                                                         workerCount);
+  const auto chunkCount = (inputs.size() + chunkSize - 1) / chunkSize;
+
+  const auto state =
+      std::make_shared<detail::ParallelMapState>(workerCount, chunkCount);
+
+  // Each worker records errors in its own buffer so that workers don't contend
+  // with one another when mapping fails.
+  std::vector<std::vector<std::pair<size_t, std::string>>> workerErrors(
+      workerCount);
+
+  // Pool tasks may start after all chunks have been claimed, and even after
+  // this function has returned, so they must only access the state that they
+  // share ownership of until they successfully claim a chunk. The calling
+  // thread waits for all claimed chunks to be completed before returning.
+  const auto work = [&inputs, &mapper, &outputs, &workerErrors, chunkSize](
+                        detail::ParallelMapState& state, size_t worker) {
+    for (auto chunk = state.claimChunk(worker); chunk.has_value();
+         chunk = state.claimChunk(worker)) {
+      const auto begin = chunk.value() * chunkSize;
+      const auto end = std::min(begin + chunkSize, inputs.size());
+
+      // Skip chunks that can't contain the first error once one is known.
+      for (auto i = begin; i < end && i < state.getFirstErrorIndex(); ++i) {
+        try {
+          outputs.construct(i, [&]() { return mapper(inputs[i]); });
+        } catch (const std::exception& e) {
+          workerErrors[worker].emplace_back(i, e.what());
+          state.recordError(i);
+        }
+      }
+
+      state.completeChunk();
+    }
+  };
+
+  for (size_t worker = 1; worker < workerCount; ++worker) {
+    pool.submit([state, work, worker]() { work(*state, worker); });
+  }
+
+  work(*state, 0);
+  state->waitForAllChunks();
+
+  const auto firstErrorIndex = state->getFirstErrorIndex();
+  if (firstErrorIndex != detail::ParallelMapState::NO_ERROR_INDEX) {
+    for (const auto& errors : workerErrors) {
+      for (const auto& [index, message] : errors) {
+        if (index == firstErrorIndex) {
+          throw std::runtime_error(message);
+        }
+      }
+    }
+  }
+
+  return outputs.release();
+}
+}
+
+#endif
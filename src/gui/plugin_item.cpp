@@ -27,11 +27,11 @@
 
 #include <spdlog/fmt/fmt.h>
 
-#include <boost/algorithm/string.hpp>
-#include <boost/locale.hpp>
+#include <unordered_map>
 #include <variant>
 
 #include "gui/helpers.h"
+#include "gui/message_strings.h"
 #include "gui/state/game/helpers.h"
 #include "gui/state/logging.h"
 
@@ -54,12 +54,8 @@ evaluateMasterlistMetadata(const gui::Game& game,
     return CreatePlainTextSourcedMessage(
         MessageType::error,
         MessageSource::caughtException,
-        fmt::format(boost::locale::translate(
-                        "\"{0}\" contains a condition that could not be "
-                        "evaluated. Details: {1}")
-                        .str(),
-                    pluginName,
-                    e.what()));
+        GetMessageStrings().conditionEvaluationError.format(pluginName,
+                                                            e.what()));
   }
 }
 
@@ -80,12 +76,8 @@ evaluateUserlistMetadata(const gui::Game& game, const std::string& pluginName) {
     return CreatePlainTextSourcedMessage(
         MessageType::error,
         MessageSource::caughtException,
-        fmt::format(boost::locale::translate(
-                        "\"{0}\" contains a condition that could not be "
-                        "evaluated. Details: {1}")
-                        .str(),
-                    pluginName,
-                    e.what()));
+        GetMessageStrings().conditionEvaluationError.format(pluginName,
+                                                            e.what()));
   }
 }
 
@@ -188,148 +180,46 @@ PluginItem::PluginItem(const PluginInterface& plugin,
   // don't appear in the UI.
   if (locations.size() == 1 && locations[0].GetName().empty()) {
     locations[0] =
-        Location(locations[0].GetURL(), boost::locale::translate("Location"));
+        Location(locations[0].GetURL(), GetMessageStrings().location);
   } else if (locations.size() > 1) {
+    const auto& strings = GetMessageStrings();
     for (size_t i = 0; i < locations.size(); i += 1) {
       if (locations[i].GetName().empty()) {
-        const auto locationName =
-            fmt::format(boost::locale::translate("Location {0}").str(), i + 1);
+        const auto locationName = strings.numberedLocation.format(i + 1);
         locations[i] = Location(locations[i].GetURL(), locationName);
       }
     }
   }
 }
 
-bool PluginItem::containsText(const std::string& text) const {
-  if (boost::icontains(name, text)) {
-    return true;
-  }
-
-  if (version.has_value() && boost::icontains(version.value(), text)) {
-    return true;
-  }
-
-  if (crc.has_value()) {
-    auto crcText = crcToString(crc.value());
-    if (boost::icontains(crcText, text)) {
-      return true;
-    }
-  }
-
-  for (const auto& tag : currentTags) {
-    if (boost::icontains(tag, text)) {
-      return true;
-    }
-  }
-
-  for (const auto& tag : addTags) {
-    if (boost::icontains(tag, text)) {
-      return true;
-    }
-  }
-
-  for (const auto& tag : removeTags) {
-    if (boost::icontains(tag, text)) {
-      return true;
-    }
-  }
-
-  for (const auto& message : messages) {
-    if (boost::icontains(message.text, text)) {
-      return true;
-    }
-  }
-
-  for (const auto& location : locations) {
-    if (boost::icontains(location.GetName(), text)) {
-      return true;
-    }
-  }
-
-  return false;
-}
-
-bool PluginItem::containsMatchingText(const std::regex& regex) const {
-  if (std::regex_search(name, regex)) {
-    return true;
-  }
-
-  if (version.has_value() && std::regex_search(version.value(), regex)) {
-    return true;
-  }
-
-  if (crc.has_value()) {
-    auto crcText = crcToString(crc.value());
-    if (std::regex_search(crcText, regex)) {
-      return true;
-    }
-  }
-
-  for (const auto& tag : currentTags) {
-    if (std::regex_search(tag, regex)) {
-      return true;
-    }
-  }
-
-  for (const auto& tag : addTags) {
-    if (std::regex_search(tag, regex)) {
-      return true;
-    }
-  }
-
-  for (const auto& tag : removeTags) {
-    if (std::regex_search(tag, regex)) {
-      return true;
-    }
-  }
-
-  for (const auto& message : messages) {
-    if (std::regex_search(message.text, regex)) {
-      return true;
-    }
-  }
+std::vector<std::string> PluginItem::contentToSearch() const {
+  std::vector<std::string> fields;
+  fields.reserve(3 + currentTags.size() + addTags.size() + removeTags.size() +
+                 messages.size() + locations.size());
 
-  for (const auto& location : locations) {
-    if (std::regex_search(location.GetName(), regex)) {
-      return true;
-    }
-  }
-
-  return false;
-}
-
-std::string PluginItem::contentToSearch() const {
-  auto text = name;
+  fields.push_back(name);
 
   if (version.has_value()) {
-    text += version.value();
+    fields.push_back(version.value());
   }
 
   if (crc.has_value()) {
-    text += crcToString(crc.value());
-  }
-
-  for (const auto& tag : currentTags) {
-    text += tag;
+    fields.push_back(crcToString(crc.value()));
   }
 
-  for (const auto& tag : addTags) {
-    text += tag;
-  }
-
-  for (const auto& tag : removeTags) {
-    text += tag;
-  }
+  fields.insert(fields.end(), currentTags.begin(), currentTags.end());
+  fields.insert(fields.end(), addTags.begin(), addTags.end());
+  fields.insert(fields.end(), removeTags.begin(), removeTags.end());
 
   for (const auto& message : messages) {
-    text += message.text;
+    fields.push_back(message.text);
   }
 
   for (const auto& location : locations) {
-    text += location.GetName();
+    fields.push_back(location.GetName());
   }
 
-  return text;
+  return fields;
 }
 
 std::string PluginItem::getMarkdownContent() const {
@@ -432,17 +322,108 @@ std::string PluginItem::loadOrderIndexText() const {
   }
 }
 
+bool operator==(const PluginItem& lhs, const PluginItem& rhs) {
+  return lhs.name == rhs.name && lhs.loadOrderIndex == rhs.loadOrderIndex &&
+         lhs.crc == rhs.crc && lhs.version == rhs.version &&
+         lhs.group == rhs.group && lhs.cleaningUtility == rhs.cleaningUtility &&
+         lhs.isActive == rhs.isActive && lhs.isDirty == rhs.isDirty &&
+         lhs.isEmpty == rhs.isEmpty && lhs.isMaster == rhs.isMaster &&
+         lhs.isLightPlugin == rhs.isLightPlugin &&
+         lhs.isOverridePlugin == rhs.isOverridePlugin &&
+         lhs.loadsArchive == rhs.loadsArchive &&
+         lhs.hasUserMetadata == rhs.hasUserMetadata &&
+         lhs.isCreationClubPlugin == rhs.isCreationClubPlugin &&
+         lhs.currentTags == rhs.currentTags && lhs.addTags == rhs.addTags &&
+         lhs.removeTags == rhs.removeTags && lhs.messages == rhs.messages &&
+         lhs.locations == rhs.locations;
+}
+
+bool operator!=(const PluginItem& lhs, const PluginItem& rhs) {
+  return !(lhs == rhs);
+}
+
+PluginItemInputs::PluginItemInputs(const PluginItem& item) :
+    name(item.name),
+    crc(item.crc),
+    version(item.version),
+    isActive(item.isActive),
+    isEmpty(item.isEmpty),
+    isMaster(item.isMaster),
+    isLightPlugin(item.isLightPlugin),
+    isOverridePlugin(item.isOverridePlugin),
+    loadsArchive(item.loadsArchive),
+    currentTags(item.currentTags) {}
+
+PluginItemInputs::PluginItemInputs(const PluginInterface& plugin,
+                                   bool isActive) :
+    name(plugin.GetName()),
+    crc(plugin.GetCRC()),
+    version(plugin.GetVersion()),
+    isActive(isActive),
+    isEmpty(plugin.IsEmpty()),
+    isMaster(plugin.IsMaster()),
+    isLightPlugin(plugin.IsLightPlugin()),
+    isOverridePlugin(plugin.IsOverridePlugin()),
+    loadsArchive(plugin.LoadsArchive()) {
+  for (const auto& tag : plugin.GetBashTags()) {
+    currentTags.push_back(tag.GetName());
+  }
+}
+
+bool CanReusePluginItem(const PluginItemInputs& previous,
+                        const PluginItemInputs& current) {
+  // Only fully loaded plugins have a CRC, and a plugin's records must be loaded
+  // for it to be checked as a valid light or override plugin.
+  return previous.crc.has_value() && previous.crc == current.crc &&
+         previous.name == current.name &&
+         previous.version == current.version &&
+         previous.isActive == current.isActive &&
+         previous.isEmpty == current.isEmpty &&
+         previous.isMaster == current.isMaster &&
+         previous.isLightPlugin == current.isLightPlugin &&
+         previous.isOverridePlugin == current.isOverridePlugin &&
+         previous.loadsArchive == current.loadsArchive &&
+         previous.currentTags == current.currentTags;
+}
+
+bool CanReusePluginItems(const std::vector<PluginItemInputs>& previous,
+                         const std::vector<PluginItemInputs>& current) {
+  if (previous.size() != current.size()) {
+    return false;
+  }
+
+  std::unordered_map<std::string, const PluginItemInputs*> previousByName;
+  previousByName.reserve(previous.size());
+  for (const auto& inputs : previous) {
+    previousByName.emplace(inputs.name, &inputs);
+  }
+
+  for (const auto& inputs : current) {
+    const auto it = previousByName.find(inputs.name);
+    if (it == previousByName.end()) {
+      return false;
+    }
+
+    const auto& previousInputs = *it->second;
+    if (!previousInputs.crc.has_value() || previousInputs.crc != inputs.crc ||
+        previousInputs.version != inputs.version ||
+        previousInputs.isActive != inputs.isActive) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 std::vector<PluginItem> GetPluginItems(
     const std::vector<std::string>& pluginNames,
     const gui::Game& game,
     const std::string& language) {
-  const std::function<PluginItem(
-      const PluginInterface* const, std::optional<short>, bool)>
-      mapper = [&](const PluginInterface* const plugin,
-                   std::optional<short> loadOrderIndex,
-                   bool isActive) {
-        return PluginItem(*plugin, game, loadOrderIndex, isActive, language);
-      };
+  const auto mapper = [&](const PluginInterface* const plugin,
+                          std::optional<short> loadOrderIndex,
+                          bool isActive) {
+    return PluginItem(*plugin, game, loadOrderIndex, isActive, language);
+  };
 
   return MapFromLoadOrderData(game, pluginNames, mapper);
 }
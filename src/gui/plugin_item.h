@@ -30,7 +30,6 @@
 #include <loot/plugin_interface.h>
 
 #include <optional>
-#include <regex>
 #include <string>
 
 #include "gui/sourced_message.h"
@@ -69,19 +68,55 @@ struct PluginItem {
   std::vector<SourcedMessage> messages;
   std::vector<Location> locations;
 
-  bool containsText(const std::string& text) const;
-  bool containsMatchingText(const std::regex& regex) const;
-
-  // QAbstractItemModel has a match() function that operates on items' strings,
-  // so build a string that contains all the text that would be displayed for
-  // the plugin's card.
-  std::string contentToSearch() const;
+  // Get all the text that would be displayed for the plugin's card, with one
+  // element per field, so that content filtering and searching can match
+  // against each field separately.
+  std::vector<std::string> contentToSearch() const;
 
   std::string getMarkdownContent() const;
 
   std::string loadOrderIndexText() const;
 };
 
+bool operator==(const PluginItem& lhs, const PluginItem& rhs);
+
+bool operator!=(const PluginItem& lhs, const PluginItem& rhs);
+
+// The data that a PluginItem is built from that comes from the plugin file
+// and its active state, rather than from metadata or its position in the load
+// order.
+struct PluginItemInputs {
+  PluginItemInputs() = default;
+  explicit PluginItemInputs(const PluginItem& item);
+  PluginItemInputs(const PluginInterface& plugin, bool isActive);
+
+  std::string name;
+  std::optional<uint32_t> crc;
+  std::optional<std::string> version;
+  bool isActive{false};
+  bool isEmpty{false};
+  bool isMaster{false};
+  bool isLightPlugin{false};
+  bool isOverridePlugin{false};
+  bool loadsArchive{false};
+  std::vector<std::string> currentTags;
+};
+
+// Returns true if a PluginItem that was built from the previous inputs can be
+// reused for the current inputs. An item that was built without a CRC can't
+// be reused, because that means its plugin was only loaded as a header, and
+// some of the item's messages are only generated for fully loaded plugins.
+bool CanReusePluginItem(const PluginItemInputs& previous,
+                        const PluginItemInputs& current);
+
+// Returns true if the PluginItems that were built from the previous inputs can
+// be reused at all. Metadata conditions can check which other plugins are
+// installed and active and what their versions and CRCs are, so a change to
+// any plugin's inputs invalidates every item, as does any item having been
+// built without a CRC.
+bool CanReusePluginItems(const std::vector<PluginItemInputs>& previous,
+                         const std::vector<PluginItemInputs>& current);
+
 std::vector<PluginItem> GetPluginItems(
     const std::vector<std::string>& pluginNames,
     const gui::Game& game,
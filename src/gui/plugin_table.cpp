@@ -0,0 +1,141 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/plugin_table.h"
+
+namespace loot {
+PluginTable::PluginTable(const std::vector<PluginItem>& plugins) {
+  for (auto& bitset : flags) {
+    bitset.resize(plugins.size());
+  }
+
+  groupIds.resize(plugins.size());
+  messageCounts.resize(plugins.size());
+  warningCounts.resize(plugins.size());
+  errorCounts.resize(plugins.size());
+
+  for (size_t i = 0; i < plugins.size(); i += 1) {
+    setRow(i, plugins.at(i));
+  }
+}
+
+size_t PluginTable::size() const { return groupIds.size(); }
+
+void PluginTable::setPlugin(size_t index, const PluginItem& plugin) {
+  totalMessageCount -= messageCounts.at(index);
+  totalWarningCount -= warningCounts.at(index);
+  totalErrorCount -= errorCounts.at(index);
+
+  setRow(index, plugin);
+}
+
+const PluginBitset& PluginTable::getFlags(PluginFlag flag) const {
+  return flags.at(static_cast<size_t>(flag));
+}
+
+bool PluginTable::hasFlag(PluginFlag flag, size_t index) const {
+  return getFlags(flag).test(index);
+}
+
+PluginBitset PluginTable::getGroupMembers(const std::string& groupName) const {
+  PluginBitset members(size());
+
+  const auto it = groupNameIds.find(groupName);
+  if (it == groupNameIds.end()) {
+    return members;
+  }
+
+  const auto groupId = it->second;
+  for (size_t i = 0; i < groupIds.size(); i += 1) {
+    if (groupIds.at(i) == groupId) {
+      members.set(i);
+    }
+  }
+
+  return members;
+}
+
+bool PluginTable::isInGroup(size_t index, const std::string& groupName) const {
+  return groupNames.at(groupIds.at(index)) == groupName;
+}
+
+uint32_t PluginTable::getMessageCount(size_t index) const {
+  return messageCounts.at(index);
+}
+
+size_t PluginTable::getTotalMessageCount() const { return totalMessageCount; }
+
+size_t PluginTable::getTotalWarningCount() const { return totalWarningCount; }
+
+size_t PluginTable::getTotalErrorCount() const { return totalErrorCount; }
+
+uint32_t PluginTable::getGroupId(
+    const std::optional<std::string>& groupName) {
+  const auto name = groupName.value_or(Group::DEFAULT_NAME);
+  const auto nextId = static_cast<uint32_t>(groupNames.size());
+  const auto [it, inserted] = groupNameIds.emplace(name, nextId);
+  if (inserted) {
+    groupNames.push_back(name);
+  }
+
+  return it->second;
+}
+
+// The row's previous counts must already have been subtracted from the totals.
+void PluginTable::setRow(size_t index, const PluginItem& plugin) {
+  const auto setFlag = [&](PluginFlag flag, bool value) {
+    flags.at(static_cast<size_t>(flag)).set(index, value);
+  };
+
+  setFlag(PluginFlag::active, plugin.isActive);
+  setFlag(PluginFlag::dirty, plugin.isDirty);
+  setFlag(PluginFlag::empty, plugin.isEmpty);
+  setFlag(PluginFlag::master, plugin.isMaster);
+  setFlag(PluginFlag::lightPlugin, plugin.isLightPlugin);
+  setFlag(PluginFlag::overridePlugin, plugin.isOverridePlugin);
+  setFlag(PluginFlag::creationClubPlugin, plugin.isCreationClubPlugin);
+  setFlag(PluginFlag::hasUserMetadata, plugin.hasUserMetadata);
+
+  groupIds.at(index) = getGroupId(plugin.group);
+
+  uint32_t warnings = 0;
+  uint32_t errors = 0;
+  for (const auto& message : plugin.messages) {
+    if (message.type == MessageType::warn) {
+      warnings += 1;
+    } else if (message.type == MessageType::error) {
+      errors += 1;
+    }
+  }
+
+  messageCounts.at(index) = static_cast<uint32_t>(plugin.messages.size());
+  warningCounts.at(index) = warnings;
+  errorCounts.at(index) = errors;
+
+  totalMessageCount += messageCounts.at(index);
+  totalWarningCount += warnings;
+  totalErrorCount += errors;
+}
+}
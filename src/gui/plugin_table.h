@@ -0,0 +1,105 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_PLUGIN_TABLE
+#define LOOT_GUI_PLUGIN_TABLE
+
+#include <array>
+#include <boost/dynamic_bitset.hpp>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "gui/plugin_item.h"
+
+namespace loot {
+typedef boost::dynamic_bitset<uint64_t> PluginBitset;
+
+enum struct PluginFlag : unsigned int {
+  active,
+  dirty,
+  empty,
+  master,
+  lightPlugin,
+  overridePlugin,
+  creationClubPlugin,
+  hasUserMetadata,
+};
+
+// A column-oriented copy of the data in a list of PluginItem objects that
+// filtering and counting need, so that they can operate on packed bitsets and
+// small integers instead of walking the full objects. Bit i of each bitset and
+// element i of each other column is for the plugin at index i.
+class PluginTable {
+public:
+  PluginTable() = default;
+  explicit PluginTable(const std::vector<PluginItem>& plugins);
+
+  size_t size() const;
+
+  // Replace the data of the plugin at the given index, which must already be
+  // in the table.
+  void setPlugin(size_t index, const PluginItem& plugin);
+
+  const PluginBitset& getFlags(PluginFlag flag) const;
+  bool hasFlag(PluginFlag flag, size_t index) const;
+
+  // Plugins that have no group are in the default group.
+  PluginBitset getGroupMembers(const std::string& groupName) const;
+  bool isInGroup(size_t index, const std::string& groupName) const;
+
+  uint32_t getMessageCount(size_t index) const;
+
+  size_t getTotalMessageCount() const;
+  size_t getTotalWarningCount() const;
+  size_t getTotalErrorCount() const;
+
+private:
+  static constexpr size_t FLAG_COUNT =
+      static_cast<size_t>(PluginFlag::hasUserMetadata) + 1;
+
+  std::array<PluginBitset, FLAG_COUNT> flags;
+  // Group names are interned, and each plugin's group is stored as the index
+  // of its name in groupNames.
+  std::vector<std::string> groupNames;
+  std::unordered_map<std::string, uint32_t> groupNameIds;
+  std::vector<uint32_t> groupIds;
+  std::vector<uint32_t> messageCounts;
+  std::vector<uint32_t> warningCounts;
+  std::vector<uint32_t> errorCounts;
+  // The totals are kept up to date as plugins are set, so that replacing one
+  // plugin's data doesn't require summing every plugin's counts.
+  size_t totalMessageCount{0};
+  size_t totalWarningCount{0};
+  size_t totalErrorCount{0};
+
+  uint32_t getGroupId(const std::optional<std::string>& groupName);
+  void setRow(size_t index, const PluginItem& plugin);
+};
+}
+
+#endif
@@ -25,11 +25,20 @@
 
 #include "gui/qt/card_delegate.h"
 
+#include <QtCore/QAbstractProxyModel>
+#include <QtCore/QTimer>
+
 #include "gui/qt/counters.h"
 #include "gui/qt/plugin_item_model.h"
 #include "gui/state/logging.h"
 
 namespace loot {
+namespace {
+// The number of rows below a painted row that are also sized exactly, so that
+// rows that are scrolled into view have usually already been refined.
+constexpr int PREFETCH_ROW_COUNT = 3;
+}
+
 std::vector<std::string> getMessageTexts(
     const std::vector<SourcedMessage>& messages) {
   std::vector<std::string> texts;
@@ -75,6 +84,29 @@ QString getLongestString(std::initializer_list<std::string> list) {
   return QString::fromStdString(*longestString);
 }
 
+QModelIndex getSourceIndex(const QModelIndex& index) {
+  auto sourceIndex = index;
+  auto proxyModel = qobject_cast<const QAbstractProxyModel*>(index.model());
+  while (proxyModel != nullptr) {
+    sourceIndex = proxyModel->mapToSource(sourceIndex);
+    proxyModel = qobject_cast<const QAbstractProxyModel*>(sourceIndex.model());
+  }
+
+  return sourceIndex;
+}
+
+SizeHintCacheKey getPluginSizeHintCacheKey(
+    const PluginItem& pluginItem,
+    const CardContentFiltersState& filters) {
+  return SizeHintCacheKey(
+      getTagsText(pluginItem.currentTags, filters.hideBashTags),
+      getTagsText(pluginItem.addTags, filters.hideBashTags),
+      getTagsText(pluginItem.removeTags, filters.hideBashTags),
+      getMessageTexts(filterMessages(pluginItem, filters)),
+      getLocationNames(pluginItem.locations, filters.hideLocations),
+      false);
+}
+
 SizeHintCacheKey getSizeHintCacheKey(const QModelIndex& index) {
   if (index.row() == 0) {
     auto generalInfo = index.data(RawDataRole).value<GeneralInformation>();
@@ -98,19 +130,24 @@ SizeHintCacheKey getSizeHintCacheKey(const QModelIndex& index) {
                             getMessageTexts(generalInfo.generalMessages),
                             {supportsLightPlugins},
                             true);
-  } else {
-    auto pluginItem = index.data(RawDataRole).value<PluginItem>();
-    auto filters =
-        index.data(CardContentFiltersRole).value<CardContentFiltersState>();
+  }
+
+  // Read the plugin item directly from the source model if possible, to
+  // avoid copying it.
+  const auto sourceIndex = getSourceIndex(index);
+  const auto model = qobject_cast<const PluginItemModel*>(sourceIndex.model());
+  if (model != nullptr && sourceIndex.row() > 0) {
+    const auto itemIndex = static_cast<size_t>(sourceIndex.row()) - 1;
 
-    return SizeHintCacheKey(
-        getTagsText(pluginItem.currentTags, filters.hideBashTags),
-        getTagsText(pluginItem.addTags, filters.hideBashTags),
-        getTagsText(pluginItem.removeTags, filters.hideBashTags),
-        getMessageTexts(filterMessages(pluginItem, filters)),
-        getLocationNames(pluginItem.locations, filters.hideLocations),
-        false);
+    return getPluginSizeHintCacheKey(model->getPluginItems().at(itemIndex),
+                                     model->getCardContentFiltersState());
   }
+
+  auto pluginItem = index.data(RawDataRole).value<PluginItem>();
+  auto filters =
+      index.data(CardContentFiltersRole).value<CardContentFiltersState>();
+
+  return getPluginSizeHintCacheKey(pluginItem, filters);
 }
 
 void prepareWidget(QWidget* widget) {
@@ -184,8 +221,10 @@ QSize calculateSize(const QWidget* card,
    *
    * The problem is that you don't know what the largest minimum width is when
    * you're calculating card sizes for the first time, so you can't get an
-   * accurate height. That's why the card sizing cache is used to get it, as
-   * that cache is populated before the delegate tries to size anything.
+   * accurate height. That's why the card sizing cache is used to get it. The
+   * cache only knows the min widths of cards that have been created, so the
+   * delegate only reuses a cached size while the largest min width that it was
+   * calculated with would still give the same height.
    */
   const auto minCardWidth = card->layout()->minimumSize().width();
 
@@ -207,6 +246,42 @@ QSize calculateSize(const QWidget* card,
   return QSize(cardWidth, height);
 }
 
+// Estimates a plugin card's size from the amount of text that it displays,
+// without creating a card. Estimates are only used for rows that have not
+// been near the viewport, so they just need to be close enough that the
+// scroll bar doesn't jump around much as rows are sized exactly.
+QSize estimateSize(const SizeHintCacheKey& key,
+                   const QStyleOptionViewItem& option,
+                   int largestMinCardWidth) {
+  // The plugin name, version and CRC lines, plus the card's margins.
+  static constexpr int BASE_LINE_COUNT = 4;
+
+  const auto rectWidth = option.rect.width();
+  const auto textWidth = std::max({rectWidth, largestMinCardWidth, 1});
+  const auto& fontMetrics = option.fontMetrics;
+
+  const auto countLines = [&](const QString& text) {
+    if (text.isEmpty()) {
+      return 0;
+    }
+
+    return 1 + fontMetrics.horizontalAdvance(text) / textWidth;
+  };
+
+  auto lineCount = BASE_LINE_COUNT;
+  lineCount += countLines(std::get<0>(key));
+  lineCount += countLines(std::get<1>(key));
+  lineCount += countLines(std::get<2>(key));
+
+  for (const auto& message : std::get<3>(key)) {
+    lineCount += countLines(QString::fromStdString(message));
+  }
+
+  lineCount += static_cast<int>(std::get<4>(key).size());
+
+  return QSize(rectWidth, lineCount * fontMetrics.lineSpacing());
+}
+
 CardSizingCache::CardSizingCache(QWidget* cardParentWidget) :
     cardParentWidget(cardParentWidget) {}
 
@@ -229,93 +304,250 @@ void CardSizingCache::update(const QAbstractItemModel* model,
   }
 }
 
-QWidget* CardSizingCache::update(const QModelIndex& index) {
+void CardSizingCache::update(const QModelIndex& index) {
   if (!index.isValid()) {
-    return nullptr;
+    return;
   }
 
-  // Get the key cache entry if it exists, and the new cache key and its
-  // entry.
-  const auto keyCacheIt = keyCache.find(index.row());
-  const auto newCacheKey = getSizeHintCacheKey(index);
-  auto newCardCacheIt = cardCache.find(newCacheKey);
-
-  if (keyCacheIt != keyCache.end()) {
-    // This row has a cached key, get it.
-    const auto oldCacheKey = keyCacheIt->second;
-    if (*oldCacheKey == newCacheKey) {
-      // The cache key hasn't changed, no need to make any changes.
-      // Just return the key's card. It should never be null but handle that
-      // for safety.
-      return newCardCacheIt == cardCache.end() ? nullptr
-                                               : newCardCacheIt->second.first;
-    } else {
-      // The cache key has changed, get the old key's card cache entry and
-      // reduce its count by 1.
-      const auto oldCardCacheIt = cardCache.find(*oldCacheKey);
-      if (oldCardCacheIt != cardCache.end()) {
-        oldCardCacheIt->second.second -= 1;
-
-        // If the old key's count is now 0, remove it from the card cache.
-        if (oldCardCacheIt->second.second == 0) {
-          cardCache.erase(oldCardCacheIt);
-        }
-      }
+  const auto row = static_cast<size_t>(index.row());
+  if (row >= keyCache.size()) {
+    keyCache.resize(row + 1, nullptr);
+  }
+
+  // Get the key cache entry if it exists, and the new cache key.
+  const auto oldCacheKey = keyCache.at(row);
+  auto newCacheKey = getSizeHintCacheKey(index);
+
+  if (oldCacheKey != nullptr && *oldCacheKey == newCacheKey) {
+    // The cache key hasn't changed, no need to make any changes.
+    return;
+  }
+
+  // Get the new cache key's entry, creating it without a card if it doesn't
+  // exist, and increase its usage count by 1.
+  const auto newCardCacheIt =
+      cardCache.try_emplace(std::move(newCacheKey)).first;
+  acquire(newCardCacheIt->second);
+
+  // The cache key has changed, so reduce the old key's usage count by 1. This
+  // is done after the new key's count is increased because the old key's card
+  // may be deleted once its count is 0.
+  if (oldCacheKey != nullptr) {
+    release(oldCacheKey);
+  }
+
+  // Now update the key cache entry to point to the new key for this row.
+  keyCache.at(row) = &newCardCacheIt->first;
+}
+
+void CardSizingCache::insertRows(int firstRow, int lastRow) {
+  const auto first = static_cast<size_t>(firstRow);
+  if (first >= keyCache.size()) {
+    // The rows will be added when they are updated.
+    return;
+  }
+
+  const auto count = static_cast<size_t>(lastRow - firstRow + 1);
+  keyCache.insert(keyCache.begin() + first, count, nullptr);
+}
+
+void CardSizingCache::removeRows(int firstRow, int lastRow) {
+  const auto first = std::min(static_cast<size_t>(firstRow), keyCache.size());
+  const auto last = std::min(static_cast<size_t>(lastRow) + 1, keyCache.size());
+
+  for (auto i = first; i < last; i += 1) {
+    if (keyCache.at(i) != nullptr) {
+      release(keyCache.at(i));
     }
   }
 
-  // If there is no entry for the new cache key, create one.
-  if (newCardCacheIt == cardCache.end()) {
-    QWidget* widget = nullptr;
-    if (index.row() == 0) {
-      widget = setGeneralInfoCardContent(new GeneralInfoCard(cardParentWidget),
-                                         index);
-    } else {
-      widget = setPluginCardContent(new PluginCard(cardParentWidget), index);
+  keyCache.erase(keyCache.begin() + first, keyCache.begin() + last);
+}
+
+void CardSizingCache::moveRows(int firstRow,
+                               int lastRow,
+                               int destinationRow) {
+  // The destination row is the row that the moved rows are inserted before,
+  // counted before the move.
+  const auto first = static_cast<size_t>(firstRow);
+  const auto last = static_cast<size_t>(lastRow) + 1;
+  const auto destination = static_cast<size_t>(destinationRow);
+
+  const auto size = std::max(last, destination);
+  if (size > keyCache.size()) {
+    keyCache.resize(size, nullptr);
+  }
+
+  if (destination < first) {
+    std::rotate(keyCache.begin() + destination,
+                keyCache.begin() + first,
+                keyCache.begin() + last);
+  } else if (destination > last) {
+    std::rotate(keyCache.begin() + first,
+                keyCache.begin() + last,
+                keyCache.begin() + destination);
+  }
+}
+
+bool CardSizingCache::hasCard(const SizeHintCacheKey& key) const {
+  const auto it = cardCache.find(key);
+
+  return it != cardCache.end() && it->second.card != nullptr;
+}
+
+const SizeHintCacheKey* CardSizingCache::getCachedKey(int row) const {
+  if (row < 0 || static_cast<size_t>(row) >= keyCache.size()) {
+    return nullptr;
+  }
+
+  return keyCache.at(static_cast<size_t>(row));
+}
+
+QWidget* CardSizingCache::getCard(const QModelIndex& index) {
+  if (!index.isValid()) {
+    return nullptr;
+  }
+
+  auto it = cardCache.find(getSizeHintCacheKey(index));
+  if (it == cardCache.end()) {
+    const auto logger = getLogger();
+    if (logger) {
+      logger->warn(
+          "No cached card exists for row {}, card sizes may not be calculated "
+          "correctly",
+          index.row());
     }
 
-    prepareWidget(widget);
+    // Create an entry that no row uses, so that it gets purged later.
+    it = cardCache.try_emplace(getSizeHintCacheKey(index)).first;
+    schedulePurge();
+  }
 
-    newCardCacheIt =
-        cardCache.emplace(newCacheKey, std::make_pair(widget, 0)).first;
+  auto& entry = it->second;
+  if (entry.card != nullptr) {
+    cardHitCount += 1;
+    return entry.card;
   }
 
-  // Increase the new cache key's usage count by 1.
-  newCardCacheIt->second.second += 1;
+  cardMissCount += 1;
 
-  if (keyCacheIt == keyCache.end()) {
-    // This row has no cached key, add a pointer to the new key.
-    keyCache.emplace(index.row(), &newCardCacheIt->first);
+  if (index.row() == 0) {
+    entry.card = setGeneralInfoCardContent(
+        new GeneralInfoCard(cardParentWidget), index);
   } else {
-    // Now update the key cache entry to point to the new key for this row.
-    keyCacheIt->second = &newCardCacheIt->first;
+    entry.card =
+        setPluginCardContent(new PluginCard(cardParentWidget), index);
   }
 
-  // Return the new cache key entry's card.
-  return newCardCacheIt->second.first;
-}
+  prepareWidget(entry.card);
+  entry.card->ensurePolished();
 
-QWidget* CardSizingCache::getCard(const SizeHintCacheKey& key) const {
-  auto it = cardCache.find(key);
-  if (it != cardCache.end()) {
-    return it->second.first;
+  entry.minWidth = entry.card->layout()->minimumSize().width();
+  if (entry.rowCount > 0) {
+    minWidths.insert(entry.minWidth);
   }
 
-  return nullptr;
+  return entry.card;
 }
 
 int CardSizingCache::getLargestMinWidth() const {
-  int largest = 0;
-  for (const auto& [key, value] : cardCache) {
-    const auto minWidth = value.first->layout()->minimumSize().width();
-    if (minWidth > largest) {
-      largest = minWidth;
+  return minWidths.empty() ? 0 : *minWidths.rbegin();
+}
+
+CacheStatistics CardSizingCache::getStatistics() const {
+  CacheStatistics statistics;
+  statistics.hitCount = cardHitCount;
+  statistics.missCount = cardMissCount;
+
+  for (const auto& [key, entry] : cardCache) {
+    if (entry.card != nullptr) {
+      statistics.entryCount += 1;
     }
   }
 
-  return largest;
+  return statistics;
+}
+
+void CardSizingCache::acquire(CardCacheEntry& entry) {
+  entry.rowCount += 1;
+
+  if (entry.rowCount == 1 && entry.card != nullptr) {
+    minWidths.insert(entry.minWidth);
+  }
+}
+
+void CardSizingCache::release(const SizeHintCacheKey* key) {
+  const auto it = cardCache.find(*key);
+  if (it == cardCache.end() || it->second.rowCount == 0) {
+    return;
+  }
+
+  auto& entry = it->second;
+  entry.rowCount -= 1;
+
+  if (entry.rowCount == 0) {
+    // The card is waiting to be deleted, so its min width no longer counts.
+    if (entry.card != nullptr) {
+      minWidths.erase(minWidths.find(entry.minWidth));
+    }
+
+    schedulePurge();
+  }
+}
+
+void CardSizingCache::schedulePurge() {
+  if (!isPurgeScheduled) {
+    isPurgeScheduled = true;
+    QTimer::singleShot(0, cardParentWidget, [this]() { purgeUnusedCards(); });
+  }
+}
+
+void CardSizingCache::purgeUnusedCards() {
+  isPurgeScheduled = false;
+
+  for (auto it = cardCache.begin(); it != cardCache.end();) {
+    if (it->second.rowCount == 0) {
+      if (it->second.card != nullptr) {
+        it->second.card->deleteLater();
+      }
+      it = cardCache.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+std::optional<QSize> SizeHintCache::find(const SizeHintCacheKey& key,
+                                         int rectWidth,
+                                         int largestMinWidth) const {
+  const auto it = entries.find(key);
+  if (it == entries.end()) {
+    return std::nullopt;
+  }
+
+  const auto& entry = it->second;
+  if (entry.rectWidth != rectWidth ||
+      entry.wrapWidth != std::max(rectWidth, largestMinWidth)) {
+    return std::nullopt;
+  }
+
+  return entry.size;
+}
+
+void SizeHintCache::insert(const SizeHintCacheKey& key,
+                           int rectWidth,
+                           int largestMinWidth,
+                           const QSize& size) {
+  Entry entry;
+  entry.size = size;
+  entry.rectWidth = rectWidth;
+  entry.wrapWidth = std::max(rectWidth, largestMinWidth);
+
+  entries.insert_or_assign(key, entry);
 }
 
+size_t SizeHintCache::size() const { return entries.size(); }
+
 CardDelegate::CardDelegate(QListView* parent,
                            CardSizingCache& cardSizingCache) :
     QStyledItemDelegate(parent),
@@ -375,6 +607,11 @@ void CardDelegate::paint(QPainter* painter,
   widget->render(painter, QPoint(), QRegion(), QWidget::DrawChildren);
 
   painter->restore();
+
+  for (int i = 0; i <= PREFETCH_ROW_COUNT; i += 1) {
+    scheduleSizeHintRefinement(styleOption,
+                               index.siblingAtRow(index.row() + i));
+  }
 }
 
 QSize CardDelegate::sizeHint(const QStyleOptionViewItem& option,
@@ -391,38 +628,104 @@ QSize CardDelegate::sizeHint(const QStyleOptionViewItem& option,
   }
 
   const auto cacheKey = getSizeHintCacheKey(index);
+  const auto largestMinWidth = cardSizingCache->getLargestMinWidth();
 
-  auto it = sizeHintCache.find(cacheKey);
-  if (it != sizeHintCache.end()) {
-    // Found a cached size, check if its width matches the current available
-    // width.
-    if (it->second.width() == styleOption.rect.width()) {
-      // The cached size is valid, return it.
-      return it->second;
-    }
-  } else {
-    // Store an invalid size so that it can be replaced below.
-    it = sizeHintCache.emplace(cacheKey, QSize()).first;
+  const auto cachedSize = sizeHintCache.find(
+      cacheKey, styleOption.rect.width(), largestMinWidth);
+  if (cachedSize.has_value()) {
+    sizeHintCacheHitCount += 1;
+    return cachedSize.value();
   }
 
-  auto card = cardSizingCache->getCard(cacheKey);
-  if (card == nullptr) {
-    const auto logger = getLogger();
-    logger->warn(
-        "No cached card exists for row {}, card sizes may not be calculated "
-        "correctly",
-        index.row());
-    card = cardSizingCache->update(index);
+  sizeHintCacheMissCount += 1;
+
+  if (index.row() != 0 && !cardSizingCache->hasCard(cacheKey)) {
+    // The row hasn't been near the viewport yet, so avoid creating a card for
+    // it. Its size will be refined when it gets painted.
+    return estimateSize(cacheKey, styleOption, largestMinWidth);
   }
 
-  const auto sizeHint =
-      calculateSize(card, styleOption, cardSizingCache->getLargestMinWidth());
+  return calculateExactSize(styleOption, index, cacheKey);
+}
+
+CacheStatistics CardDelegate::getSizeHintCacheStatistics() const {
+  CacheStatistics statistics;
+  statistics.entryCount = sizeHintCache.size();
+  statistics.hitCount = sizeHintCacheHitCount;
+  statistics.missCount = sizeHintCacheMissCount;
+
+  return statistics;
+}
 
-  it->second = sizeHint;
+QSize CardDelegate::calculateExactSize(const QStyleOptionViewItem& option,
+                                       const QModelIndex& index,
+                                       const SizeHintCacheKey& cacheKey) const {
+  const auto card = cardSizingCache->getCard(index);
+
+  // Get the largest min width after creating the card, as that may have
+  // changed it.
+  const auto largestMinWidth = cardSizingCache->getLargestMinWidth();
+  const auto sizeHint = calculateSize(card, option, largestMinWidth);
+
+  sizeHintCache.insert(
+      cacheKey, option.rect.width(), largestMinWidth, sizeHint);
 
   return sizeHint;
 }
 
+void CardDelegate::scheduleSizeHintRefinement(
+    const QStyleOptionViewItem& option,
+    const QModelIndex& index) const {
+  if (!index.isValid()) {
+    return;
+  }
+
+  rowsToRefine.push_back(QPersistentModelIndex(index));
+  refineOption = option;
+
+  if (!isRefineScheduled) {
+    isRefineScheduled = true;
+
+    // Painting may happen many times before control returns to the event
+    // loop, so the refinement is deferred until then.
+    const auto delegate = const_cast<CardDelegate*>(this);
+    QTimer::singleShot(0, delegate, [delegate]() {
+      delegate->refineSizeHints();
+    });
+  }
+}
+
+void CardDelegate::refineSizeHints() {
+  isRefineScheduled = false;
+
+  const auto indexes = std::move(rowsToRefine);
+  rowsToRefine.clear();
+
+  for (const auto& persistentIndex : indexes) {
+    if (!persistentIndex.isValid()) {
+      continue;
+    }
+
+    const QModelIndex index = persistentIndex;
+    const auto cacheKey = getSizeHintCacheKey(index);
+    const auto cachedSize =
+        sizeHintCache.find(cacheKey,
+                           refineOption.rect.width(),
+                           cardSizingCache->getLargestMinWidth());
+    if (cachedSize.has_value()) {
+      continue;
+    }
+
+    calculateExactSize(refineOption, index, cacheKey);
+
+    // The view may have laid out the row using an estimated or stale size,
+    // so tell it to lay out its rows again. The view does so once control
+    // returns to the event loop, so refining several rows only causes one
+    // layout.
+    emit sizeHintChanged(index);
+  }
+}
+
 QWidget* CardDelegate::createEditor(QWidget* parent,
                                     const QStyleOptionViewItem&,
                                     const QModelIndex& index) const {
@@ -26,11 +26,15 @@
 #ifndef LOOT_GUI_QT_CARD_DELEGATE
 #define LOOT_GUI_QT_CARD_DELEGATE
 
+#include <optional>
+#include <set>
+
 #include <QtGui/QPainter>
 #include <QtWidgets/QListView>
 #include <QtWidgets/QStyledItemDelegate>
 #include <QtWidgets/QWidget>
 
+#include "gui/qt/diagnostics.h"
 #include "gui/qt/general_info_card.h"
 #include "gui/qt/plugin_card.h"
 #include "gui/qt/plugin_item_model.h"
@@ -73,6 +77,16 @@ typedef std::tuple<QString,
  * affected indexes. This update needs to happen before the delegate's paint or
  * size hint methods are called so that they are given the correct largest min
  * width value.
+ *
+ * The cache also needs to be told when rows are inserted, removed or moved, so
+ * that its per-row entries stay aligned with the model's rows. Cards that are
+ * no longer used by any row are only deleted once control returns to the event
+ * loop, so that rows that are removed and then re-inserted can reuse them.
+ *
+ * Updating the cache only records each row's key: card widgets are created
+ * when the delegate first asks for them, which it only does for rows that are
+ * near the viewport. The largest min width is therefore the largest min width
+ * of the cards that have been created so far.
  */
 class CardSizingCache {
 public:
@@ -81,16 +95,78 @@ public:
   void update(const QAbstractItemModel* model);
   void update(const QModelIndex& topLeft, const QModelIndex& bottomRight);
   void update(const QAbstractItemModel*, int firstRow, int lastRow);
-  QWidget* update(const QModelIndex& index);
+  void update(const QModelIndex& index);
+
+  void insertRows(int firstRow, int lastRow);
+  void removeRows(int firstRow, int lastRow);
+  void moveRows(int firstRow, int lastRow, int destinationRow);
+
+  bool hasCard(const SizeHintCacheKey& key) const;
+
+  // Returns null if the row has no cached key.
+  const SizeHintCacheKey* getCachedKey(int row) const;
 
-  QWidget* getCard(const SizeHintCacheKey& key) const;
+  // Creates the card for the given index's key if it doesn't already exist.
+  QWidget* getCard(const QModelIndex& index);
 
   int getLargestMinWidth() const;
 
+  // Lookups are counted by getCard(), and the entry count is the number of
+  // cards that have been created.
+  CacheStatistics getStatistics() const;
+
 private:
+  struct CardCacheEntry {
+    // Null until the card is first needed.
+    QWidget* card{nullptr};
+    // The number of rows that have this entry's key.
+    unsigned int rowCount{0};
+    int minWidth{0};
+  };
+
   QWidget* cardParentWidget{nullptr};
-  std::map<int, const SizeHintCacheKey*> keyCache;
-  std::map<SizeHintCacheKey, std::pair<QWidget*, unsigned int>> cardCache;
+  // Indexed by row, null if the row has no cached key.
+  std::vector<const SizeHintCacheKey*> keyCache;
+  std::map<SizeHintCacheKey, CardCacheEntry> cardCache;
+  // The min widths of the created cards that are used by at least one row.
+  std::multiset<int> minWidths;
+  bool isPurgeScheduled{false};
+  uint64_t cardHitCount{0};
+  uint64_t cardMissCount{0};
+
+  void acquire(CardCacheEntry& entry);
+  void release(const SizeHintCacheKey* key);
+  void schedulePurge();
+  void purgeUnusedCards();
+};
+
+// Holds exact card sizes. A card's height depends on the width that its text is
+// wrapped to, which is the larger of the view's width and the largest min
+// width of the created cards, so each size is only used while both widths are
+// the same as when the size was calculated. This means that a change to the
+// largest min width only invalidates sizes that it actually affects, as they
+// are next requested.
+class SizeHintCache {
+public:
+  std::optional<QSize> find(const SizeHintCacheKey& key,
+                            int rectWidth,
+                            int largestMinWidth) const;
+
+  void insert(const SizeHintCacheKey& key,
+              int rectWidth,
+              int largestMinWidth,
+              const QSize& size);
+
+  size_t size() const;
+
+private:
+  struct Entry {
+    QSize size;
+    int rectWidth{0};
+    int wrapWidth{0};
+  };
+
+  std::map<SizeHintCacheKey, Entry> entries;
 };
 
 class CardDelegate : public QStyledItemDelegate {
@@ -119,11 +195,29 @@ public:
                     QAbstractItemModel* model,
                     const QModelIndex& index) const override;
 
+  CacheStatistics getSizeHintCacheStatistics() const;
+
 private:
   GeneralInfoCard* generalInfoCard{nullptr};
   PluginCard* pluginCard{nullptr};
   CardSizingCache* cardSizingCache;
-  mutable std::map<SizeHintCacheKey, QSize> sizeHintCache;
+  // Only holds exact sizes: estimated sizes are not cached.
+  mutable SizeHintCache sizeHintCache;
+  mutable uint64_t sizeHintCacheHitCount{0};
+  mutable uint64_t sizeHintCacheMissCount{0};
+  // Painted rows and the rows after them that may have estimated sizes. Their
+  // sizes are refined once painting has finished, because that can create
+  // cards and so change the largest min width.
+  mutable std::vector<QPersistentModelIndex> rowsToRefine;
+  mutable QStyleOptionViewItem refineOption;
+  mutable bool isRefineScheduled{false};
+
+  QSize calculateExactSize(const QStyleOptionViewItem& option,
+                           const QModelIndex& index,
+                           const SizeHintCacheKey& cacheKey) const;
+  void scheduleSizeHintRefinement(const QStyleOptionViewItem& option,
+                                  const QModelIndex& index) const;
+  void refineSizeHints();
 };
 }
 
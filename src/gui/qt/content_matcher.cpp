@@ -0,0 +1,103 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/content_matcher.h"
+
+#include <QtCore/QElapsedTimer>
+
+#include <algorithm>
+
+namespace loot {
+ContentMatcher::ContentMatcher(const QString& text) :
+    pattern(text),
+    timeBudget(DEFAULT_TIME_BUDGET),
+    timeSpent(std::make_shared<std::atomic<int64_t>>(0)) {}
+
+ContentMatcher::ContentMatcher(const QRegularExpression& regex,
+                               std::chrono::nanoseconds timeBudget) :
+    // Messages can span several lines, so use multiline mode to anchor to the
+    // start and end of each line within a field.
+    pattern(QRegularExpression(
+        regex.pattern(),
+        regex.patternOptions() | QRegularExpression::MultilineOption)),
+    timeBudget(timeBudget),
+    timeSpent(std::make_shared<std::atomic<int64_t>>(0)) {
+  // Compile the regex now instead of on first use.
+  std::get<QRegularExpression>(pattern).optimize();
+}
+
+bool ContentMatcher::isEmpty() const {
+  if (std::holds_alternative<QString>(pattern)) {
+    return std::get<QString>(pattern).isEmpty();
+  }
+
+  return std::get<QRegularExpression>(pattern).pattern().isEmpty();
+}
+
+bool ContentMatcher::isValid() const {
+  return std::holds_alternative<QString>(pattern) ||
+         std::get<QRegularExpression>(pattern).isValid();
+}
+
+QString ContentMatcher::errorString() const {
+  if (std::holds_alternative<QString>(pattern)) {
+    return QString();
+  }
+
+  return std::get<QRegularExpression>(pattern).errorString();
+}
+
+bool ContentMatcher::matches(const QString& field) const {
+  if (std::holds_alternative<QString>(pattern)) {
+    return field.contains(std::get<QString>(pattern), Qt::CaseInsensitive);
+  }
+
+  if (hasExceededTimeBudget()) {
+    return false;
+  }
+
+  QElapsedTimer timer;
+  timer.start();
+
+  const auto isMatch =
+      std::get<QRegularExpression>(pattern).match(field).hasMatch();
+
+  *timeSpent += timer.nsecsElapsed();
+
+  return isMatch;
+}
+
+bool ContentMatcher::matches(const QStringList& fields) const {
+  return std::any_of(fields.begin(), fields.end(), [&](const QString& field) {
+    return matches(field);
+  });
+}
+
+bool ContentMatcher::hasExceededTimeBudget() const {
+  return *timeSpent >= timeBudget.count();
+}
+
+void ContentMatcher::resetTimeBudget() { *timeSpent = 0; }
+}
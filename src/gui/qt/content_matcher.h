@@ -0,0 +1,72 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_CONTENT_MATCHER
+#define LOOT_GUI_QT_CONTENT_MATCHER
+
+#include <QtCore/QRegularExpression>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <variant>
+
+namespace loot {
+/**
+ * Matches plugin card content, as given by PluginItem::contentToSearch(),
+ * against either case-insensitive plain text or a regular expression. Each
+ * field of the content is matched separately, so a match can't span fields.
+ * Regular expressions are compiled once, and matching against them stops
+ * succeeding once the time spent matching exceeds a budget, so that a
+ * pathological pattern can't hang the UI. Copies share the same budget.
+ */
+class ContentMatcher {
+public:
+  static constexpr std::chrono::milliseconds DEFAULT_TIME_BUDGET{500};
+
+  explicit ContentMatcher(const QString& text);
+  explicit ContentMatcher(
+      const QRegularExpression& regex,
+      std::chrono::nanoseconds timeBudget = DEFAULT_TIME_BUDGET);
+
+  bool isEmpty() const;
+  bool isValid() const;
+  QString errorString() const;
+
+  bool matches(const QString& field) const;
+  bool matches(const QStringList& fields) const;
+
+  bool hasExceededTimeBudget() const;
+  void resetTimeBudget();
+
+private:
+  std::variant<QString, QRegularExpression> pattern;
+  std::chrono::nanoseconds timeBudget;
+  std::shared_ptr<std::atomic<int64_t>> timeSpent;
+};
+}
+
+#endif
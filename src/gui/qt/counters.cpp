@@ -25,6 +25,8 @@
 
 #include "gui/qt/counters.h"
 
+#include <algorithm>
+
 #include "gui/state/game/helpers.h"
 
 namespace loot {
@@ -50,6 +52,26 @@ GeneralInformationCounters::GeneralInformationCounters(
   }
 }
 
+GeneralInformationCounters::GeneralInformationCounters(
+    const std::vector<SourcedMessage>& generalMessages,
+    const PluginTable& plugins) {
+  countMessages(generalMessages);
+
+  warnings += plugins.getTotalWarningCount();
+  errors += plugins.getTotalErrorCount();
+  totalMessages += plugins.getTotalMessageCount();
+
+  totalPlugins = plugins.size();
+
+  const auto& activePlugins = plugins.getFlags(PluginFlag::active);
+  const auto& lightPlugins = plugins.getFlags(PluginFlag::lightPlugin);
+  const auto& overridePlugins = plugins.getFlags(PluginFlag::overridePlugin);
+
+  activeLight = (activePlugins & lightPlugins).count();
+  activeRegular = (activePlugins - lightPlugins - overridePlugins).count();
+  dirty = plugins.getFlags(PluginFlag::dirty).count();
+}
+
 void GeneralInformationCounters::countMessages(
     const std::vector<SourcedMessage>& messages) {
   for (const auto& message : messages) {
@@ -79,24 +101,59 @@ bool shouldFilterMessage(const std::string& pluginName,
   return false;
 }
 
+size_t countHiddenMessages(const PluginItem& plugin,
+                           const CardContentFiltersState& filters) {
+  if (filters.hideAllPluginMessages) {
+    return plugin.messages.size();
+  }
+
+  return std::count_if(plugin.messages.begin(),
+                       plugin.messages.end(),
+                       [&](const SourcedMessage& message) {
+                         return shouldFilterMessage(
+                             plugin.name, message, filters);
+                       });
+}
+
 size_t countHiddenMessages(const std::vector<PluginItem>& plugins,
                            const CardContentFiltersState& filters) {
   size_t hidden = 0;
 
   for (const auto& plugin : plugins) {
-    if (filters.hideAllPluginMessages) {
-      hidden += plugin.messages.size();
-      continue;
-    }
-
-    hidden += std::count_if(plugin.messages.begin(),
-                            plugin.messages.end(),
-                            [&](const SourcedMessage& message) {
-                              return shouldFilterMessage(
-                                  plugin.name, message, filters);
-                            });
+    hidden += countHiddenMessages(plugin, filters);
   }
 
   return hidden;
 }
+
+void HiddenMessageCounter::reset(const std::vector<PluginItem>& plugins,
+                                 const CardContentFiltersState& newFilters) {
+  filters = newFilters;
+  counts.clear();
+  counts.reserve(plugins.size());
+  total = 0;
+
+  for (const auto& plugin : plugins) {
+    const auto count = countHiddenMessages(plugin, filters);
+    counts.push_back(count);
+    total += count;
+  }
+}
+
+void HiddenMessageCounter::update(const std::vector<PluginItem>& plugins,
+                                  size_t firstIndex,
+                                  size_t lastIndex) {
+  if (counts.size() != plugins.size()) {
+    reset(plugins, filters);
+    return;
+  }
+
+  for (auto i = firstIndex; i <= lastIndex && i < plugins.size(); i += 1) {
+    const auto count = countHiddenMessages(plugins.at(i), filters);
+    total = total - counts.at(i) + count;
+    counts.at(i) = count;
+  }
+}
+
+size_t HiddenMessageCounter::getTotal() const { return total; }
 }
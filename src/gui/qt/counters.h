@@ -27,6 +27,7 @@
 #define LOOT_GUI_QT_COUNTERS
 
 #include "gui/plugin_item.h"
+#include "gui/plugin_table.h"
 #include "gui/qt/filters_states.h"
 #include "gui/sourced_message.h"
 
@@ -35,6 +36,8 @@ struct GeneralInformationCounters {
   GeneralInformationCounters() = default;
   GeneralInformationCounters(const std::vector<SourcedMessage>& generalMessages,
                              const std::vector<PluginItem>& plugins);
+  GeneralInformationCounters(const std::vector<SourcedMessage>& generalMessages,
+                             const PluginTable& plugins);
 
   size_t warnings{0};
   size_t errors{0};
@@ -53,8 +56,34 @@ bool shouldFilterMessage(const std::string& pluginName,
                          const SourcedMessage& message,
                          const CardContentFiltersState& filters);
 
+size_t countHiddenMessages(const PluginItem& plugin,
+                           const CardContentFiltersState& filters);
+
 size_t countHiddenMessages(const std::vector<PluginItem>& plugins,
                            const CardContentFiltersState& filters);
+
+// Keeps each plugin's hidden message count, so that the total can be updated
+// by recounting only the plugins that have changed.
+class HiddenMessageCounter {
+public:
+  // Recounts every plugin's hidden messages.
+  void reset(const std::vector<PluginItem>& plugins,
+             const CardContentFiltersState& filters);
+
+  // Recounts the hidden messages of the plugins at the given indexes, using
+  // the filters that were given when the counter was last reset. If the
+  // number of plugins has changed since then, every plugin is recounted.
+  void update(const std::vector<PluginItem>& plugins,
+              size_t firstIndex,
+              size_t lastIndex);
+
+  size_t getTotal() const;
+
+private:
+  CardContentFiltersState filters;
+  std::vector<size_t> counts;
+  size_t total{0};
+};
 }
 
 Q_DECLARE_METATYPE(loot::GeneralInformationCounters);
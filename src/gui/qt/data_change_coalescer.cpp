@@ -0,0 +1,165 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/data_change_coalescer.h"
+
+#include <QtCore/QTimer>
+#include <algorithm>
+#include <iterator>
+
+namespace loot {
+bool DataChanges::hasRole(int role) const {
+  return hasAllRoles || roles.contains(role);
+}
+
+void DataChanges::addRows(int firstRow, int lastRow) {
+  // The first range that the given rows could overlap or touch is the first
+  // that ends no earlier than the row before them, and the first range after
+  // the ones that they overlap or touch is the first that starts after the row
+  // after them.
+  auto begin = std::lower_bound(
+      rowRanges.begin(),
+      rowRanges.end(),
+      firstRow - 1,
+      [](const RowRange& range, int row) { return range.last < row; });
+  const auto end = std::upper_bound(
+      begin, rowRanges.end(), lastRow + 1, [](int row, const RowRange& range) {
+        return row < range.first;
+      });
+
+  if (begin != end) {
+    firstRow = std::min(firstRow, begin->first);
+    lastRow = std::max(lastRow, std::prev(end)->last);
+    begin = rowRanges.erase(begin, end);
+  }
+
+  rowRanges.insert(begin, RowRange{firstRow, lastRow});
+}
+
+DataChangeCoalescer::DataChangeCoalescer(QAbstractItemModel* model,
+                                         QSet<int> ignoredRoles) :
+    QObject(model), model(model), ignoredRoles(std::move(ignoredRoles)) {
+  connect(model,
+          &QAbstractItemModel::dataChanged,
+          this,
+          &DataChangeCoalescer::handleDataChanged);
+
+  // Pending changes' rows may no longer be where they were, so any structural
+  // change is recorded as a change to all rows.
+  connect(model,
+          &QAbstractItemModel::rowsInserted,
+          this,
+          &DataChangeCoalescer::handleRowsChanged);
+  connect(model,
+          &QAbstractItemModel::rowsRemoved,
+          this,
+          &DataChangeCoalescer::handleRowsChanged);
+  connect(model,
+          &QAbstractItemModel::rowsMoved,
+          this,
+          &DataChangeCoalescer::handleRowsChanged);
+  connect(model,
+          &QAbstractItemModel::layoutChanged,
+          this,
+          &DataChangeCoalescer::handleRowsChanged);
+  connect(model,
+          &QAbstractItemModel::modelReset,
+          this,
+          &DataChangeCoalescer::handleRowsChanged);
+}
+
+bool DataChangeCoalescer::hasPendingChanges() const {
+  return pendingChanges.has_value();
+}
+
+void DataChangeCoalescer::flush() {
+  if (!pendingChanges.has_value()) {
+    return;
+  }
+
+  // Reset the pending changes before emitting them, so that any changes made
+  // while handling them are collected into a new batch.
+  auto changes = std::move(pendingChanges.value());
+  pendingChanges.reset();
+
+  emit changed(changes);
+}
+
+void DataChangeCoalescer::scheduleFlush() {
+  if (!isFlushScheduled) {
+    isFlushScheduled = true;
+    QTimer::singleShot(0, this, [this]() {
+      isFlushScheduled = false;
+      flush();
+    });
+  }
+}
+
+void DataChangeCoalescer::handleDataChanged(const QModelIndex& topLeft,
+                                            const QModelIndex& bottomRight,
+                                            const QList<int>& roles) {
+  if (!topLeft.isValid() || !bottomRight.isValid()) {
+    return;
+  }
+
+  const auto isIgnored = !roles.isEmpty() &&
+                         std::all_of(roles.begin(), roles.end(), [&](int role) {
+                           return ignoredRoles.contains(role);
+                         });
+  if (isIgnored) {
+    return;
+  }
+
+  if (!pendingChanges.has_value()) {
+    pendingChanges = DataChanges();
+  }
+
+  // If rows have changed, all rows are already covered.
+  if (!pendingChanges->hasRowsChanged) {
+    pendingChanges->addRows(topLeft.row(), bottomRight.row());
+  }
+
+  if (roles.isEmpty()) {
+    pendingChanges->hasAllRoles = true;
+  } else {
+    for (const auto role : roles) {
+      pendingChanges->roles.insert(role);
+    }
+  }
+
+  scheduleFlush();
+}
+
+void DataChangeCoalescer::handleRowsChanged() {
+  if (!pendingChanges.has_value()) {
+    pendingChanges = DataChanges();
+  }
+
+  pendingChanges->hasRowsChanged = true;
+  pendingChanges->rowRanges = {RowRange{0, std::max(model->rowCount() - 1, 0)}};
+
+  scheduleFlush();
+}
+}
@@ -0,0 +1,103 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_DATA_CHANGE_COALESCER
+#define LOOT_GUI_QT_DATA_CHANGE_COALESCER
+
+#include <QtCore/QAbstractItemModel>
+#include <QtCore/QObject>
+#include <QtCore/QSet>
+#include <optional>
+#include <vector>
+
+namespace loot {
+// An inclusive range of rows.
+struct RowRange {
+  int first{0};
+  int last{0};
+};
+
+// The rows and roles of the dataChanged signals that a model emitted before
+// control returned to the event loop, and whether its rows changed.
+struct DataChanges {
+  // The changed rows, as ranges that are sorted and that don't overlap or
+  // touch. If the model's rows were inserted, removed, moved or reset while
+  // changes were pending, there is one range that covers all the model's
+  // rows.
+  std::vector<RowRange> rowRanges;
+
+  // True if the model's rows were inserted, removed, moved or reset.
+  bool hasRowsChanged{false};
+
+  // True if any of the dataChanged signals did not specify roles.
+  bool hasAllRoles{false};
+  QSet<int> roles;
+
+  bool hasRole(int role) const;
+
+  // Add the given rows to the changed row ranges, merging any ranges that
+  // they overlap or touch.
+  void addRows(int firstRow, int lastRow);
+};
+
+/**
+ * Collects a model's dataChanged signals and emits the changes as one batch
+ * once control returns to the event loop, so that work that depends on the
+ * whole model only needs to be done once for many changes, instead of once
+ * per signal. Signals for which every role is one of the given ignored roles
+ * are not collected. Structural changes are also collected, even if no data
+ * changed, as they invalidate anything that refers to rows.
+ */
+class DataChangeCoalescer : public QObject {
+  Q_OBJECT
+public:
+  DataChangeCoalescer(QAbstractItemModel* model, QSet<int> ignoredRoles);
+
+  bool hasPendingChanges() const;
+
+  // Emit any pending changes immediately instead of waiting for control to
+  // return to the event loop.
+  void flush();
+
+signals:
+  void changed(const DataChanges& changes);
+
+private:
+  QAbstractItemModel* model{nullptr};
+  QSet<int> ignoredRoles;
+  std::optional<DataChanges> pendingChanges;
+  bool isFlushScheduled{false};
+
+  void scheduleFlush();
+
+private slots:
+  void handleDataChanged(const QModelIndex& topLeft,
+                         const QModelIndex& bottomRight,
+                         const QList<int>& roles);
+  void handleRowsChanged();
+};
+}
+
+#endif
@@ -0,0 +1,144 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/diagnostics.h"
+
+#include <QtCore/QJsonArray>
+#include <deque>
+#include <mutex>
+#include <numeric>
+
+namespace loot {
+namespace {
+std::mutex diagnosticsMutex;
+std::map<std::string, std::deque<std::chrono::milliseconds>> taskDurations;
+WorkerThreadActivity workerThreadActivity;
+}
+
+void RecordTaskDuration(const std::string& taskName,
+                        std::chrono::milliseconds duration) {
+  std::lock_guard<std::mutex> guard(diagnosticsMutex);
+
+  auto& durations = taskDurations[taskName];
+  durations.push_back(duration);
+  if (durations.size() > RECENT_TASK_DURATIONS_LIMIT) {
+    durations.pop_front();
+  }
+
+  workerThreadActivity.completedTasks += 1;
+  workerThreadActivity.totalTaskDuration += duration;
+}
+
+std::map<std::string, std::vector<std::chrono::milliseconds>>
+GetRecentTaskDurations() {
+  std::lock_guard<std::mutex> guard(diagnosticsMutex);
+
+  std::map<std::string, std::vector<std::chrono::milliseconds>> result;
+  for (const auto& [taskName, durations] : taskDurations) {
+    result.emplace(taskName,
+                   std::vector<std::chrono::milliseconds>(durations.begin(),
+                                                          durations.end()));
+  }
+
+  return result;
+}
+
+void RecordWorkerThreadStarted() {
+  std::lock_guard<std::mutex> guard(diagnosticsMutex);
+
+  workerThreadActivity.runningThreads += 1;
+  workerThreadActivity.startedThreads += 1;
+}
+
+void RecordWorkerThreadFinished() {
+  std::lock_guard<std::mutex> guard(diagnosticsMutex);
+
+  if (workerThreadActivity.runningThreads > 0) {
+    workerThreadActivity.runningThreads -= 1;
+  }
+}
+
+WorkerThreadActivity GetWorkerThreadActivity() {
+  std::lock_guard<std::mutex> guard(diagnosticsMutex);
+
+  return workerThreadActivity;
+}
+
+QJsonObject ToJson(const CacheStatistics& statistics) {
+  const auto lookupCount = statistics.hitCount + statistics.missCount;
+  const auto hitRate = lookupCount == 0 ? 0.0
+                                        : static_cast<double>(
+                                              statistics.hitCount) /
+                                              static_cast<double>(lookupCount);
+
+  return QJsonObject{
+      {"entryCount", static_cast<qint64>(statistics.entryCount)},
+      {"hitCount", static_cast<qint64>(statistics.hitCount)},
+      {"missCount", static_cast<qint64>(statistics.missCount)},
+      {"hitRate", hitRate},
+  };
+}
+
+QJsonObject ToJson(
+    const std::map<std::string, std::vector<std::chrono::milliseconds>>&
+        taskDurations) {
+  QJsonObject json;
+  for (const auto& [taskName, durations] : taskDurations) {
+    if (durations.empty()) {
+      continue;
+    }
+
+    QJsonArray recentDurations;
+    for (const auto& duration : durations) {
+      recentDurations.append(static_cast<qint64>(duration.count()));
+    }
+
+    const auto total = std::accumulate(
+        durations.begin(), durations.end(), std::chrono::milliseconds(0));
+
+    json.insert(
+        QString::fromStdString(taskName),
+        QJsonObject{
+            {"recentDurationsMs", recentDurations},
+            {"lastDurationMs", static_cast<qint64>(durations.back().count())},
+            {"meanDurationMs",
+             static_cast<double>(total.count()) /
+                 static_cast<double>(durations.size())},
+        });
+  }
+
+  return json;
+}
+
+QJsonObject ToJson(const WorkerThreadActivity& activity) {
+  return QJsonObject{
+      {"runningThreads", static_cast<qint64>(activity.runningThreads)},
+      {"startedThreads", static_cast<qint64>(activity.startedThreads)},
+      {"completedTasks", static_cast<qint64>(activity.completedTasks)},
+      {"totalTaskDurationMs",
+       static_cast<qint64>(activity.totalTaskDuration.count())},
+  };
+}
+}
@@ -0,0 +1,78 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_DIAGNOSTICS
+#define LOOT_GUI_QT_DIAGNOSTICS
+
+#include <QtCore/QJsonObject>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace loot {
+// The number of durations that are kept for each type of task.
+static constexpr size_t RECENT_TASK_DURATIONS_LIMIT = 10;
+
+struct CacheStatistics {
+  size_t entryCount{0};
+  uint64_t hitCount{0};
+  uint64_t missCount{0};
+};
+
+struct WorkerThreadActivity {
+  size_t runningThreads{0};
+  uint64_t startedThreads{0};
+  uint64_t completedTasks{0};
+  std::chrono::milliseconds totalTaskDuration{0};
+};
+
+// The functions below are thread-safe, and are used to collect data for the
+// diagnostics dialog.
+
+void RecordTaskDuration(const std::string& taskName,
+                        std::chrono::milliseconds duration);
+
+// Durations are ordered from oldest to newest.
+std::map<std::string, std::vector<std::chrono::milliseconds>>
+GetRecentTaskDurations();
+
+void RecordWorkerThreadStarted();
+
+void RecordWorkerThreadFinished();
+
+WorkerThreadActivity GetWorkerThreadActivity();
+
+QJsonObject ToJson(const CacheStatistics& statistics);
+
+QJsonObject ToJson(
+    const std::map<std::string, std::vector<std::chrono::milliseconds>>&
+        taskDurations);
+
+QJsonObject ToJson(const WorkerThreadActivity& activity);
+}
+
+#endif
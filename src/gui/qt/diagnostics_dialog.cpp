@@ -0,0 +1,220 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/diagnostics_dialog.h"
+
+#include <spdlog/fmt/fmt.h>
+
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtWidgets/QDialogButtonBox>
+#include <QtWidgets/QFileDialog>
+#include <QtWidgets/QHeaderView>
+#include <QtWidgets/QMessageBox>
+#include <QtWidgets/QTreeWidgetItemIterator>
+#include <QtWidgets/QVBoxLayout>
+#include <algorithm>
+#include <boost/locale.hpp>
+
+#include "gui/qt/helpers.h"
+#include "gui/state/logging.h"
+
+namespace loot {
+namespace {
+constexpr int REFRESH_INTERVAL_MS = 1000;
+constexpr int DIALOG_WIDTH = 500;
+constexpr int DIALOG_HEIGHT = 600;
+
+QString toDisplayString(const QJsonValue &value) {
+  if (value.isArray()) {
+    QStringList elements;
+    for (const auto &element : value.toArray()) {
+      elements.append(toDisplayString(element));
+    }
+    return elements.join(", ");
+  }
+
+  if (value.isDouble()) {
+    const auto number = value.toDouble();
+    // Print integers without a fractional part, and other numbers with a
+    // few decimal places.
+    if (number == static_cast<double>(value.toInteger())) {
+      return QString::number(value.toInteger());
+    }
+    return QString::number(number, 'f', 3);
+  }
+
+  if (value.isBool()) {
+    return value.toBool() ? "true" : "false";
+  }
+
+  return value.toString();
+}
+
+void addItems(QTreeWidgetItem *parent, const QJsonObject &object) {
+  for (auto it = object.begin(); it != object.end(); ++it) {
+    const auto item = new QTreeWidgetItem(parent);
+    item->setText(0, it.key());
+
+    if (it.value().isObject()) {
+      addItems(item, it.value().toObject());
+    } else {
+      item->setText(1, toDisplayString(it.value()));
+    }
+  }
+}
+}
+
+DiagnosticsDialog::DiagnosticsDialog(QWidget *parent) : QDialog(parent) {
+  setupUi();
+}
+
+void DiagnosticsDialog::setDiagnostics(const QJsonObject &newDiagnostics) {
+  diagnostics = newDiagnostics;
+
+  // Preserve which items are expanded, identifying them by their key path.
+  std::vector<QStringList> expandedPaths;
+  for (QTreeWidgetItemIterator it(diagnosticsTree); *it != nullptr; ++it) {
+    if ((*it)->isExpanded()) {
+      QStringList path;
+      for (auto item = *it; item != nullptr; item = item->parent()) {
+        path.prepend(item->text(0));
+      }
+      expandedPaths.push_back(path);
+    }
+  }
+  const auto isFirstUpdate = diagnosticsTree->topLevelItemCount() == 0;
+
+  diagnosticsTree->clear();
+  addItems(diagnosticsTree->invisibleRootItem(), diagnostics);
+
+  if (isFirstUpdate) {
+    diagnosticsTree->expandAll();
+    return;
+  }
+
+  for (QTreeWidgetItemIterator it(diagnosticsTree); *it != nullptr; ++it) {
+    QStringList path;
+    for (auto item = *it; item != nullptr; item = item->parent()) {
+      path.prepend(item->text(0));
+    }
+
+    if (std::find(expandedPaths.begin(), expandedPaths.end(), path) !=
+        expandedPaths.end()) {
+      (*it)->setExpanded(true);
+    }
+  }
+}
+
+void DiagnosticsDialog::showEvent(QShowEvent *event) {
+  QDialog::showEvent(event);
+
+  emit refreshRequested();
+  refreshTimer->start();
+}
+
+void DiagnosticsDialog::hideEvent(QHideEvent *event) {
+  refreshTimer->stop();
+
+  QDialog::hideEvent(event);
+}
+
+void DiagnosticsDialog::setupUi() {
+  diagnosticsTree->setObjectName("diagnosticsTree");
+  exportButton->setObjectName("exportButton");
+  refreshTimer->setObjectName("refreshTimer");
+
+  refreshTimer->setInterval(REFRESH_INTERVAL_MS);
+
+  diagnosticsTree->setColumnCount(2);
+  diagnosticsTree->setSelectionMode(QAbstractItemView::NoSelection);
+  diagnosticsTree->header()->setSectionResizeMode(
+      0, QHeaderView::ResizeToContents);
+
+  auto buttonBox = new QDialogButtonBox(QDialogButtonBox::Close, this);
+  buttonBox->setObjectName("dialogButtons");
+  buttonBox->addButton(exportButton, QDialogButtonBox::ActionRole);
+
+  auto dialogLayout = new QVBoxLayout();
+
+  dialogLayout->addWidget(diagnosticsTree);
+  dialogLayout->addWidget(buttonBox);
+
+  setLayout(dialogLayout);
+
+  resize(DIALOG_WIDTH, DIALOG_HEIGHT);
+
+  translateUi();
+
+  connect(buttonBox, &QDialogButtonBox::rejected, this, &QDialog::reject);
+
+  QMetaObject::connectSlotsByName(this);
+}
+
+void DiagnosticsDialog::translateUi() {
+  setWindowTitle(translate("Performance Diagnostics"));
+
+  diagnosticsTree->setHeaderLabels({translate("Name"), translate("Value")});
+
+  exportButton->setText(translate("Export to JSON..."));
+}
+
+void DiagnosticsDialog::on_exportButton_clicked() {
+  const auto filePath =
+      QFileDialog::getSaveFileName(this,
+                                   translate("Export Diagnostics"),
+                                   "LOOTDiagnostics.json",
+                                   translate("JSON files (*.json)"));
+  if (filePath.isEmpty()) {
+    return;
+  }
+
+  QFile file(filePath);
+  const auto isWritten =
+      file.open(QIODevice::WriteOnly | QIODevice::Truncate) &&
+      file.write(QJsonDocument(diagnostics).toJson()) != -1;
+
+  if (!isWritten) {
+    const auto logger = getLogger();
+    if (logger) {
+      logger->error("Failed to write diagnostics to {}: {}",
+                    filePath.toStdString(),
+                    file.errorString().toStdString());
+    }
+
+    const auto message = fmt::format(
+        boost::locale::translate(
+            "Failed to export the diagnostics. Details: {0}")
+            .str(),
+        file.errorString().toStdString());
+
+    QMessageBox::critical(
+        this, translate("Error"), QString::fromStdString(message));
+  }
+}
+
+void DiagnosticsDialog::on_refreshTimer_timeout() { emit refreshRequested(); }
+}
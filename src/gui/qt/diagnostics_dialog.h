@@ -0,0 +1,70 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_DIAGNOSTICS_DIALOG
+#define LOOT_GUI_QT_DIAGNOSTICS_DIALOG
+
+#include <QtCore/QJsonObject>
+#include <QtCore/QTimer>
+#include <QtWidgets/QDialog>
+#include <QtWidgets/QPushButton>
+#include <QtWidgets/QTreeWidget>
+#include <QtWidgets/QWidget>
+
+namespace loot {
+// Displays performance diagnostics. While the dialog is visible it
+// periodically emits refreshRequested(), and the diagnostics that are then
+// passed to setDiagnostics() are displayed and can be exported as JSON.
+class DiagnosticsDialog : public QDialog {
+  Q_OBJECT
+public:
+  explicit DiagnosticsDialog(QWidget *parent);
+
+  void setDiagnostics(const QJsonObject &diagnostics);
+
+signals:
+  void refreshRequested();
+
+protected:
+  void showEvent(QShowEvent *event) override;
+  void hideEvent(QHideEvent *event) override;
+
+private:
+  QTreeWidget *diagnosticsTree{new QTreeWidget(this)};
+  QPushButton *exportButton{new QPushButton(this)};
+  QTimer *refreshTimer{new QTimer(this)};
+
+  QJsonObject diagnostics;
+
+  void setupUi();
+  void translateUi();
+
+private slots:
+  void on_exportButton_clicked();
+  void on_refreshTimer_timeout();
+};
+}
+
+#endif
@@ -28,10 +28,9 @@
 
 #include <QtCore/QMetaType>
 #include <optional>
-#include <regex>
 #include <string>
-#include <variant>
 
+#include "gui/qt/content_matcher.h"
 #include "gui/state/game/detection/game_install.h"
 
 namespace loot {
@@ -54,7 +53,7 @@ struct PluginFiltersState {
   bool showOnlyEmptyPlugins{false};
   std::optional<std::string> overlapPluginName;
   std::optional<std::string> groupName;
-  std::variant<std::monostate, std::string, std::regex> content;
+  std::optional<ContentMatcher> content;
 };
 }
 
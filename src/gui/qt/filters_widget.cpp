@@ -38,8 +38,8 @@ FiltersWidget::FiltersWidget(QWidget* parent) : QFrame(parent) { setupUi(); }
 
 void FiltersWidget::setGameId(const GameId newGameId) { gameId = newGameId; }
 
-void FiltersWidget::setPlugins(const std::vector<std::string>& pluginNames) {
-  setComboBoxItems(overlapFilter, pluginNames);
+void FiltersWidget::setPluginNamesModel(QAbstractItemModel* pluginNamesModel) {
+  overlapFilterModel->addSourceModel(pluginNamesModel);
 }
 
 void FiltersWidget::setGroups(const std::vector<std::string>& groupNames) {
@@ -63,6 +63,11 @@ void FiltersWidget::resetOverlapAndGroupsFilters() {
   emit pluginFilterChanged(getPluginFiltersState());
 }
 
+void FiltersWidget::setOverlapFilterEnabled(bool enabled) {
+  overlapFilterLabel->setEnabled(enabled);
+  overlapFilter->setEnabled(enabled);
+}
+
 void FiltersWidget::setFilterStates(const LootSettings::Filters& filters) {
   bool hasContentFilterChanged{false};
   bool hasPluginFilterChanged{false};
@@ -155,10 +160,20 @@ LootSettings::Filters FiltersWidget::getFilterSettings() const {
   return filters;
 }
 
+void FiltersWidget::showContentFilterTimedOutTooltip() {
+  showRegexTimedOutTooltip(*contentFilter);
+}
+
 void FiltersWidget::setupUi() {
   static constexpr int SPACER_WIDTH = 20;
   static constexpr int SPACER_HEIGHT = 40;
 
+  // The overlap filter's first item is its "no plugin selected" item, which
+  // is given its text by translateUi().
+  overlapFilterNoneModel->setStringList({QString()});
+  overlapFilterModel->addSourceModel(overlapFilterNoneModel);
+  overlapFilter->setModel(overlapFilterModel);
+
   overlapFilter->setObjectName("overlapFilter");
   groupPluginsFilter->setObjectName("groupPluginsFilter");
   contentFilter->setObjectName("contentFilter");
@@ -263,12 +278,8 @@ void FiltersWidget::translateUi() {
   hiddenPluginsLabel->setText(translate("Hidden plugins:"));
   hiddenMessagesLabel->setText(translate("Hidden messages:"));
 
-  const auto overlapItemText = translate("No plugin selected");
-  if (overlapFilter->count() == 0) {
-    overlapFilter->addItem(overlapItemText);
-  } else {
-    overlapFilter->setItemText(0, overlapItemText);
-  }
+  overlapFilterNoneModel->setData(overlapFilterNoneModel->index(0),
+                                  translate("No plugin selected"));
 
   auto groupsItemText = translate("No group selected");
   if (groupPluginsFilter->count() == 0) {
@@ -353,21 +364,24 @@ PluginFiltersState FiltersWidget::getPluginFiltersState() const {
   }
 
   if (!contentFilter->text().isEmpty()) {
-    auto contentFilterText = contentFilter->text().toStdString();
+    const auto contentFilterText = contentFilter->text();
     if (contentRegexCheckbox->isChecked()) {
-      try {
-        filters.content = std::regex(
-            contentFilterText, std::regex::ECMAScript | std::regex::icase);
-      } catch (const std::exception& e) {
+      const auto matcher = ContentMatcher(QRegularExpression(
+          contentFilterText, QRegularExpression::CaseInsensitiveOption));
+
+      if (matcher.isValid()) {
+        filters.content = matcher;
+      } else {
+        const auto errorString = matcher.errorString().toStdString();
         auto logger = getLogger();
         if (logger) {
-          logger->error("Invalid content filter regex: {}", e.what());
+          logger->error("Invalid content filter regex: {}", errorString);
         }
 
-        showInvalidRegexTooltip(*contentFilter, e.what());
+        showInvalidRegexTooltip(*contentFilter, errorString);
       }
     } else {
-      filters.content = contentFilterText;
+      filters.content = ContentMatcher(contentFilterText);
     }
   }
 
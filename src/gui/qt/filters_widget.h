@@ -26,6 +26,8 @@
 #ifndef LOOT_GUI_QT_FILTERS_WIDGET
 #define LOOT_GUI_QT_FILTERS_WIDGET
 
+#include <QtCore/QConcatenateTablesProxyModel>
+#include <QtCore/QStringListModel>
 #include <QtWidgets/QCheckBox>
 #include <QtWidgets/QComboBox>
 #include <QtWidgets/QFrame>
@@ -43,7 +45,9 @@ public:
   explicit FiltersWidget(QWidget *parent);
 
   void setGameId(const GameId gameId);
-  void setPlugins(const std::vector<std::string> &pluginNames);
+  // The model's rows are listed in the overlap filter after its "no plugin
+  // selected" item, and views of it are updated incrementally as it changes.
+  void setPluginNamesModel(QAbstractItemModel *pluginNamesModel);
   void setGroups(const std::vector<std::string> &groupNames);
 
   void setMessageCounts(size_t hidden, size_t total);
@@ -51,12 +55,18 @@ public:
 
   void resetOverlapAndGroupsFilters();
 
+  // Overlap filtering needs to query the game's plugins, so it can only be
+  // used once they have been loaded.
+  void setOverlapFilterEnabled(bool enabled);
+
   void setFilterStates(const LootSettings::Filters &filters);
   LootSettings::Filters getFilterSettings() const;
 
   PluginFiltersState getPluginFiltersState() const;
   CardContentFiltersState getCardContentFiltersState() const;
 
+  void showContentFilterTimedOutTooltip();
+
 signals:
   void pluginFilterChanged(PluginFiltersState state);
   void overlapFilterChanged(std::optional<std::string> targetPluginName);
@@ -65,6 +75,9 @@ signals:
 private:
   QLabel *overlapFilterLabel{new QLabel(this)};
   QComboBox *overlapFilter{new QComboBox(this)};
+  QStringListModel *overlapFilterNoneModel{new QStringListModel(this)};
+  QConcatenateTablesProxyModel *overlapFilterModel{
+      new QConcatenateTablesProxyModel(this)};
   QLabel *groupPluginsFilterLabel{new QLabel(this)};
   QComboBox *groupPluginsFilter{new QComboBox(this)};
   QLabel *contentFilterLabel{new QLabel(this)};
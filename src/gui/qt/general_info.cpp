@@ -26,6 +26,8 @@
 #include "gui/qt/general_info.h"
 
 #include "gui/helpers.h"
+#include "gui/state/game/game_settings.h"
+#include "gui/state/loot_state.h"
 
 namespace loot {
 std::string GeneralInformation::getMarkdownContent() const {
@@ -49,4 +51,33 @@ std::string GeneralInformation::getMarkdownContent() const {
 
   return content;
 }
+
+std::vector<SourcedMessage> getGeneralMessages(const LootState& state) {
+  auto messages = state.getInitMessages();
+  const auto gameMessages =
+      state.GetCurrentGame().GetMessages(state.getSettings().getLanguage());
+  messages.insert(messages.end(), gameMessages.begin(), gameMessages.end());
+
+  return messages;
+}
+
+GeneralInformation getGeneralInformation(const LootState& state) {
+  GeneralInformation generalInformation;
+  generalInformation.preludeRevision = getFileRevisionSummary(
+      state.getPreludePath(), FileType::MasterlistPrelude);
+
+  if (!state.HasCurrentGame()) {
+    generalInformation.generalMessages = state.getInitMessages();
+    return generalInformation;
+  }
+
+  const auto& game = state.GetCurrentGame();
+  generalInformation.gameSupportsLightPlugins =
+      SupportsLightPlugins(game.GetSettings().Type());
+  generalInformation.masterlistRevision =
+      getFileRevisionSummary(game.MasterlistPath(), FileType::Masterlist);
+  generalInformation.generalMessages = getGeneralMessages(state);
+
+  return generalInformation;
+}
 }
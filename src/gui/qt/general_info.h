@@ -41,6 +41,14 @@ struct GeneralInformation {
 
   std::string getMarkdownContent() const;
 };
+
+class LootState;
+
+std::vector<SourcedMessage> getGeneralMessages(const LootState& state);
+
+// This involves hashing the masterlist and prelude files and checking for
+// game files, so avoid calling it on the GUI thread.
+GeneralInformation getGeneralInformation(const LootState& state);
 }
 
 Q_DECLARE_METATYPE(loot::GeneralInformation);
@@ -70,17 +70,74 @@ std::map<std::string, QPointF> convertNodePositions(
   return map;
 }
 
-void setNodePositions(const std::vector<Node *> &nodes,
-                      const std::map<std::string, QPointF> &savedPositions) {
+GroupGraph getGroupGraph(const std::vector<Node *> &nodes) {
+  std::map<const Node *, size_t> nodeIndices;
+  for (size_t i = 0; i < nodes.size(); i += 1) {
+    nodeIndices.emplace(nodes.at(i), i);
+  }
+
+  GroupGraph graph;
   for (const auto node : nodes) {
-    const auto name = node->getName().toStdString();
-    const auto positionIt = savedPositions.find(name);
-
-    if (positionIt == savedPositions.end()) {
-      throw std::runtime_error(
-          "Failed to set node positions, could not find position for " + name);
-    } else {
-      node->setPosition(positionIt->second);
+    const auto boundingRect =
+        node->boundingRect().marginsRemoved(Node::MARGINS);
+
+    GroupGraphNode graphNode{node->getName().toStdString(),
+                             boundingRect.width(),
+                             boundingRect.height(),
+                             {}};
+
+    for (const auto outEdge : node->outEdges()) {
+      const auto it = nodeIndices.find(outEdge->destNode());
+      if (it == nodeIndices.end()) {
+        throw std::logic_error("Node is not in graph");
+      }
+
+      graphNode.outNodes.push_back(it->second);
+    }
+
+    graph.push_back(graphNode);
+  }
+
+  return graph;
+}
+
+// Gives positions to the nodes that don't have one in the given positions,
+// unless too few of the graph's nodes have positions for that to give a good
+// layout.
+std::optional<std::map<std::string, QPointF>> placeMissingNodes(
+    const GroupGraph &graph,
+    std::map<std::string, QPointF> &&positions) {
+  size_t positionedNodesCount = 0;
+  for (const auto &node : graph) {
+    if (positions.count(node.name) > 0) {
+      positionedNodesCount += 1;
+    }
+  }
+
+  // Placing nodes incrementally doesn't give a good layout if most of the
+  // graph is new.
+  if (positionedNodesCount * 2 < graph.size()) {
+    return std::nullopt;
+  }
+
+  return placeNewNodes(graph, std::move(positions));
+}
+
+void saveLayoutCache(const std::filesystem::path &cachePath,
+                     uint64_t graphHash,
+                     const std::map<std::string, QPointF> &positions) {
+  GroupLayoutCache cache{graphHash, {}};
+  for (const auto &[name, position] : positions) {
+    cache.positions.push_back(
+        GroupNodePosition{name, position.x(), position.y()});
+  }
+
+  try {
+    SaveGroupLayoutCache(cachePath, cache);
+  } catch (const std::exception &e) {
+    const auto logger = getLogger();
+    if (logger) {
+      logger->warn("Failed to cache graph layout: {}", e.what());
     }
   }
 }
@@ -106,12 +163,28 @@ GraphView::GraphView(QWidget *parent) :
   setTransformationAnchor(AnchorUnderMouse);
   scale(INITIAL_SCALING_FACTOR, INITIAL_SCALING_FACTOR);
   setMinimumSize(MIN_VIEW_SIZE, MIN_VIEW_SIZE);
+
+  layoutWorker->moveToThread(&layoutThread);
+  connect(
+      &layoutThread, &QThread::finished, layoutWorker, &QObject::deleteLater);
+
+  layoutThread.setObjectName("layoutThread");
+  layoutThread.start();
+}
+
+GraphView::~GraphView() {
+  // Discard the result of any layout in progress, and wait for it to finish.
+  layoutGeneration += 1;
+
+  layoutThread.quit();
+  layoutThread.wait();
 }
 
 void GraphView::setGroups(const std::vector<Group> &masterlistGroups,
                           const std::vector<Group> &userGroups,
                           const std::set<std::string> &installedPluginGroups,
-                          const std::vector<GroupNodePosition> &nodePositions) {
+                          const std::vector<GroupNodePosition> &nodePositions,
+                          const std::filesystem::path &layoutCachePath) {
   // Remove all existing items.
   scene()->clear();
   hasUnsavedLayoutChanges_ = false;
@@ -161,7 +234,8 @@ void GraphView::setGroups(const std::vector<Group> &masterlistGroups,
   }
 
   // Now position the new nodes.
-  doLayout(nodePositions);
+  this->layoutCachePath = layoutCachePath;
+  doLayout(nodePositions, true);
 }
 
 bool GraphView::addGroup(const std::string &name) {
@@ -216,7 +290,7 @@ void GraphView::setGroupContainsInstalledPlugins(
 }
 
 void GraphView::autoLayout() {
-  doLayout({});
+  doLayout({}, false);
 
   // Reset unsaved change tracker because all user customisations have been
   // removed (while the auto layout results can vary, they're all pretty
@@ -224,7 +298,13 @@ void GraphView::autoLayout() {
   hasUnsavedLayoutChanges_ = false;
 }
 
-void GraphView::registerUserLayoutChange() { hasUnsavedLayoutChanges_ = true; }
+void GraphView::registerUserLayoutChange() {
+  hasUnsavedLayoutChanges_ = true;
+
+  // Don't let a layout that is still being calculated override the user's
+  // changes.
+  layoutGeneration += 1;
+}
 
 std::vector<Group> GraphView::getUserGroups() const {
   std::vector<Group> userGroups;
@@ -330,7 +410,7 @@ void GraphView::wheelEvent(QWheelEvent *event) {
 }
 #endif
 
-void GraphView::doLayout(const std::vector<GroupNodePosition> &nodePositions) {
+std::vector<Node *> GraphView::getNodes() const {
   std::vector<Node *> nodes;
   for (const auto item : scene()->items()) {
     auto node = qgraphicsitem_cast<Node *>(item);
@@ -339,23 +419,108 @@ void GraphView::doLayout(const std::vector<GroupNodePosition> &nodePositions) {
     }
   }
 
-  const auto logger = getLogger();
+  return nodes;
+}
 
-  if (!nodePositions.empty()) {
-    try {
-      const auto nodePositionsMap = convertNodePositions(nodePositions);
+void GraphView::setNodePositions(
+    const std::map<std::string, QPointF> &positions) {
+  for (const auto node : getNodes()) {
+    const auto it = positions.find(node->getName().toStdString());
+    if (it != positions.end()) {
+      node->setPosition(it->second);
+    }
+  }
+}
 
-      setNodePositions(nodes, nodePositionsMap);
+void GraphView::doLayout(const std::vector<GroupNodePosition> &nodePositions,
+                         bool allowIncrementalPlacement) {
+  // Discard the result of any layout that is still being calculated.
+  layoutGeneration += 1;
+  const uint64_t generation = layoutGeneration;
+
+  // Even placing new nodes incrementally can be slow for large graphs, so all
+  // layout work is done on the worker thread using a snapshot of the graph.
+  QMetaObject::invokeMethod(
+      layoutWorker,
+      [this,
+       generation,
+       graph = getGroupGraph(getNodes()),
+       positions = convertNodePositions(nodePositions),
+       allowIncrementalPlacement,
+       cachePath = layoutCachePath]() mutable {
+        if (layoutGeneration != generation) {
+          // Another layout has been requested since this one was.
+          return;
+        }
+
+        calculateLayout(generation,
+                        graph,
+                        std::move(positions),
+                        allowIncrementalPlacement,
+                        cachePath);
+      });
+}
+
+void GraphView::calculateLayout(
+    uint64_t generation,
+    const GroupGraph &graph,
+    std::map<std::string, QPointF> &&savedPositions,
+    bool allowIncrementalPlacement,
+    const std::filesystem::path &cachePath) {
+  const auto logger = getLogger();
 
+  if (!savedPositions.empty()) {
+    auto positions = placeMissingNodes(graph, std::move(savedPositions));
+    if (positions.has_value()) {
       if (logger) {
         logger->debug("Graph layout loaded from saved node positions");
       }
 
+      applyLayout(generation, std::move(positions.value()));
       return;
-    } catch (const std::exception &e) {
-      if (logger) {
-        logger->warn("Failed to set node positions from stored data: {}",
-                     e.what());
+    }
+
+    if (logger) {
+      logger->warn(
+          "Too few of the stored node positions match the current groups");
+    }
+  }
+
+  const auto graphHash = hashGroupGraph(graph);
+
+  std::optional<GroupLayoutCache> cache;
+  try {
+    cache = LoadGroupLayoutCache(cachePath);
+  } catch (const std::exception &e) {
+    if (logger) {
+      logger->warn("Failed to load cached graph layout: {}", e.what());
+    }
+  }
+
+  if (cache.has_value()) {
+    const auto isExactMatch = cache.value().graphHash == graphHash;
+
+    if (isExactMatch || allowIncrementalPlacement) {
+      auto positions = placeMissingNodes(
+          graph, convertNodePositions(cache.value().positions));
+
+      if (positions.has_value()) {
+        if (isExactMatch) {
+          if (logger) {
+            logger->debug("Graph layout loaded from cache");
+          }
+        } else {
+          if (logger) {
+            logger->debug(
+                "Graph layout loaded from cache, with new groups placed "
+                "incrementally");
+          }
+
+          saveLayoutCache(cachePath, graphHash, positions.value());
+        }
+
+        applyLayout(generation, std::move(positions.value()));
+        return;
       }
     }
   }
@@ -364,9 +529,42 @@ void GraphView::doLayout(const std::vector<GroupNodePosition> &nodePositions) {
     logger->debug("Calculating new graph layout");
   }
 
-  const auto calculatedNodePositions = calculateGraphLayout(nodes);
-  for (const auto &[node, position] : calculatedNodePositions) {
-    node->setPosition(position);
+  // Give the nodes provisional positions so that the graph can be displayed
+  // while the full layout is calculated.
+  applyLayout(generation, placeNewNodes(graph, {}));
+
+  if (layoutGeneration != generation) {
+    return;
   }
+
+  std::map<std::string, QPointF> positions;
+  try {
+    positions = calculateGraphLayout(graph);
+  } catch (const std::exception &e) {
+    if (logger) {
+      logger->error("Failed to calculate graph layout: {}", e.what());
+    }
+    return;
+  }
+
+  // Cache the layout even if it's no longer wanted, as it's still valid for
+  // the graph that it was calculated for.
+  saveLayoutCache(cachePath, graphHash, positions);
+
+  applyLayout(generation, std::move(positions));
+}
+
+void GraphView::applyLayout(uint64_t generation,
+                            std::map<std::string, QPointF> &&positions) {
+  QMetaObject::invokeMethod(
+      this, [this, generation, positions = std::move(positions)]() {
+        if (layoutGeneration != generation) {
+          return;
+        }
+
+        // Groups that were added or renamed since the layout was started
+        // aren't in the positions, so they keep their current positions.
+        setNodePositions(positions);
+      });
 }
 }
@@ -28,9 +28,13 @@
 
 #include <loot/metadata/group.h>
 
+#include <QtCore/QThread>
 #include <QtWidgets/QGraphicsView>
+#include <atomic>
+#include <filesystem>
 #include <set>
 
+#include "gui/qt/groups_editor/layout.h"
 #include "gui/state/game/group_node_positions.h"
 
 namespace loot {
@@ -45,11 +49,13 @@ class GraphView : public QGraphicsView {
 
 public:
   explicit GraphView(QWidget *parent = nullptr);
+  ~GraphView();
 
   void setGroups(const std::vector<Group> &masterlistGroups,
                  const std::vector<Group> &userGroups,
                  const std::set<std::string> &installedPluginGroups,
-                 const std::vector<GroupNodePosition> &nodePositions);
+                 const std::vector<GroupNodePosition> &nodePositions,
+                 const std::filesystem::path &layoutCachePath);
 
   bool addGroup(const std::string &name);
   void renameGroup(const std::string &oldName, const std::string &newName);
@@ -87,7 +93,26 @@ private:
   QColor backgroundColor;
   bool hasUnsavedLayoutChanges_{false};
 
-  void doLayout(const std::vector<GroupNodePosition> &nodePositions);
+  // Layouts are calculated on a worker thread. The generation is incremented
+  // to discard the result of any layout that is in progress.
+  std::filesystem::path layoutCachePath;
+  QThread layoutThread;
+  QObject *layoutWorker{new QObject()};
+  std::atomic<uint64_t> layoutGeneration{0};
+
+  std::vector<Node *> getNodes() const;
+  void setNodePositions(const std::map<std::string, QPointF> &positions);
+  void doLayout(const std::vector<GroupNodePosition> &nodePositions,
+                bool allowIncrementalPlacement);
+
+  // Called on the layout thread.
+  void calculateLayout(uint64_t generation,
+                       const GroupGraph &graph,
+                       std::map<std::string, QPointF> &&savedPositions,
+                       bool allowIncrementalPlacement,
+                       const std::filesystem::path &cachePath);
+  void applyLayout(uint64_t generation,
+                   std::map<std::string, QPointF> &&positions);
 };
 }
 
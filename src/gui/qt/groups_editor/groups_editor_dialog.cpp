@@ -66,11 +66,13 @@ std::map<std::string, std::pair<double, double>> positionsAsMap(
 }
 
 GroupsEditorDialog::GroupsEditorDialog(QWidget* parent,
-                                       PluginItemModel* pluginItemModel) :
+                                       PluginItemModel* pluginItemModel,
+                                       QAbstractItemModel* pluginNamesModel) :
     QDialog(
         parent,
         Qt::Dialog | Qt::WindowMinMaxButtonsHint | Qt::WindowCloseButtonHint),
-    pluginItemModel(pluginItemModel) {
+    pluginItemModel(pluginItemModel),
+    pluginNamesModel(pluginNamesModel) {
   setupUi();
 }
 
@@ -78,9 +80,13 @@ void GroupsEditorDialog::setGroups(
     const std::vector<Group>& masterlistGroups,
     const std::vector<Group>& userGroups,
     const std::set<std::string>& installedPluginGroups,
-    const std::vector<GroupNodePosition>& nodePositions) {
-  graphView->setGroups(
-      masterlistGroups, userGroups, installedPluginGroups, nodePositions);
+    const std::vector<GroupNodePosition>& nodePositions,
+    const std::filesystem::path& layoutCachePath) {
+  graphView->setGroups(masterlistGroups,
+                       userGroups,
+                       installedPluginGroups,
+                       nodePositions,
+                       layoutCachePath);
 
   // Reset UI elements.
   groupPluginsTitle->setVisible(false);
@@ -93,7 +99,7 @@ void GroupsEditorDialog::setGroups(
   initialUserGroups = userGroups;
   initialNodePositions = nodePositions;
   selectedGroupName = std::nullopt;
-  newPluginGroups.clear();
+  pluginGroups = PluginGroupsIndex(pluginItemModel->getPluginItems());
 }
 
 std::vector<Group> loot::GroupsEditorDialog::getUserGroups() const {
@@ -106,7 +112,7 @@ std::vector<GroupNodePosition> GroupsEditorDialog::getNodePositions() const {
 
 std::unordered_map<std::string, std::string>
 GroupsEditorDialog::getNewPluginGroups() const {
-  return newPluginGroups;
+  return pluginGroups.getNewPluginGroups();
 }
 
 void GroupsEditorDialog::setupUi() {
@@ -118,14 +124,19 @@ void GroupsEditorDialog::setupUi() {
   groupPluginsTitle->setVisible(false);
 
   groupPluginsList->setObjectName("groupPluginsList");
+  groupPluginsList->setModel(groupPluginsModel);
   groupPluginsList->setVisible(false);
+  groupPluginsList->setEditTriggers(QAbstractItemView::NoEditTriggers);
+  groupPluginsList->setUniformItemSizes(true);
   groupPluginsList->setSelectionMode(QAbstractItemView::NoSelection);
   groupPluginsList->setContextMenuPolicy(Qt::CustomContextMenu);
 
   auto verticalSpacer = new QSpacerItem(
       SPACER_WIDTH, 0, QSizePolicy::Minimum, QSizePolicy::Expanding);
 
-  auto completer = new QCompleter(pluginComboBox->model(), this);
+  pluginComboBox->setModel(pluginNamesModel);
+
+  auto completer = new QCompleter(pluginNamesModel, this);
   completer->setCompletionMode(QCompleter::PopupCompletion);
   completer->setCaseSensitivity(Qt::CaseInsensitive);
 
@@ -208,6 +219,8 @@ void GroupsEditorDialog::translateUi() {
   actionCopyPluginNames->setText(translate("&Copy Plugin Names"));
 
   addPluginButton->setText(translate("Add plugin to group"));
+  groupPluginsList->setPlaceholderText(
+      translate("No plugins are in this group."));
 
   groupNameInputLabel->setText(translate("Group name"));
   addGroupButton->setText(translate("Add a new group"));
@@ -238,7 +251,7 @@ bool GroupsEditorDialog::askShouldDiscardChanges() {
 
 bool GroupsEditorDialog::hasUnsavedChanges() {
   // Check if any plugins' groups have changed.
-  if (!newPluginGroups.empty()) {
+  if (!pluginGroups.getNewPluginGroups().empty()) {
     return true;
   }
 
@@ -283,75 +296,30 @@ void GroupsEditorDialog::refreshPluginLists() {
     return;
   }
 
-  groupPluginsList->clear();
-  pluginComboBox->clear();
-
-  const auto groupName = selectedGroupName.value();
-
-  for (const auto& plugin : pluginItemModel->getPluginItems()) {
-    const auto pluginGroup = getPluginGroup(plugin);
-
-    if (pluginGroup == groupName) {
-      groupPluginsList->addItem(QString::fromStdString(plugin.name));
-    } else {
-      // Add plugins that aren't in the current group to the combo box.
-      pluginComboBox->addItem(QString::fromStdString(plugin.name));
-    }
+  QStringList groupPluginNames;
+  for (const auto& pluginName :
+       pluginGroups.getGroupPluginNames(selectedGroupName.value())) {
+    groupPluginNames.append(QString::fromStdString(pluginName));
   }
 
-  if (groupPluginsList->count() == 0) {
-    auto text = translate("No plugins are in this group.");
-    auto item = new QListWidgetItem();
-
-    auto font = item->font();
-    font.setItalic(true);
-    item->setFont(font);
-    item->setText(text);
+  // The list displays a placeholder if the group is empty.
+  groupPluginsModel->setStringList(groupPluginNames);
 
-    groupPluginsList->addItem(item);
-  }
-
-  pluginComboBox->setEnabled(pluginComboBox->count() > 0);
-  addPluginButton->setEnabled(pluginComboBox->count() > 0);
+  pluginComboBox->setEnabled(!pluginGroups.empty());
+  refreshAddPluginButton();
 }
 
-const PluginItem* GroupsEditorDialog::getPluginItem(
-    const std::string& pluginName) const {
-  for (const auto& plugin : pluginItemModel->getPluginItems()) {
-    if (CompareFilenames(plugin.name, pluginName) == 0) {
-      return &plugin;
-    }
-  }
-
-  return nullptr;
-}
-
-const std::string GroupsEditorDialog::getPluginGroup(
-    const PluginItem& pluginItem) const {
-  auto newPluginGroupIt = newPluginGroups.find(pluginItem.name);
-
-  return newPluginGroupIt == newPluginGroups.end()
-             ? pluginItem.group.value_or(Group::DEFAULT_NAME)
-             : newPluginGroupIt->second;
-}
-
-bool GroupsEditorDialog::containsMoreThanOnePlugin(
-    const std::string& groupName) const {
-  size_t pluginsCount = 0;
-
-  for (const auto& plugin : pluginItemModel->getPluginItems()) {
-    const auto pluginGroup = getPluginGroup(plugin);
-
-    if (pluginGroup == groupName) {
-      if (pluginsCount == 1) {
-        return true;
-      }
+void GroupsEditorDialog::refreshAddPluginButton() {
+  const auto pluginIndex =
+      pluginGroups.getPluginIndex(pluginComboBox->currentText().toStdString());
 
-      pluginsCount += 1;
-    }
-  }
+  // Plugins that are already in the selected group can't be added to it.
+  const auto enableAddPluginButton =
+      selectedGroupName.has_value() && pluginIndex.has_value() &&
+      pluginGroups.getPluginGroup(pluginIndex.value()) !=
+          selectedGroupName.value();
 
-  return false;
+  addPluginButton->setEnabled(enableAddPluginButton);
 }
 
 void GroupsEditorDialog::handleException(const std::exception& exception) {
@@ -372,21 +340,15 @@ void GroupsEditorDialog::handleException(const std::exception& exception) {
 
 void GroupsEditorDialog::on_actionCopyPluginNames_triggered() {
   try {
-    if (!selectedGroupName.has_value() || groupPluginsList->count() == 0) {
-      return;
-    }
-
-    if (groupPluginsList->count() == 1 &&
-        groupPluginsList->item(0)->font().italic()) {
-      // Copy an empty string because the group is empty.
-      CopyToClipboard("");
+    if (!selectedGroupName.has_value()) {
       return;
     }
 
+    // If the group is empty, an empty string is copied.
     std::string selectedPluginNames;
-    for (int i = 0; i < groupPluginsList->count(); i += 1) {
-      const auto item = groupPluginsList->item(i);
-      selectedPluginNames += item->text().toStdString() + "\n";
+    for (const auto& pluginName :
+         pluginGroups.getGroupPluginNames(selectedGroupName.value())) {
+      selectedPluginNames += pluginName + "\n";
     }
 
     CopyToClipboard(selectedPluginNames);
@@ -441,12 +403,8 @@ void GroupsEditorDialog::on_groupPluginsList_customContextMenuRequested(
   menuPluginsList->exec(groupPluginsList->mapToGlobal(position));
 }
 
-void GroupsEditorDialog::on_pluginComboBox_editTextChanged(
-    const QString& text) {
-  const auto enableAddPluginButton =
-      getPluginItem(text.toStdString()) != nullptr;
-
-  addPluginButton->setEnabled(enableAddPluginButton);
+void GroupsEditorDialog::on_pluginComboBox_editTextChanged(const QString&) {
+  refreshAddPluginButton();
 }
 
 void GroupsEditorDialog::on_groupNameInput_textChanged(const QString& text) {
@@ -470,30 +428,25 @@ void GroupsEditorDialog::on_addPluginButton_clicked() {
   const auto pluginName = pluginComboBox->currentText().toStdString();
   const auto groupName = selectedGroupName.value();
 
-  // Get the plugin's item.
-  const auto pluginItem = getPluginItem(pluginName);
-  if (!pluginItem) {
+  const auto pluginIndex = pluginGroups.getPluginIndex(pluginName);
+  if (!pluginIndex.has_value()) {
     // Shouldn't be possible.
     return;
   }
 
   // Get the plugin's current group.
-  const auto currentPluginGroup = getPluginGroup(*pluginItem);
+  const auto currentPluginGroup =
+      pluginGroups.getPluginGroup(pluginIndex.value());
+  if (currentPluginGroup == groupName) {
+    // Shouldn't be possible.
+    return;
+  }
 
   // Count how many plugins are in the current group.
   const auto containsOtherPlugins =
-      containsMoreThanOnePlugin(currentPluginGroup);
-
-  // Check the group against the plugin's saved group and just remove
-  // the plugin from the map if the two are equal, to prevent moving a
-  // plugin to a new group and back again from being treated as an unsaved
-  // change.
-  if (pluginItem->group == groupName) {
-    newPluginGroups.erase(pluginName);
-  } else {
-    // Store the plugin's new group.
-    newPluginGroups.insert_or_assign(pluginName, groupName);
-  }
+      pluginGroups.containsMoreThanOnePlugin(currentPluginGroup);
+
+  pluginGroups.setPluginGroup(pluginIndex.value(), groupName);
 
   // Refresh the group's plugin list.
   refreshPluginLists();
@@ -543,13 +496,7 @@ void GroupsEditorDialog::on_renameGroupButton_clicked() {
   graphView->renameGroup(oldName, newName);
 
   // Update plugin groups (step 3).
-  for (const auto& plugin : pluginItemModel->getPluginItems()) {
-    const auto pluginGroup = getPluginGroup(plugin);
-
-    if (pluginGroup == oldName) {
-      newPluginGroups.insert_or_assign(plugin.name, newName);
-    }
-  }
+  pluginGroups.renameGroup(oldName, newName);
 
   // Update the stored selected group name.
   selectedGroupName = newName;
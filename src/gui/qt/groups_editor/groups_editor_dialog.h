@@ -26,30 +26,37 @@
 #ifndef LOOT_GUI_QT_GROUPS_EDITOR_GROUPS_EDITOR_DIALOG
 #define LOOT_GUI_QT_GROUPS_EDITOR_GROUPS_EDITOR_DIALOG
 
+#include <QtCore/QStringListModel>
 #include <QtGui/QCloseEvent>
 #include <QtWidgets/QComboBox>
 #include <QtWidgets/QDialog>
 #include <QtWidgets/QLabel>
 #include <QtWidgets/QLineEdit>
-#include <QtWidgets/QListWidget>
 #include <QtWidgets/QMenu>
 #include <QtWidgets/QPushButton>
 #include <QtWidgets/QWidget>
 #include <set>
+#include <unordered_map>
 
 #include "gui/qt/groups_editor/graph_view.h"
+#include "gui/qt/groups_editor/placeholder_list_view.h"
+#include "gui/qt/groups_editor/plugin_groups_index.h"
 #include "gui/qt/plugin_item_model.h"
 
 namespace loot {
 class GroupsEditorDialog : public QDialog {
   Q_OBJECT
 public:
-  GroupsEditorDialog(QWidget *parent, PluginItemModel *pluginItemModel);
+  // The plugin names model is shared, so it isn't owned by the dialog.
+  GroupsEditorDialog(QWidget *parent,
+                     PluginItemModel *pluginItemModel,
+                     QAbstractItemModel *pluginNamesModel);
 
   void setGroups(const std::vector<Group> &masterlistGroups,
                  const std::vector<Group> &userGroups,
                  const std::set<std::string> &installedPluginGroups,
-                 const std::vector<GroupNodePosition> &nodePositions);
+                 const std::vector<GroupNodePosition> &nodePositions,
+                 const std::filesystem::path &layoutCachePath);
 
   std::vector<Group> getUserGroups() const;
   std::vector<GroupNodePosition> getNodePositions() const;
@@ -59,7 +66,8 @@ private:
   GraphView *graphView{new GraphView(this)};
 
   QLabel *groupPluginsTitle{new QLabel(this)};
-  QListWidget *groupPluginsList{new QListWidget(this)};
+  PlaceholderListView *groupPluginsList{new PlaceholderListView(this)};
+  QStringListModel *groupPluginsModel{new QStringListModel(this)};
 
   QComboBox *pluginComboBox{new QComboBox(this)};
   QPushButton *addPluginButton{new QPushButton(this)};
@@ -75,11 +83,12 @@ private:
   QMenu *menuPluginsList{new QMenu(this)};
 
   PluginItemModel *pluginItemModel{nullptr};
+  QAbstractItemModel *pluginNamesModel{nullptr};
 
   std::vector<Group> initialUserGroups;
   std::vector<GroupNodePosition> initialNodePositions;
   std::optional<std::string> selectedGroupName;
-  std::unordered_map<std::string, std::string> newPluginGroups;
+  PluginGroupsIndex pluginGroups;
 
   void setupUi();
   void translateUi();
@@ -90,9 +99,7 @@ private:
   bool hasUnsavedChanges();
 
   void refreshPluginLists();
-  const PluginItem *getPluginItem(const std::string &pluginName) const;
-  const std::string getPluginGroup(const PluginItem &pluginItem) const;
-  bool containsMoreThanOnePlugin(const std::string &groupName) const;
+  void refreshAddPluginButton();
 
   void handleException(const std::exception &exception);
 
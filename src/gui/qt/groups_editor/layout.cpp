@@ -31,13 +31,113 @@
 #include <ogdf/layered/OptimalRanking.h>
 #include <ogdf/layered/SugiyamaLayout.h>
 
-#include "gui/qt/groups_editor/edge.h"
+#include <QtCore/QRectF>
+#include <algorithm>
+#include <cmath>
 
 namespace loot {
 constexpr double LAYER_SPACING = 30.0;
 
-std::map<Node *, QPointF> calculateGraphLayout(
-    const std::vector<Node *> &nodes) {
+// FNV-1a, used because its output is stable across runs and platforms, unlike
+// std::hash.
+class GraphHasher {
+public:
+  void add(const std::string& value) {
+    for (const auto character : value) {
+      addByte(static_cast<uint8_t>(character));
+    }
+
+    // Terminate the value so that adjacent values can't run together.
+    addByte(0);
+  }
+
+  void add(int64_t value) {
+    for (size_t i = 0; i < sizeof value; i += 1) {
+      addByte(static_cast<uint8_t>(value >> (i * 8)));
+    }
+  }
+
+  uint64_t get() const { return hash; }
+
+private:
+  static constexpr uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325;
+  static constexpr uint64_t FNV_PRIME = 0x100000001B3;
+
+  uint64_t hash{FNV_OFFSET_BASIS};
+
+  void addByte(uint8_t byte) {
+    hash ^= byte;
+    hash *= FNV_PRIME;
+  }
+};
+
+QRectF getNodeRect(const GroupGraphNode& node, const QPointF& position) {
+  return QRectF(position.x() - node.width / 2,
+                position.y() - node.height / 2,
+                node.width,
+                node.height);
+}
+
+bool overlapsPositionedNode(const GroupGraph& graph,
+                            const std::map<std::string, QPointF>& positions,
+                            const QRectF& rect) {
+  for (const auto& node : graph) {
+    const auto it = positions.find(node.name);
+    if (it != positions.end() &&
+        getNodeRect(node, it->second).intersects(rect)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+QPointF findFreePosition(const GroupGraph& graph,
+                         const std::map<std::string, QPointF>& positions,
+                         const GroupGraphNode& node,
+                         QPointF position) {
+  while (overlapsPositionedNode(
+      graph, positions, getNodeRect(node, position))) {
+    position.setY(position.y() + NODE_SPACING);
+  }
+
+  return position;
+}
+
+uint64_t hashGroupGraph(const GroupGraph& graph) {
+  std::vector<size_t> order(graph.size());
+  for (size_t i = 0; i < order.size(); i += 1) {
+    order[i] = i;
+  }
+
+  std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+    return graph.at(lhs).name < graph.at(rhs).name;
+  });
+
+  GraphHasher hasher;
+  for (const auto index : order) {
+    const auto& node = graph.at(index);
+
+    hasher.add(node.name);
+    hasher.add(static_cast<int64_t>(std::lround(node.width)));
+    hasher.add(static_cast<int64_t>(std::lround(node.height)));
+
+    std::vector<std::string> outNodeNames;
+    for (const auto outNode : node.outNodes) {
+      outNodeNames.push_back(graph.at(outNode).name);
+    }
+    std::sort(outNodeNames.begin(), outNodeNames.end());
+
+    hasher.add(static_cast<int64_t>(outNodeNames.size()));
+    for (const auto& name : outNodeNames) {
+      hasher.add(name);
+    }
+  }
+
+  return hasher.get();
+}
+
+std::map<std::string, QPointF> calculateGraphLayout(const GroupGraph& nodes) {
   ogdf::Graph graph;
   ogdf::GraphAttributes graphAttributes(
       graph,
@@ -50,38 +150,29 @@ std::map<Node *, QPointF> calculateGraphLayout(
   graphAttributes.directed() = true;
 
   // Add all nodes to the graph.
-  std::map<Node *, ogdf::node> graphNodes;
-  std::map<ogdf::node, Node *> sceneNodes;
-  for (const auto node : nodes) {
+  std::vector<ogdf::node> graphNodes;
+  std::map<ogdf::node, std::string> nodeNames;
+  for (const auto& node : nodes) {
     const auto graphNode = graph.newNode();
-    const auto boundingRect =
-        node->boundingRect().marginsRemoved(Node::MARGINS);
 
     // The height and width are transposed because the layout algorithm
     // arranges layers vertically, and the result is then rotated to get a
     // horizonal layout.
-    graphAttributes.width(graphNode) = boundingRect.height();
-    graphAttributes.height(graphNode) = boundingRect.width();
+    graphAttributes.width(graphNode) = node.height;
+    graphAttributes.height(graphNode) = node.width;
 
-    graphNodes.emplace(node, graphNode);
-    sceneNodes.emplace(graphNode, node);
+    graphNodes.push_back(graphNode);
+    nodeNames.emplace(graphNode, node.name);
   }
 
-  // Now add all edges to the graph, without having to worry if the nodes
-  // already exist or not.
-  for (const auto node : nodes) {
-    const auto fromGraphNode = graphNodes.find(node);
-    if (fromGraphNode == graphNodes.end()) {
-      throw std::logic_error("Node is not in graph");
-    }
-
-    for (const auto outEdge : node->outEdges()) {
-      const auto toGraphNode = graphNodes.find(outEdge->destNode());
-      if (toGraphNode == graphNodes.end()) {
+  // Now add all edges to the graph.
+  for (size_t i = 0; i < nodes.size(); i += 1) {
+    for (const auto outNode : nodes.at(i).outNodes) {
+      if (outNode >= graphNodes.size()) {
         throw std::logic_error("Node is not in graph");
       }
 
-      graph.newEdge(fromGraphNode->second, toGraphNode->second);
+      graph.newEdge(graphNodes.at(i), graphNodes.at(outNode));
     }
   }
 
@@ -99,19 +190,124 @@ std::map<Node *, QPointF> calculateGraphLayout(
   // Now rotate the layout to get a layers arranged horizontally.
   graphAttributes.rotateLeft90();
 
-  std::map<Node *, QPointF> nodePositions;
+  std::map<std::string, QPointF> nodePositions;
 
   for (const auto node : graph.nodes) {
     QPointF position(graphAttributes.x(node), graphAttributes.y(node));
 
-    const auto sceneNode = sceneNodes.find(node);
-    if (sceneNode == sceneNodes.end()) {
+    const auto nodeName = nodeNames.find(node);
+    if (nodeName == nodeNames.end()) {
       throw std::logic_error("Node is not in scene");
     }
 
-    nodePositions.emplace(sceneNode->second, position);
+    nodePositions.emplace(nodeName->second, position);
   }
 
   return nodePositions;
 }
+
+std::map<std::string, QPointF> placeNewNodes(
+    const GroupGraph& graph,
+    std::map<std::string, QPointF> positions) {
+  std::vector<std::vector<size_t>> inNodes(graph.size());
+  for (size_t i = 0; i < graph.size(); i += 1) {
+    for (const auto outNode : graph.at(i).outNodes) {
+      inNodes.at(outNode).push_back(i);
+    }
+  }
+
+  // Use the average offset between the positioned ends of existing edges as
+  // the offset between a new node and its neighbours, so that new nodes fit
+  // into whatever direction and spacing the existing layout uses.
+  qreal layerOffsetSum = 0;
+  size_t layerOffsetCount = 0;
+  for (const auto& node : graph) {
+    const auto from = positions.find(node.name);
+    if (from == positions.end()) {
+      continue;
+    }
+
+    for (const auto outNode : node.outNodes) {
+      const auto to = positions.find(graph.at(outNode).name);
+      if (to != positions.end()) {
+        layerOffsetSum += to->second.x() - from->second.x();
+        layerOffsetCount += 1;
+      }
+    }
+  }
+
+  auto layerOffset = layerOffsetCount == 0
+                         ? NODE_SPACING
+                         : layerOffsetSum / layerOffsetCount;
+  if (std::abs(layerOffset) < NODE_SPACING / 2) {
+    layerOffset = std::copysign(NODE_SPACING, layerOffset);
+  }
+
+  std::vector<size_t> unplacedNodes;
+  for (size_t i = 0; i < graph.size(); i += 1) {
+    if (positions.count(graph.at(i).name) == 0) {
+      unplacedNodes.push_back(i);
+    }
+  }
+
+  while (!unplacedNodes.empty()) {
+    std::vector<size_t> stillUnplacedNodes;
+
+    for (const auto index : unplacedNodes) {
+      const auto& node = graph.at(index);
+
+      QPointF positionSum;
+      size_t neighbourCount = 0;
+      for (const auto inNode : inNodes.at(index)) {
+        const auto it = positions.find(graph.at(inNode).name);
+        if (it != positions.end()) {
+          positionSum += it->second + QPointF(layerOffset, 0);
+          neighbourCount += 1;
+        }
+      }
+
+      for (const auto outNode : node.outNodes) {
+        const auto it = positions.find(graph.at(outNode).name);
+        if (it != positions.end()) {
+          positionSum += it->second - QPointF(layerOffset, 0);
+          neighbourCount += 1;
+        }
+      }
+
+      if (neighbourCount == 0) {
+        stillUnplacedNodes.push_back(index);
+        continue;
+      }
+
+      const auto position = findFreePosition(
+          graph, positions, node, positionSum / neighbourCount);
+      positions.emplace(node.name, position);
+    }
+
+    if (stillUnplacedNodes.size() == unplacedNodes.size()) {
+      // None of the remaining nodes are connected to a positioned node, so
+      // start a new cluster below everything that has been positioned.
+      QPointF position;
+      if (!positions.empty()) {
+        auto minX = positions.begin()->second.x();
+        auto maxY = positions.begin()->second.y();
+        for (const auto& [name, nodePosition] : positions) {
+          minX = std::min(minX, nodePosition.x());
+          maxY = std::max(maxY, nodePosition.y());
+        }
+        position = QPointF(minX, maxY + NODE_SPACING);
+      }
+
+      const auto& node = graph.at(stillUnplacedNodes.front());
+      positions.emplace(node.name,
+                        findFreePosition(graph, positions, node, position));
+
+      stillUnplacedNodes.erase(stillUnplacedNodes.begin());
+    }
+
+    unplacedNodes = std::move(stillUnplacedNodes);
+  }
+
+  return positions;
+}
 }
@@ -27,15 +27,37 @@
 #define LOOT_GUI_QT_GROUPS_EDITOR_LAYOUT
 
 #include <QtCore/QPoint>
+#include <cstdint>
 #include <map>
+#include <string>
 #include <vector>
 
-#include "gui/qt/groups_editor/node.h"
-
 namespace loot {
 constexpr qreal NODE_SPACING = 70;
 
-std::map<Node*, QPointF> calculateGraphLayout(const std::vector<Node*>& nodes);
+// A snapshot of the groups graph that holds everything needed to lay it out,
+// so that the layout can be calculated away from the scene's nodes.
+struct GroupGraphNode {
+  std::string name;
+  qreal width{0};
+  qreal height{0};
+  std::vector<size_t> outNodes;
+};
+
+typedef std::vector<GroupGraphNode> GroupGraph;
+
+// Calculates a hash of the graph's nodes, their sizes and their edges that
+// doesn't depend on the order of the nodes.
+uint64_t hashGroupGraph(const GroupGraph& graph);
+
+std::map<std::string, QPointF> calculateGraphLayout(const GroupGraph& graph);
+
+// Gives positions to the nodes that don't have one in the given positions,
+// placing each next to its positioned neighbours and without moving any of the
+// nodes that are already positioned.
+std::map<std::string, QPointF> placeNewNodes(
+    const GroupGraph& graph,
+    std::map<std::string, QPointF> positions);
 }
 
 #endif
@@ -0,0 +1,61 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/groups_editor/placeholder_list_view.h"
+
+#include <QtGui/QPainter>
+#include <QtWidgets/QStyle>
+
+namespace loot {
+PlaceholderListView::PlaceholderListView(QWidget* parent) :
+    QListView(parent) {}
+
+void PlaceholderListView::setPlaceholderText(const QString& text) {
+  placeholderText = text;
+  viewport()->update();
+}
+
+void PlaceholderListView::paintEvent(QPaintEvent* event) {
+  QListView::paintEvent(event);
+
+  if (placeholderText.isEmpty() ||
+      (model() != nullptr && model()->rowCount(rootIndex()) > 0)) {
+    return;
+  }
+
+  QPainter painter(viewport());
+
+  auto font = painter.font();
+  font.setItalic(true);
+  painter.setFont(font);
+  painter.setPen(palette().color(QPalette::PlaceholderText));
+
+  // Line the text up with where the first item's text would be.
+  const auto margin = style()->pixelMetric(QStyle::PM_FocusFrameHMargin) + 1;
+  painter.drawText(viewport()->rect().adjusted(margin, 0, -margin, 0),
+                   Qt::AlignLeft | Qt::AlignTop | Qt::TextWordWrap,
+                   placeholderText);
+}
+}
@@ -0,0 +1,51 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_GROUPS_EDITOR_PLACEHOLDER_LIST_VIEW
+#define LOOT_GUI_QT_GROUPS_EDITOR_PLACEHOLDER_LIST_VIEW
+
+#include <QtGui/QPaintEvent>
+#include <QtWidgets/QListView>
+
+namespace loot {
+// A list view that displays placeholder text over its viewport when its model
+// has no rows, so that the placeholder isn't an item that can be interacted
+// with.
+class PlaceholderListView : public QListView {
+  Q_OBJECT
+public:
+  explicit PlaceholderListView(QWidget* parent);
+
+  void setPlaceholderText(const QString& text);
+
+protected:
+  void paintEvent(QPaintEvent* event) override;
+
+private:
+  QString placeholderText;
+};
+}
+
+#endif
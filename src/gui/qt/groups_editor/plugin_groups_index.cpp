@@ -0,0 +1,144 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/groups_editor/plugin_groups_index.h"
+
+#include <QtCore/QString>
+
+namespace loot {
+namespace {
+std::string foldCase(const std::string& pluginName) {
+  return QString::fromStdString(pluginName).toCaseFolded().toStdString();
+}
+}
+
+PluginGroupsIndex::PluginGroupsIndex(
+    const std::vector<PluginItem>& pluginItems) {
+  pluginNames.reserve(pluginItems.size());
+  savedPluginGroups.reserve(pluginItems.size());
+  pluginIndexes.reserve(pluginItems.size());
+
+  for (const auto& plugin : pluginItems) {
+    const auto pluginIndex = pluginNames.size();
+    const auto groupName = plugin.group.value_or(Group::DEFAULT_NAME);
+
+    pluginNames.push_back(plugin.name);
+    savedPluginGroups.push_back(groupName);
+    pluginIndexes.emplace(foldCase(plugin.name), pluginIndex);
+    groupPluginIndexes[groupName].insert(pluginIndex);
+  }
+}
+
+bool PluginGroupsIndex::empty() const { return pluginNames.empty(); }
+
+std::optional<size_t> PluginGroupsIndex::getPluginIndex(
+    const std::string& pluginName) const {
+  const auto it = pluginIndexes.find(foldCase(pluginName));
+  if (it == pluginIndexes.end()) {
+    return std::nullopt;
+  }
+
+  return it->second;
+}
+
+const std::string& PluginGroupsIndex::getPluginName(size_t pluginIndex) const {
+  return pluginNames.at(pluginIndex);
+}
+
+const std::string& PluginGroupsIndex::getPluginGroup(size_t pluginIndex) const {
+  auto newPluginGroupIt = newPluginGroups.find(pluginNames.at(pluginIndex));
+
+  return newPluginGroupIt == newPluginGroups.end()
+             ? savedPluginGroups.at(pluginIndex)
+             : newPluginGroupIt->second;
+}
+
+std::vector<std::string> PluginGroupsIndex::getGroupPluginNames(
+    const std::string& groupName) const {
+  std::vector<std::string> groupPluginNames;
+
+  const auto it = groupPluginIndexes.find(groupName);
+  if (it != groupPluginIndexes.end()) {
+    groupPluginNames.reserve(it->second.size());
+    for (const auto pluginIndex : it->second) {
+      groupPluginNames.push_back(pluginNames.at(pluginIndex));
+    }
+  }
+
+  return groupPluginNames;
+}
+
+bool PluginGroupsIndex::containsMoreThanOnePlugin(
+    const std::string& groupName) const {
+  const auto it = groupPluginIndexes.find(groupName);
+
+  return it != groupPluginIndexes.end() && it->second.size() > 1;
+}
+
+void PluginGroupsIndex::setPluginGroup(size_t pluginIndex,
+                                       const std::string& groupName) {
+  const auto currentGroupName = getPluginGroup(pluginIndex);
+
+  const auto it = groupPluginIndexes.find(currentGroupName);
+  if (it != groupPluginIndexes.end()) {
+    it->second.erase(pluginIndex);
+    if (it->second.empty()) {
+      groupPluginIndexes.erase(it);
+    }
+  }
+
+  groupPluginIndexes[groupName].insert(pluginIndex);
+
+  // Check the group against the plugin's saved group and just remove
+  // the plugin from the map if the two are equal, to prevent moving a
+  // plugin to a new group and back again from being treated as an unsaved
+  // change.
+  const auto& pluginName = pluginNames.at(pluginIndex);
+  if (savedPluginGroups.at(pluginIndex) == groupName) {
+    newPluginGroups.erase(pluginName);
+  } else {
+    newPluginGroups.insert_or_assign(pluginName, groupName);
+  }
+}
+
+void PluginGroupsIndex::renameGroup(const std::string& oldName,
+                                    const std::string& newName) {
+  const auto it = groupPluginIndexes.find(oldName);
+  if (it == groupPluginIndexes.end()) {
+    return;
+  }
+
+  // Copy the indexes, as setting plugin groups modifies the index.
+  const auto renamedPluginIndexes = it->second;
+  for (const auto pluginIndex : renamedPluginIndexes) {
+    setPluginGroup(pluginIndex, newName);
+  }
+}
+
+const std::unordered_map<std::string, std::string>&
+PluginGroupsIndex::getNewPluginGroups() const {
+  return newPluginGroups;
+}
+}
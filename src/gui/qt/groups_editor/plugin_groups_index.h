@@ -0,0 +1,82 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_GROUPS_EDITOR_PLUGIN_GROUPS_INDEX
+#define LOOT_GUI_QT_GROUPS_EDITOR_PLUGIN_GROUPS_INDEX
+
+#include <optional>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "gui/plugin_item.h"
+
+namespace loot {
+// Indexes the installed plugins by name and by group, taking the groups
+// editor's new plugin groups into account. The plugins are copied when the
+// index is created because the groups editor is modal, so they can't change
+// while it is open.
+class PluginGroupsIndex {
+public:
+  PluginGroupsIndex() = default;
+  explicit PluginGroupsIndex(const std::vector<PluginItem>& pluginItems);
+
+  bool empty() const;
+
+  std::optional<size_t> getPluginIndex(const std::string& pluginName) const;
+  const std::string& getPluginName(size_t pluginIndex) const;
+  const std::string& getPluginGroup(size_t pluginIndex) const;
+
+  // Returns the names of the plugins that are in the given group, in load
+  // order.
+  std::vector<std::string> getGroupPluginNames(
+      const std::string& groupName) const;
+  bool containsMoreThanOnePlugin(const std::string& groupName) const;
+
+  void setPluginGroup(size_t pluginIndex, const std::string& groupName);
+  // Moves all the plugins in the old group into the new group.
+  void renameGroup(const std::string& oldName, const std::string& newName);
+
+  // Plugins that have been moved back into their saved groups are not
+  // included.
+  const std::unordered_map<std::string, std::string>& getNewPluginGroups()
+      const;
+
+private:
+  // The installed plugins' names and saved groups, in load order.
+  std::vector<std::string> pluginNames;
+  std::vector<std::string> savedPluginGroups;
+  // Case-folded plugin names mapped to the plugins' indexes.
+  std::unordered_map<std::string, size_t> pluginIndexes;
+  // Group names mapped to the indexes of the plugins that are currently in
+  // them. The indexes are ordered so that each group's plugins are listed in
+  // load order.
+  std::unordered_map<std::string, std::set<size_t>> groupPluginIndexes;
+  std::unordered_map<std::string, std::string> newPluginGroups;
+};
+}
+
+#endif
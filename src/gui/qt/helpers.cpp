@@ -52,6 +52,8 @@ namespace loot {
 static constexpr const char* METADATA_PATH_SUFFIX = ".metadata.toml";
 static constexpr const char* METADATA_ID_KEY = "blob_sha1";
 static constexpr const char* METADATA_DATE_KEY = "update_timestamp";
+static constexpr const char* METADATA_ETAG_KEY = "etag";
+static constexpr const char* METADATA_LAST_MODIFIED_KEY = "last_modified";
 static constexpr int SHORT_HASH_LENGTH = 7;
 
 std::filesystem::path getFileMetadataPath(std::filesystem::path filePath) {
@@ -61,7 +63,8 @@ std::filesystem::path getFileMetadataPath(std::filesystem::path filePath) {
 
 void writeFileRevision(const std::filesystem::path& filePath,
                        const std::string& id,
-                       const std::string& date) {
+                       const std::string& date,
+                       const HttpCacheValidators& validators) {
   auto metadataPath = getFileMetadataPath(filePath);
 
   auto logger = getLogger();
@@ -72,8 +75,15 @@ void writeFileRevision(const std::filesystem::path& filePath,
                  date);
   }
 
-  const auto table =
-      toml::table{{METADATA_ID_KEY, id}, {METADATA_DATE_KEY, date}};
+  auto table = toml::table{{METADATA_ID_KEY, id}, {METADATA_DATE_KEY, date}};
+
+  if (validators.etag.has_value()) {
+    table.insert(METADATA_ETAG_KEY, validators.etag.value());
+  }
+
+  if (validators.lastModified.has_value()) {
+    table.insert(METADATA_LAST_MODIFIED_KEY, validators.lastModified.value());
+  }
 
   std::ofstream out(metadataPath);
   if (!out.is_open()) {
@@ -84,6 +94,15 @@ void writeFileRevision(const std::filesystem::path& filePath,
   out << table;
 }
 
+bool HttpCacheValidators::empty() const {
+  return !etag.has_value() && !lastModified.has_value();
+}
+
+bool operator==(const HttpCacheValidators& lhs,
+                const HttpCacheValidators& rhs) {
+  return lhs.etag == rhs.etag && lhs.lastModified == rhs.lastModified;
+}
+
 FileRevisionSummary::FileRevisionSummary(const FileRevision& fileRevision) :
     id(fileRevision.id.substr(0, SHORT_HASH_LENGTH)), date(fileRevision.date) {
   if (fileRevision.is_modified) {
@@ -183,6 +202,10 @@ FileRevision getFileRevision(const std::filesystem::path& filePath) {
 
   revision.is_modified = revision.id != hash.value();
   revision.date = timestamp.value();
+  revision.httpValidators.etag =
+      metadata[METADATA_ETAG_KEY].value<std::string>();
+  revision.httpValidators.lastModified =
+      metadata[METADATA_LAST_MODIFIED_KEY].value<std::string>();
 
   return revision;
 }
@@ -254,8 +277,50 @@ bool isFileUpToDate(const std::filesystem::path& filePath,
   }
 }
 
+HttpCacheValidators getHttpCacheValidators(
+    const std::filesystem::path& filePath) {
+  if (!std::filesystem::exists(filePath)) {
+    return HttpCacheValidators();
+  }
+
+  try {
+    const auto revision = getFileRevision(filePath);
+    if (revision.is_modified) {
+      return HttpCacheValidators();
+    }
+
+    return revision.httpValidators;
+  } catch (const std::exception& e) {
+    const auto logger = getLogger();
+    if (logger) {
+      logger->debug(
+          "Could not read the HTTP validators recorded for {}, the file will "
+          "be downloaded unconditionally: {}",
+          filePath.u8string(),
+          e.what());
+    }
+
+    return HttpCacheValidators();
+  }
+}
+
+void setConditionalRequestHeaders(QNetworkRequest& request,
+                                  const HttpCacheValidators& validators) {
+  if (validators.etag.has_value()) {
+    request.setRawHeader("If-None-Match",
+                         QByteArray::fromStdString(validators.etag.value()));
+  }
+
+  if (validators.lastModified.has_value()) {
+    request.setRawHeader(
+        "If-Modified-Since",
+        QByteArray::fromStdString(validators.lastModified.value()));
+  }
+}
+
 bool updateFileWithData(const std::filesystem::path& filePath,
-                        const QByteArray& data) {
+                        const QByteArray& data,
+                        const HttpCacheValidators& validators) {
   auto logger = getLogger();
 
   auto newHash = calculateGitBlobHash(data);
@@ -278,11 +343,44 @@ bool updateFileWithData(const std::filesystem::path& filePath,
   // update timestamp may have changed.
   auto updateTimestamp =
       QDate::currentDate().toString(Qt::ISODate).toStdString();
-  writeFileRevision(filePath, newHash, updateTimestamp);
+  writeFileRevision(filePath, newHash, updateTimestamp, validators);
 
   return hasChanged;
 }
 
+bool updateFileWithResponse(const std::filesystem::path& filePath,
+                            const HttpFileResponse& response) {
+  if (!response.isNotModified) {
+    return updateFileWithData(filePath, response.data, response.validators);
+  }
+
+  // A conditional request is only made if the file matches its recorded hash,
+  // so there's no need to hash it again.
+  const auto revision = getFileRevision(filePath);
+
+  const auto logger = getLogger();
+  if (logger) {
+    logger->debug("{} was not modified on the server, blob hash is still {}",
+                  filePath.u8string(),
+                  revision.id);
+  }
+
+  // A 304 response may omit validators that haven't changed.
+  auto validators = revision.httpValidators;
+  if (response.validators.etag.has_value()) {
+    validators.etag = response.validators.etag;
+  }
+  if (response.validators.lastModified.has_value()) {
+    validators.lastModified = response.validators.lastModified;
+  }
+
+  const auto updateTimestamp =
+      QDate::currentDate().toString(Qt::ISODate).toStdString();
+  writeFileRevision(filePath, revision.id, updateTimestamp, validators);
+
+  return false;
+}
+
 bool updateFile(const std::filesystem::path& source,
                 const std::filesystem::path& destination) {
   const auto logger = getLogger();
@@ -315,7 +413,7 @@ bool updateFile(const std::filesystem::path& source,
   // update timestamp may have changed.
   const auto updateTimestamp =
       QDate::currentDate().toString(Qt::ISODate).toStdString();
-  writeFileRevision(destination, newHash, updateTimestamp);
+  writeFileRevision(destination, newHash, updateTimestamp, {});
 
   return hasChanged;
 }
@@ -353,6 +451,51 @@ std::optional<QByteArray> readHttpResponse(QNetworkReply* reply) {
   return data;
 }
 
+std::optional<HttpFileResponse> readHttpFileResponse(QNetworkReply* reply) {
+  static constexpr int HTTP_STATUS_NOT_MODIFIED = 304;
+
+  if (reply->error() != QNetworkReply::NoError) {
+    const auto logger = getLogger();
+    if (logger) {
+      logger->error("Request to {} failed: {}",
+                    reply->url().toString().toStdString(),
+                    reply->errorString().toStdString());
+    }
+
+    reply->deleteLater();
+    return std::nullopt;
+  }
+
+  HttpFileResponse response;
+
+  const auto etag = reply->rawHeader("ETag");
+  if (!etag.isEmpty()) {
+    response.validators.etag = etag.toStdString();
+  }
+
+  const auto lastModified = reply->rawHeader("Last-Modified");
+  if (!lastModified.isEmpty()) {
+    response.validators.lastModified = lastModified.toStdString();
+  }
+
+  const auto statusCode =
+      reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+  if (statusCode == HTTP_STATUS_NOT_MODIFIED) {
+    response.isNotModified = true;
+    reply->deleteLater();
+    return response;
+  }
+
+  auto data = readHttpResponse(reply);
+  if (!data.has_value()) {
+    return std::nullopt;
+  }
+
+  response.data = std::move(data.value());
+
+  return response;
+}
+
 void showInvalidRegexTooltip(QWidget& widget, const std::string& details) {
   auto message = fmt::format(
       boost::locale::translate("Invalid regular expression: {0}").str(),
@@ -363,6 +506,14 @@ void showInvalidRegexTooltip(QWidget& widget, const std::string& details) {
                      &widget);
 }
 
+void showRegexTimedOutTooltip(QWidget& widget) {
+  QToolTip::showText(
+      widget.mapToGlobal(QPoint(0, 0)),
+      translate("The regular expression took too long to evaluate, so not all "
+                "plugins were checked."),
+      &widget);
+}
+
 void CopyToClipboard(const std::string& text) {
   const auto clipboard = QGuiApplication::clipboard();
   if (!clipboard) {
@@ -382,7 +533,7 @@ void OpenInDefaultApplication(const std::filesystem::path& path) {
   const auto urlString = "file:///" + path.u8string();
 
   const auto logger = getLogger();
-  if (logger) {
+  if (isTraceLoggingEnabled(logger)) {
     logger->trace("Attempting to request that the OS open the URL {}",
                   urlString);
   }
@@ -398,7 +549,7 @@ void OpenInDefaultApplication(const std::filesystem::path& path) {
   }
 #else
   const auto logger = getLogger();
-  if (logger) {
+  if (isTraceLoggingEnabled(logger)) {
     logger->trace("Attempting to request that the OS open the path {}",
                   path.u8string());
   }
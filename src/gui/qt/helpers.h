@@ -34,6 +34,7 @@
 #include <QtNetwork/QNetworkReply>
 #include <QtWidgets/QLabel>
 #include <filesystem>
+#include <optional>
 #include <vector>
 
 #include "gui/state/game/helpers.h"
@@ -41,10 +42,29 @@
 namespace loot {
 enum class FileType { Masterlist, MasterlistPrelude };
 
+// HTTP validators that were received when a file was last downloaded, which
+// can be used to make a conditional request for the file.
+struct HttpCacheValidators {
+  std::optional<std::string> etag;
+  std::optional<std::string> lastModified;
+
+  bool empty() const;
+};
+
+bool operator==(const HttpCacheValidators& lhs,
+                const HttpCacheValidators& rhs);
+
 struct FileRevision {
   std::string id;
   std::string date;
   bool is_modified{false};
+  HttpCacheValidators httpValidators;
+};
+
+struct HttpFileResponse {
+  bool isNotModified{false};
+  QByteArray data;
+  HttpCacheValidators validators;
 };
 
 struct FileRevisionSummary {
@@ -70,8 +90,25 @@ FileRevisionSummary getFileRevisionSummary(
     const std::filesystem::path& filePath,
     FileType fileType);
 
+// Get the HTTP validators recorded for the given file. No validators are
+// returned if the file doesn't exist, has no revision metadata, or has been
+// modified since it was downloaded, as the file then can't be assumed to
+// match what the server would send.
+HttpCacheValidators getHttpCacheValidators(
+    const std::filesystem::path& filePath);
+
+void setConditionalRequestHeaders(QNetworkRequest& request,
+                                  const HttpCacheValidators& validators);
+
 bool updateFileWithData(const std::filesystem::path& filePath,
-                        const QByteArray& data);
+                        const QByteArray& data,
+                        const HttpCacheValidators& validators = {});
+
+// Update the file using a response to a possibly-conditional request. If the
+// server responded that the file was not modified, only its revision metadata
+// is updated.
+bool updateFileWithResponse(const std::filesystem::path& filePath,
+                            const HttpFileResponse& response);
 
 bool updateFile(const std::filesystem::path& source,
                 const std::filesystem::path& destination);
@@ -80,8 +117,15 @@ bool isValidUrl(const std::string& location);
 
 std::optional<QByteArray> readHttpResponse(QNetworkReply* reply);
 
+// Read the response to a request that may have been conditional. Returns
+// std::nullopt if the request failed. Like readHttpResponse(), this schedules
+// the reply for deletion.
+std::optional<HttpFileResponse> readHttpFileResponse(QNetworkReply* reply);
+
 void showInvalidRegexTooltip(QWidget& widget, const std::string& details);
 
+void showRegexTimedOutTooltip(QWidget& widget);
+
 void CopyToClipboard(const std::string& text);
 
 void OpenInDefaultApplication(const std::filesystem::path& path);
@@ -25,134 +25,246 @@
 
 #include "gui/qt/icon_factory.h"
 
+#include <QtCore/QMetaObject>
+#include <QtCore/QThread>
 #include <QtGui/QGuiApplication>
+#include <QtGui/QImageReader>
+#include <QtGui/QPainter>
 #include <QtGui/QPalette>
 #include <QtGui/QScreen>
 #include <QtWidgets/QStyle>
+#include <algorithm>
 
 namespace loot {
-QPixmap changeColor(QPixmap pixmap, QColor color) {
-  QImage image = pixmap.toImage();
+namespace {
+constexpr std::array<QIcon::Mode, 3> ICON_MODES = {QIcon::Normal,
+                                                   QIcon::Disabled,
+                                                   QIcon::Selected};
+
+constexpr const char* CHECK_ICON =
+    ":/icons/material-icons/check_black_48dp.svg";
+constexpr const char* CROWN_ICON = ":/icons/crown.svg";
+constexpr const char* LIGHT_MODE_ICON =
+    ":/icons/material-icons/light_mode_black_48dp.svg";
+constexpr const char* VISIBILITY_OFF_ICON =
+    ":/icons/material-icons/visibility_off_black_48dp.svg";
+constexpr const char* ATTACHMENT_ICON =
+    ":/icons/material-icons/attachment_black_48dp.svg";
+constexpr const char* DROPLET_ICON = ":/icons/droplet.svg";
+constexpr const char* ACCOUNT_CIRCLE_ICON =
+    ":/icons/material-icons/account_circle_black_48dp.svg";
+constexpr const char* CREATE_ICON =
+    ":/icons/material-icons/create_black_48dp.svg";
+constexpr const char* SORT_ICON = ":/icons/material-icons/sort_black_48dp.svg";
+constexpr const char* CLOSE_ICON =
+    ":/icons/material-icons/close_black_48dp.svg";
+constexpr const char* FILE_DOWNLOAD_ICON =
+    ":/icons/material-icons/file_download_black_48dp.svg";
+constexpr const char* SETTINGS_ICON =
+    ":/icons/material-icons/settings_black_48dp.svg";
+constexpr const char* ARCHIVE_ICON =
+    ":/icons/material-icons/archive_black_48dp.svg";
+constexpr const char* GROUP_WORK_ICON =
+    ":/icons/material-icons/group_work_black_48dp.svg";
+constexpr const char* SEARCH_ICON =
+    ":/icons/material-icons/search_black_48dp.svg";
+constexpr const char* RECEIPT_ICON =
+    ":/icons/material-icons/receipt_black_48dp.svg";
+constexpr const char* CONTENT_COPY_ICON =
+    ":/icons/material-icons/content_copy_black_48dp.svg";
+constexpr const char* DATA_OBJECT_ICON =
+    ":/icons/material-icons/data_object_black_48dp.svg";
+constexpr const char* REFRESH_ICON =
+    ":/icons/material-icons/refresh_black_48dp.svg";
+constexpr const char* TODAY_ICON =
+    ":/icons/material-icons/today_black_48dp.svg";
+constexpr const char* BUILD_ICON =
+    ":/icons/material-icons/build_black_48dp.svg";
+constexpr const char* DELETE_ICON =
+    ":/icons/material-icons/delete_black_48dp.svg";
+constexpr const char* BOOK_ICON = ":/icons/material-icons/book_black_48dp.svg";
+constexpr const char* QUIZ_ICON = ":/icons/material-icons/quiz_black_48dp.svg";
+constexpr const char* FOLDER_ICON =
+    ":/icons/material-icons/folder_black_48dp.svg";
+constexpr const char* FORUM_ICON =
+    ":/icons/material-icons/forum_black_48dp.svg";
+constexpr const char* HELP_ICON = ":/icons/material-icons/help_black_48dp.svg";
+
+// Every icon is included in each atlas.
+constexpr std::array<const char*, 27> ICON_RESOURCE_PATHS = {
+    CHECK_ICON,
+    CROWN_ICON,
+    LIGHT_MODE_ICON,
+    VISIBILITY_OFF_ICON,
+    ATTACHMENT_ICON,
+    DROPLET_ICON,
+    ACCOUNT_CIRCLE_ICON,
+    CREATE_ICON,
+    SORT_ICON,
+    CLOSE_ICON,
+    FILE_DOWNLOAD_ICON,
+    SETTINGS_ICON,
+    ARCHIVE_ICON,
+    GROUP_WORK_ICON,
+    SEARCH_ICON,
+    RECEIPT_ICON,
+    CONTENT_COPY_ICON,
+    DATA_OBJECT_ICON,
+    REFRESH_ICON,
+    TODAY_ICON,
+    BUILD_ICON,
+    DELETE_ICON,
+    BOOK_ICON,
+    QUIZ_ICON,
+    FOLDER_ICON,
+    FORUM_ICON,
+    HELP_ICON};
+
+double getDevicePixelRatio() {
+  return dynamic_cast<QGuiApplication*>(QCoreApplication::instance())
+      ->devicePixelRatio();
+}
+
+QImage loadIconImage(const QString& resourcePath, double pixelRatio) {
+  QImageReader reader(resourcePath);
+  reader.setScaledSize(reader.size() * pixelRatio);
+
+  return reader.read();
+}
+}
+
+QImage recolorImage(const QImage& image, const QColor& color) {
+  auto recolored = image.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+
+  // A recolored pixel only depends on the original pixel's alpha value, so
+  // precalculate the premultiplied pixel for each alpha value.
+  const auto rgb = color.rgb();
+  std::array<QRgb, 256> pixelsByAlpha;
+  for (size_t alpha = 0; alpha < pixelsByAlpha.size(); alpha += 1) {
+    pixelsByAlpha[alpha] = qPremultiply(qRgba(
+        qRed(rgb), qGreen(rgb), qBlue(rgb), static_cast<int>(alpha)));
+  }
 
-  for (int y = 0; y < image.height(); y++) {
-    for (int x = 0; x < image.width(); x++) {
-      color.setAlpha(image.pixelColor(x, y).alpha());
-      image.setPixelColor(x, y, color);
+  const auto width = recolored.width();
+  for (int y = 0; y < recolored.height(); y += 1) {
+    const auto line = reinterpret_cast<QRgb*>(recolored.scanLine(y));
+    for (int x = 0; x < width; x += 1) {
+      line[x] = pixelsByAlpha[qAlpha(line[x])];
     }
   }
 
-  return QPixmap::fromImage(image);
+  return recolored;
 }
 
 QIcon IconFactory::getIsActiveIcon() {
-  return getIcon(":/icons/material-icons/check_black_48dp.svg");
+  return getIcon(CHECK_ICON);
 }
 
-QIcon IconFactory::getMasterFileIcon() { return getIcon(":/icons/crown.svg"); }
+QIcon IconFactory::getMasterFileIcon() { return getIcon(CROWN_ICON); }
 
 QIcon IconFactory::getLightPluginIcon() {
-  return getIcon(":/icons/material-icons/light_mode_black_48dp.svg");
+  return getIcon(LIGHT_MODE_ICON);
 }
 
 QIcon IconFactory::getEmptyPluginIcon() {
-  return getIcon(":/icons/material-icons/visibility_off_black_48dp.svg");
+  return getIcon(VISIBILITY_OFF_ICON);
 }
 
 QIcon IconFactory::getLoadsArchiveIcon() {
-  return getIcon(":/icons/material-icons/attachment_black_48dp.svg");
+  return getIcon(ATTACHMENT_ICON);
 }
 
-QIcon IconFactory::getIsCleanIcon() { return getIcon(":/icons/droplet.svg"); }
+QIcon IconFactory::getIsCleanIcon() { return getIcon(DROPLET_ICON); }
 
 QIcon IconFactory::getHasUserMetadataIcon() {
-  return getIcon(":/icons/material-icons/account_circle_black_48dp.svg");
+  return getIcon(ACCOUNT_CIRCLE_ICON);
 }
 
 QIcon IconFactory::getEditIcon() {
-  return getIcon(":/icons/material-icons/create_black_48dp.svg");
+  return getIcon(CREATE_ICON);
 }
 
 QIcon IconFactory::getSortIcon() {
-  return getIcon(":/icons/material-icons/sort_black_48dp.svg");
+  return getIcon(SORT_ICON);
 }
 
 QIcon IconFactory::getApplySortIcon() {
-  return getIcon(":/icons/material-icons/check_black_48dp.svg");
+  return getIcon(CHECK_ICON);
 }
 
 QIcon IconFactory::getDiscardSortIcon() {
-  return getIcon(":/icons/material-icons/close_black_48dp.svg");
+  return getIcon(CLOSE_ICON);
 }
 
 QIcon IconFactory::getUpdateMasterlistIcon() {
-  return getIcon(":/icons/material-icons/file_download_black_48dp.svg");
+  return getIcon(FILE_DOWNLOAD_ICON);
 }
 
 QIcon IconFactory::getSettingsIcon() {
-  return getIcon(":/icons/material-icons/settings_black_48dp.svg");
+  return getIcon(SETTINGS_ICON);
 }
 
 QIcon IconFactory::getArchiveIcon() {
-  return getIcon(":/icons/material-icons/archive_black_48dp.svg");
+  return getIcon(ARCHIVE_ICON);
 }
 
 QIcon IconFactory::getQuitIcon() {
-  return getIcon(":/icons/material-icons/close_black_48dp.svg");
+  return getIcon(CLOSE_ICON);
 }
 
 QIcon IconFactory::getOpenGroupsEditorIcon() {
-  return getIcon(":/icons/material-icons/group_work_black_48dp.svg");
+  return getIcon(GROUP_WORK_ICON);
 }
 
 QIcon IconFactory::getSearchIcon() {
-  return getIcon(":/icons/material-icons/search_black_48dp.svg");
+  return getIcon(SEARCH_ICON);
 }
 
 QIcon IconFactory::getCopyLoadOrderIcon() {
-  return getIcon(":/icons/material-icons/receipt_black_48dp.svg");
+  return getIcon(RECEIPT_ICON);
 }
 
 QIcon IconFactory::getCopyContentIcon() {
-  return getIcon(":/icons/material-icons/content_copy_black_48dp.svg");
+  return getIcon(CONTENT_COPY_ICON);
 }
 
 QIcon IconFactory::getCopyMetadataIcon() {
-  return getIcon(":/icons/material-icons/data_object_black_48dp.svg");
+  return getIcon(DATA_OBJECT_ICON);
 }
 
 QIcon IconFactory::getRefreshIcon() {
-  return getIcon(":/icons/material-icons/refresh_black_48dp.svg");
+  return getIcon(REFRESH_ICON);
 }
 
 QIcon IconFactory::getRedateIcon() {
-  return getIcon(":/icons/material-icons/today_black_48dp.svg");
+  return getIcon(TODAY_ICON);
 }
 
 QIcon IconFactory::getFixIcon() {
-  return getIcon(":/icons/material-icons/build_black_48dp.svg");
+  return getIcon(BUILD_ICON);
 }
 
 QIcon IconFactory::getDeleteIcon() {
-  return getIcon(":/icons/material-icons/delete_black_48dp.svg");
+  return getIcon(DELETE_ICON);
 }
 
 QIcon IconFactory::getViewDocsIcon() {
-  return getIcon(":/icons/material-icons/book_black_48dp.svg");
+  return getIcon(BOOK_ICON);
 }
 QIcon IconFactory::getOpenFAQsIcon() {
-  return getIcon(":/icons/material-icons/quiz_black_48dp.svg");
+  return getIcon(QUIZ_ICON);
 }
 
 QIcon IconFactory::getOpenLOOTDataFolderIcon() {
-  return getIcon(":/icons/material-icons/folder_black_48dp.svg");
+  return getIcon(FOLDER_ICON);
 }
 
 QIcon IconFactory::getJoinDiscordServerIcon() {
-  return getIcon(":/icons/material-icons/forum_black_48dp.svg");
+  return getIcon(FORUM_ICON);
 }
 
 QIcon IconFactory::getAboutIcon() {
-  return getIcon(":/icons/material-icons/help_black_48dp.svg");
+  return getIcon(HELP_ICON);
 }
 
 QPixmap IconFactory::getPixmap(const QIcon& icon,
@@ -161,17 +273,18 @@ QPixmap IconFactory::getPixmap(const QIcon& icon,
                                QIcon::State state) {
   // Take the device pixel ratio into account when reading or writing the cache
   // as it may change while the application is running.
-  const auto pixelRatio =
-      dynamic_cast<QGuiApplication*>(QCoreApplication::instance())
-          ->devicePixelRatio();
+  const auto pixelRatio = getDevicePixelRatio();
   auto scaledSize = extent * pixelRatio;
   auto key = std::make_tuple(icon.cacheKey(), scaledSize, mode, state);
 
   const auto it = pixmaps.find(key);
   if (it != pixmaps.end()) {
+    pixmapHitCount += 1;
     return it->second;
   }
 
+  pixmapMissCount += 1;
+
   auto pixmap = icon.pixmap(extent, mode, state);
 
   pixmaps.emplace(key, pixmap);
@@ -179,6 +292,24 @@ QPixmap IconFactory::getPixmap(const QIcon& icon,
   return pixmap;
 }
 
+CacheStatistics IconFactory::getPixmapCacheStatistics() {
+  CacheStatistics statistics;
+  statistics.entryCount = pixmaps.size();
+  statistics.hitCount = pixmapHitCount;
+  statistics.missCount = pixmapMissCount;
+
+  return statistics;
+}
+
+CacheStatistics IconFactory::getAtlasCacheStatistics() {
+  CacheStatistics statistics;
+  statistics.entryCount = atlases.size();
+  statistics.hitCount = atlasHitCount;
+  statistics.missCount = atlasMissCount;
+
+  return statistics;
+}
+
 void IconFactory::setColours(QColor normal, QColor disabled, QColor selected) {
   icons.clear();
   pixmaps.clear();
@@ -188,23 +319,91 @@ void IconFactory::setColours(QColor normal, QColor disabled, QColor selected) {
   selectedColor = selected;
 }
 
+void IconFactory::setColoursAsync(QColor normal,
+                                  QColor disabled,
+                                  QColor selected,
+                                  QObject* context,
+                                  std::function<void()> onSet) {
+  asyncColoursRequestCount += 1;
+  const auto requestNumber = asyncColoursRequestCount;
+
+  const auto colors = std::array<QColor, 3>{normal, disabled, selected};
+  const auto pixelRatio = getDevicePixelRatio();
+  const auto key = getAtlasKey(colors, pixelRatio);
+
+  if (atlases.count(key) != 0) {
+    atlasHitCount += 1;
+    setColours(normal, disabled, selected);
+    onSet();
+    return;
+  }
+
+  const auto buildIt = atlasBuilds.find(key);
+  auto& build = buildIt == atlasBuilds.end()
+                    ? startAtlasBuild(key, colors, pixelRatio)
+                    : buildIt->second;
+
+  build.callbacks.emplace_back(
+      context, [normal, disabled, selected, requestNumber, onSet]() {
+        // Don't overwrite the colours from a later request.
+        if (requestNumber == asyncColoursRequestCount) {
+          setColours(normal, disabled, selected);
+          onSet();
+        }
+      });
+}
+
+void IconFactory::buildAtlasAsync() {
+  initialiseColours();
+
+  const auto colors =
+      std::array<QColor, 3>{normalColor, disabledColor, selectedColor};
+  const auto pixelRatio = getDevicePixelRatio();
+  const auto key = getAtlasKey(colors, pixelRatio);
+
+  if (atlases.count(key) == 0 && atlasBuilds.count(key) == 0) {
+    startAtlasBuild(key, colors, pixelRatio);
+  }
+}
+
+void IconFactory::waitForAtlasBuilds() {
+  for (const auto& [key, build] : atlasBuilds) {
+    build.thread->wait();
+  }
+
+  // The builds' callbacks would run after the application's event loop has
+  // stopped, so they're discarded.
+  atlasBuilds.clear();
+}
+
 std::map<QString, QIcon> IconFactory::icons;
 
 std::map<std::tuple<qint64, double, QIcon::Mode, QIcon::State>, QPixmap>
     IconFactory::pixmaps;
 
+std::map<IconFactory::AtlasKey, std::shared_ptr<IconFactory::IconAtlas>>
+    IconFactory::atlases;
+
+std::map<IconFactory::AtlasKey, IconFactory::AtlasBuild>
+    IconFactory::atlasBuilds;
+
+unsigned int IconFactory::asyncColoursRequestCount{0};
+
+uint64_t IconFactory::pixmapHitCount{0};
+
+uint64_t IconFactory::pixmapMissCount{0};
+
+uint64_t IconFactory::atlasHitCount{0};
+
+uint64_t IconFactory::atlasMissCount{0};
+
 QColor IconFactory::normalColor;
 
 QColor IconFactory::disabledColor;
 
 QColor IconFactory::selectedColor;
 
-QIcon IconFactory::getIcon(QString resourcePath) {
-  const auto it = icons.find(resourcePath);
-  if (it != icons.end()) {
-    return it->second;
-  }
-
+void IconFactory::initialiseColours() {
   if (!normalColor.isValid()) {
     normalColor = QGuiApplication::palette().color(QPalette::Disabled,
                                                    QPalette::WindowText);
@@ -219,19 +418,162 @@ QIcon IconFactory::getIcon(QString resourcePath) {
     selectedColor = QGuiApplication::palette().color(QPalette::Active,
                                                      QPalette::HighlightedText);
   }
+}
+
+QIcon IconFactory::getIcon(QString resourcePath) {
+  const auto it = icons.find(resourcePath);
+  if (it != icons.end()) {
+    return it->second;
+  }
+
+  initialiseColours();
+
+  auto& atlas = getAtlas();
+  if (atlas.pixmap.isNull()) {
+    atlas.pixmap = QPixmap::fromImage(atlas.image);
+  }
 
-  auto rawPixmap = QPixmap(resourcePath);
-  auto normalPixmap = changeColor(rawPixmap, normalColor);
-  auto disabledPixmap = changeColor(rawPixmap, disabledColor);
-  auto selectedPixmap = changeColor(rawPixmap, selectedColor);
+  const auto& rect = atlas.rects.at(resourcePath);
 
   QIcon icon;
-  icon.addPixmap(normalPixmap, QIcon::Normal);
-  icon.addPixmap(disabledPixmap, QIcon::Disabled);
-  icon.addPixmap(selectedPixmap, QIcon::Selected);
+  for (size_t i = 0; i < ICON_MODES.size(); i += 1) {
+    const auto offset = static_cast<int>(i) * atlas.columnWidth;
+    auto pixmap = atlas.pixmap.copy(rect.translated(offset, 0));
+    pixmap.setDevicePixelRatio(atlas.pixelRatio);
+    icon.addPixmap(pixmap, ICON_MODES.at(i));
+  }
 
   icons.emplace(resourcePath, icon);
 
   return icon;
 }
+
+IconFactory::IconAtlas& IconFactory::getAtlas() {
+  const auto colors =
+      std::array<QColor, 3>{normalColor, disabledColor, selectedColor};
+  const auto pixelRatio = getDevicePixelRatio();
+  const auto key = getAtlasKey(colors, pixelRatio);
+
+  const auto it = atlases.find(key);
+  if (it != atlases.end()) {
+    atlasHitCount += 1;
+    return *it->second;
+  }
+
+  // The icon is needed now, so wait for its atlas. The build is left to
+  // finish normally so that its callbacks are still run.
+  const auto buildIt = atlasBuilds.find(key);
+  auto& build = buildIt == atlasBuilds.end()
+                    ? startAtlasBuild(key, colors, pixelRatio)
+                    : buildIt->second;
+
+  build.thread->wait();
+
+  return *atlases.emplace(key, build.atlas).first->second;
+}
+
+IconFactory::AtlasKey IconFactory::getAtlasKey(
+    const std::array<QColor, 3>& colors,
+    double pixelRatio) {
+  return AtlasKey(colors.at(0).rgba(),
+                  colors.at(1).rgba(),
+                  colors.at(2).rgba(),
+                  pixelRatio);
+}
+
+IconFactory::AtlasBuild& IconFactory::startAtlasBuild(
+    const AtlasKey& key,
+    const std::array<QColor, 3>& colors,
+    double pixelRatio) {
+  atlasMissCount += 1;
+
+  const auto atlas = std::make_shared<IconAtlas>();
+  const auto thread = QThread::create([atlas, key, colors, pixelRatio]() {
+    *atlas = buildAtlas(colors, pixelRatio);
+
+    QMetaObject::invokeMethod(
+        QCoreApplication::instance(),
+        [key]() { handleAtlasBuilt(key); },
+        Qt::QueuedConnection);
+  });
+
+  auto& build = atlasBuilds[key];
+  build.thread.reset(thread);
+  build.atlas = atlas;
+
+  thread->start();
+
+  return build;
+}
+
+void IconFactory::handleAtlasBuilt(const AtlasKey& key) {
+  const auto it = atlasBuilds.find(key);
+  if (it == atlasBuilds.end()) {
+    // The build was waited for during shutdown.
+    return;
+  }
+
+  const auto build = std::move(it->second);
+  atlasBuilds.erase(it);
+
+  // The thread may not have quite exited yet.
+  build.thread->wait();
+
+  atlases.emplace(key, build.atlas);
+
+  for (const auto& [context, callback] : build.callbacks) {
+    if (context) {
+      callback();
+    }
+  }
+}
+
+IconFactory::IconAtlas IconFactory::buildAtlas(
+    const std::array<QColor, 3>& colors,
+    double pixelRatio) {
+  IconAtlas atlas;
+  atlas.pixelRatio = pixelRatio;
+
+  // Stack the icons in a single column so that they can be recoloured
+  // together.
+  std::vector<QImage> images;
+  int height = 0;
+  for (const auto resourcePath : ICON_RESOURCE_PATHS) {
+    auto image = loadIconImage(resourcePath, pixelRatio);
+
+    atlas.rects.emplace(QString(resourcePath),
+                        QRect(QPoint(0, height), image.size()));
+    atlas.columnWidth = std::max(atlas.columnWidth, image.width());
+    height += image.height();
+
+    images.push_back(std::move(image));
+  }
+
+  QImage column(
+      atlas.columnWidth, height, QImage::Format_ARGB32_Premultiplied);
+  column.fill(Qt::transparent);
+
+  QPainter columnPainter(&column);
+  columnPainter.setCompositionMode(QPainter::CompositionMode_Source);
+  for (size_t i = 0; i < images.size(); i += 1) {
+    const auto& rect = atlas.rects.at(QString(ICON_RESOURCE_PATHS.at(i)));
+    columnPainter.drawImage(rect.topLeft(), images.at(i));
+  }
+  columnPainter.end();
+
+  atlas.image = QImage(atlas.columnWidth * static_cast<int>(colors.size()),
+                       height,
+                       QImage::Format_ARGB32_Premultiplied);
+  atlas.image.fill(Qt::transparent);
+
+  QPainter atlasPainter(&atlas.image);
+  atlasPainter.setCompositionMode(QPainter::CompositionMode_Source);
+  for (size_t i = 0; i < colors.size(); i += 1) {
+    const auto offset = static_cast<int>(i) * atlas.columnWidth;
+    atlasPainter.drawImage(QPoint(offset, 0),
+                           recolorImage(column, colors.at(i)));
+  }
+
+  return atlas;
+}
 }
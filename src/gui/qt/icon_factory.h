@@ -26,13 +26,28 @@
 #ifndef LOOT_GUI_QT_ICON_FACTORY
 #define LOOT_GUI_QT_ICON_FACTORY
 
+#include <QtCore/QObject>
+#include <QtCore/QPointer>
 #include <QtCore/QString>
+#include <QtCore/QThread>
 #include <QtGui/QColor>
 #include <QtGui/QIcon>
+#include <QtGui/QImage>
 #include <QtGui/QPixmap>
+#include <array>
+#include <functional>
 #include <map>
+#include <memory>
+#include <vector>
+
+#include "gui/qt/diagnostics.h"
 
 namespace loot {
+// Sets the colour of every pixel in the image to the given colour, keeping
+// the pixel's alpha value. The returned image is in the premultiplied ARGB32
+// format.
+QImage recolorImage(const QImage& image, const QColor& color);
+
 class IconFactory {
 public:
   static QIcon getIsActiveIcon();
@@ -77,16 +92,87 @@ public:
 
   static void setColours(QColor normal, QColor disabled, QColor selected);
 
+  // Builds the icon atlas for the given colours in a worker thread, then sets
+  // the colours and calls onSet in the context object's thread. If the atlas
+  // has already been built, that happens immediately. If this is called again
+  // before the atlas is built, only the last call's colours will be set.
+  static void setColoursAsync(QColor normal,
+                              QColor disabled,
+                              QColor selected,
+                              QObject* context,
+                              std::function<void()> onSet);
+
+  // Starts building the icon atlas for the current colours in a worker thread,
+  // so that the first icons requested don't need to wait as long for it.
+  static void buildAtlasAsync();
+
+  // Waits for any atlases that are being built. This must be called before
+  // the application is destroyed, as their worker threads use it.
+  static void waitForAtlasBuilds();
+
+  static CacheStatistics getPixmapCacheStatistics();
+  static CacheStatistics getAtlasCacheStatistics();
+
 private:
+  // A single image that holds each icon's normal, disabled and selected
+  // pixmaps, in that column order, with one row per icon.
+  struct IconAtlas {
+    QImage image;
+    // Created from the image when the atlas is first used.
+    QPixmap pixmap;
+    double pixelRatio{1.0};
+    int columnWidth{0};
+    // The rect of each icon's normal pixmap.
+    std::map<QString, QRect> rects;
+  };
+
+  // An atlas that is being built in a worker thread. Only the atlas is
+  // written to from the worker thread.
+  struct AtlasBuild {
+    std::unique_ptr<QThread> thread;
+    std::shared_ptr<IconAtlas> atlas;
+    // Run in the main thread once the atlas has been built, if their context
+    // object still exists.
+    std::vector<std::pair<QPointer<QObject>, std::function<void()>>>
+        callbacks;
+  };
+
+  typedef std::tuple<QRgb, QRgb, QRgb, double> AtlasKey;
+
   static std::map<QString, QIcon> icons;
   static std::map<std::tuple<qint64, double, QIcon::Mode, QIcon::State>,
                   QPixmap>
       pixmaps;
+  static std::map<AtlasKey, std::shared_ptr<IconAtlas>> atlases;
+  static std::map<AtlasKey, AtlasBuild> atlasBuilds;
+  static unsigned int asyncColoursRequestCount;
+  static uint64_t pixmapHitCount;
+  static uint64_t pixmapMissCount;
+  static uint64_t atlasHitCount;
+  static uint64_t atlasMissCount;
   static QColor normalColor;
   static QColor disabledColor;
   static QColor selectedColor;
 
+  static void initialiseColours();
+
   static QIcon getIcon(QString resourcePath);
+
+  // Waits for the current colours' atlas to be built if it hasn't been.
+  static IconAtlas& getAtlas();
+
+  static AtlasKey getAtlasKey(const std::array<QColor, 3>& colors,
+                              double pixelRatio);
+
+  static AtlasBuild& startAtlasBuild(const AtlasKey& key,
+                                     const std::array<QColor, 3>& colors,
+                                     double pixelRatio);
+
+  static void handleAtlasBuilt(const AtlasKey& key);
+
+  // This only uses QImage so that it can be called from any thread.
+  static IconAtlas buildAtlas(const std::array<QColor, 3>& colors,
+                              double pixelRatio);
 };
 }
 
@@ -31,8 +31,11 @@
 #include <QtWidgets/QApplication>
 
 #include "gui/application_mutex.h"
+#include "gui/qt/icon_factory.h"
 #include "gui/qt/main_window.h"
 #include "gui/qt/style.h"
+#include "gui/qt/tasks/prefetched_query.h"
+#include "gui/query/types/get_game_data_query.h"
 #include "gui/state/logging.h"
 #include "gui/state/loot_state.h"
 #include "gui/version.h"
@@ -74,6 +77,46 @@ void logRuntimeEnvironment() {
   }
 }
 
+bool hasInitErrors(const loot::LootState& state) {
+  const auto& initMessages = state.getInitMessages();
+  return std::any_of(initMessages.begin(),
+                     initMessages.end(),
+                     [](const loot::SourcedMessage& message) {
+                       return message.type == loot::MessageType::error;
+                     });
+}
+
+std::unique_ptr<loot::PrefetchedQuery> prefetchGameData(
+    loot::LootState& state) {
+  // Initialising the game can migrate its LOOT data, which must be backed up
+  // first on the first run of a new version of LOOT, and that only happens
+  // once the main window has been initialised.
+  if (!state.HasCurrentGame() ||
+      state.getSettings().getLastVersion() != loot::gui::Version::string()) {
+    return nullptr;
+  }
+
+  state.initCurrentGame();
+
+  if (hasInitErrors(state)) {
+    return nullptr;
+  }
+
+  // Progress updates can't be displayed before the main window exists, and
+  // the main window displays its own progress message while waiting.
+  auto query = std::make_unique<loot::GetGameDataQuery>(
+      state.GetCurrentGame(),
+      state.getSettings().getLanguage(),
+      false,
+      [](std::string) {});
+
+  // The general information is also got in the worker thread, as it involves
+  // hashing the masterlist and prelude files.
+  return std::make_unique<loot::PrefetchedQuery>(
+      std::move(query),
+      [&state]() { return loot::getGeneralInformation(state); });
+}
+
 int main(int argc, char* argv[]) {
 #ifdef _WIN32
   // Check if LOOT is already running
@@ -112,12 +155,20 @@ int main(int argc, char* argv[]) {
       std::filesystem::u8path(parser.value("game-path").toStdString());
   auto autoSort = parser.isSet("auto-sort");
 
+  // The main window's icons are all recoloured together in one image, so
+  // start doing that in the background too.
+  loot::IconFactory::buildAtlasAsync();
+
   loot::LootState state("", lootDataPath);
 
   logRuntimeEnvironment();
 
   state.init(startupGameFolder, gamePath, autoSort);
 
+  // Loading the game's data doesn't depend on the UI, so start doing that in
+  // the background while the UI is set up.
+  auto gameDataQuery = prefetchGameData(state);
+
   // Load Qt's translations.
   QTranslator translator;
 
@@ -180,7 +231,7 @@ int main(int argc, char* argv[]) {
           logger->debug(message);
         }
 
-        mainWindow.initialise();
+        mainWindow.initialise(std::move(gameDataQuery));
 
         timer->stop();
         timer->deleteLater();
@@ -192,8 +243,12 @@ int main(int argc, char* argv[]) {
     timer->start(1);
   } else {
     mainWindow.show();
-    mainWindow.initialise();
+    mainWindow.initialise(std::move(gameDataQuery));
   }
 
-  return app.exec();
+  const auto exitCode = app.exec();
+
+  loot::IconFactory::waitForAtlasBuilds();
+
+  return exitCode;
 }
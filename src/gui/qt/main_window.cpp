@@ -27,6 +27,10 @@
 
 #include <spdlog/fmt/fmt.h>
 
+#include <algorithm>
+#include <chrono>
+
+#include <QtCore/QDateTime>
 #include <QtCore/QTimer>
 #include <QtGui/QCloseEvent>
 #include <QtGui/QDesktopServices>
@@ -40,9 +44,12 @@
 #include <boost/algorithm/string.hpp>
 
 #include "gui/backup.h"
+#include "gui/parallel.h"
+#include "gui/qt/diagnostics.h"
 #include "gui/qt/helpers.h"
 #include "gui/qt/icon_factory.h"
 #include "gui/qt/plugin_item_filter_model.h"
+#include "gui/qt/session_snapshot.h"
 #include "gui/qt/sidebar_plugin_name_delegate.h"
 #include "gui/qt/style.h"
 #include "gui/qt/tasks/check_for_update_task.h"
@@ -58,10 +65,14 @@
 #include "gui/version.h"
 
 namespace {
+using loot::ContentMatcher;
 using loot::GameId;
 using loot::LootState;
 using loot::translate;
 
+// Edits made within this long of one another are saved together.
+constexpr std::chrono::milliseconds USER_METADATA_SAVE_DELAY(500);
+
 void showAmbiguousLoadOrderSetWarning(QWidget* parent, const LootState& state) {
   const auto maybeSTestFile =
       state.GetCurrentGame().GetSettings().Id() == GameId::fo4 ||
@@ -80,6 +91,12 @@ void showAmbiguousLoadOrderSetWarning(QWidget* parent, const LootState& state) {
   QMessageBox::warning(
       parent, translate("Ambiguous load order detected"), message);
 }
+
+ContentMatcher getSearchMatcher(const QVariant& text) {
+  return text.userType() == QMetaType::QRegularExpression
+             ? ContentMatcher(text.toRegularExpression())
+             : ContentMatcher(text.toString());
+}
 }
 
 namespace loot {
@@ -118,6 +135,73 @@ bool hasLoadOrderChanged(const std::vector<std::string>& oldLoadOrder,
   return false;
 }
 
+std::vector<PluginItem> reorderPluginItems(std::vector<PluginItem> pluginItems,
+                                           const CancelSortResult& loadOrder) {
+  std::unordered_map<std::string, size_t> itemIndexByName;
+  itemIndexByName.reserve(pluginItems.size());
+  for (size_t i = 0; i < pluginItems.size(); i += 1) {
+    itemIndexByName.emplace(pluginItems.at(i).name, i);
+  }
+
+  std::vector<PluginItem> reorderedItems;
+  reorderedItems.reserve(loadOrder.size());
+  for (const auto& [pluginName, loadOrderIndex] : loadOrder) {
+    const auto it = itemIndexByName.find(pluginName);
+    if (it != itemIndexByName.end()) {
+      auto& pluginItem = pluginItems.at(it->second);
+      pluginItem.loadOrderIndex = loadOrderIndex;
+      reorderedItems.push_back(std::move(pluginItem));
+    }
+  }
+
+  return reorderedItems;
+}
+
+std::vector<PluginItem> applySortResult(
+    const std::vector<PluginItem>& pluginItems,
+    SortPluginsResult&& sortResult) {
+  std::unordered_map<std::string, size_t> itemIndexByName;
+
+  std::vector<PluginItem> sortedItems;
+  sortedItems.reserve(sortResult.size());
+  for (auto& sortedItem : sortResult) {
+    if (sortedItem.item.has_value()) {
+      sortedItems.push_back(std::move(sortedItem.item.value()));
+      continue;
+    }
+
+    auto index = sortedItem.previousIndex.value();
+    if (index >= pluginItems.size() ||
+        pluginItems.at(index).name != sortedItem.name) {
+      // The displayed items were replaced after sorting started (e.g. because
+      // the masterlist was updated), so look the plugin up by name instead.
+      if (itemIndexByName.empty()) {
+        itemIndexByName.reserve(pluginItems.size());
+        for (size_t i = 0; i < pluginItems.size(); i += 1) {
+          itemIndexByName.emplace(pluginItems.at(i).name, i);
+        }
+      }
+
+      const auto it = itemIndexByName.find(sortedItem.name);
+      if (it == itemIndexByName.end()) {
+        throw std::runtime_error("The sorted plugin \"" + sortedItem.name +
+                                 "\" is not displayed");
+      }
+      index = it->second;
+    }
+
+    auto pluginItem = pluginItems.at(index);
+    pluginItem.loadOrderIndex = sortedItem.loadOrderIndex;
+    if (sortedItem.crc.has_value()) {
+      pluginItem.crc = sortedItem.crc;
+    }
+
+    sortedItems.push_back(std::move(pluginItem));
+  }
+
+  return sortedItems;
+}
+
 int calculateSidebarHeaderWidth(const QAbstractItemView& view, int column) {
   const auto headerText =
       view.model()->headerData(column, Qt::Horizontal).toString();
@@ -248,9 +332,21 @@ void setWindowPosition(QWidget& window,
 }
 
 MainWindow::MainWindow(LootState& state, QWidget* parent) :
-    QMainWindow(parent), state(state) {
+    QMainWindow(parent),
+    state(state),
+    userMetadataSaver(
+        USER_METADATA_SAVE_DELAY,
+        [this]() { this->state.GetCurrentGame().SaveUserMetadata(); },
+        [this](const std::exception& e) {
+          // This is called from the saver's thread.
+          QMetaObject::invokeMethod(
+              this, [this, message = std::string(e.what())]() {
+                handleException(std::runtime_error(message));
+              });
+        }) {
   qRegisterMetaType<QueryResult>("QueryResult");
   qRegisterMetaType<std::string>("std::string");
+  qRegisterMetaType<GeneralInformation>("GeneralInformation");
 
   setupUi();
   refreshGamesDropdown();
@@ -267,7 +363,7 @@ MainWindow::MainWindow(LootState& state, QWidget* parent) :
                 });
 }
 
-void MainWindow::initialise() {
+void MainWindow::initialise(std::unique_ptr<PrefetchedQuery> gameDataQuery) {
   try {
     themes = findThemes(state.getThemesPath());
 
@@ -275,7 +371,7 @@ void MainWindow::initialise() {
       showFirstRunDialog();
     }
 
-    if (state.HasCurrentGame()) {
+    if (state.HasCurrentGame() && !gameDataQuery) {
       state.initCurrentGame();
     }
 
@@ -305,7 +401,23 @@ void MainWindow::initialise() {
     gameComboBox->setCurrentText(
         QString::fromStdString(state.GetCurrentGame().GetSettings().Name()));
 
-    loadGame(true);
+    showSessionSnapshot();
+
+    if (gameDataQuery) {
+      prefetchedGameDataQuery = std::move(gameDataQuery);
+
+      if (!prefetchedGameDataQuery->isDone()) {
+        handleProgressUpdate(
+            translate("Parsing, merging and evaluating metadata..."));
+      }
+
+      prefetchedGameDataQuery->deliverTo(
+          this,
+          &MainWindow::handlePrefetchedGameDataLoaded,
+          &MainWindow::handlePrefetchedGameDataError);
+    } else {
+      loadGame(true);
+    }
 
     // Check for updates.
     if (state.getSettings().isLootUpdateCheckEnabled()) {
@@ -400,11 +512,13 @@ void MainWindow::setupUi() {
 
   settingsDialog->setObjectName("settingsDialog");
   searchDialog->setObjectName("searchDialog");
+  diagnosticsDialog->setObjectName("diagnosticsDialog");
   sidebarPluginsView->setObjectName("sidebarPluginsView");
 
   toolBox->addItem(sidebarPluginsView, QString("P&lugins"));
 
   filtersWidget->setObjectName("filtersWidget");
+  filtersWidget->setPluginNamesModel(pluginNameListModel);
 
   toolBox->addItem(filtersWidget, QString("F&ilters"));
 
@@ -415,6 +529,7 @@ void MainWindow::setupUi() {
   editorSplitter->addWidget(pluginCardsView);
 
   pluginEditorWidget->setObjectName("pluginEditorWidget");
+  pluginEditorWidget->setFilenameCompletionModel(pluginNameListModel);
   pluginEditorWidget->hide();
 
   editorSplitter->addWidget(pluginEditorWidget);
@@ -444,10 +559,13 @@ void MainWindow::setupUi() {
   progressDialog->reset();
 
   pluginItemModel->setObjectName("pluginItemModel");
+  pluginItemChanges->setObjectName("pluginItemChanges");
 
   proxyModel->setObjectName("proxyModel");
   proxyModel->setSourceModel(pluginItemModel);
 
+  searchEngine->setObjectName("searchEngine");
+
   groupsEditor->setObjectName("groupsEditor");
 
   setupViews();
@@ -512,6 +630,8 @@ void MainWindow::setupMenuBar() {
 
   actionJoinDiscordServer->setObjectName("actionJoinDiscordServer");
 
+  actionViewDiagnostics->setObjectName("actionViewDiagnostics");
+
   actionAbout->setObjectName("actionAbout");
 
   actionOpenGroupsEditor->setObjectName("actionOpenGroupsEditor");
@@ -583,6 +703,7 @@ void MainWindow::setupMenuBar() {
   menuHelp->addAction(actionViewDocs);
   menuHelp->addAction(actionOpenFAQs);
   menuHelp->addAction(actionJoinDiscordServer);
+  menuHelp->addAction(actionViewDiagnostics);
   menuHelp->addSeparator();
   menuHelp->addAction(actionAbout);
 }
@@ -769,6 +890,8 @@ void MainWindow::translateUi() {
   /* translators: This string is an action in the Help menu. */
   actionJoinDiscordServer->setText(translate("&Join Discord Server"));
   /* translators: This string is an action in the Help menu. */
+  actionViewDiagnostics->setText(translate("View &Performance Diagnostics"));
+  /* translators: This string is an action in the Help menu. */
   actionAbout->setText(translate("&About"));
 
   // Translate sidebar.
@@ -810,6 +933,20 @@ void MainWindow::setIcons() {
   actionDiscardSort->setIcon(IconFactory::getDiscardSortIcon());
 }
 
+void MainWindow::updateIcons() {
+  setIcons();
+
+  sidebarPluginsView->reset();
+
+  const auto cardDelegate =
+      qobject_cast<CardDelegate*>(pluginCardsView->itemDelegate());
+
+  if (cardDelegate) {
+    cardDelegate->setIcons();
+    pluginCardsView->reset();
+  }
+}
+
 void MainWindow::enableGameActions() {
   menuGame->setEnabled(true);
   actionSort->setEnabled(state.GetCurrentGame().GetSettings().Id() !=
@@ -900,6 +1037,133 @@ void MainWindow::exitSortingState() {
   actionCopyLoadOrder->setDisabled(false);
 }
 
+void MainWindow::showSessionSnapshot() {
+  const auto logger = getLogger();
+
+  try {
+    const auto& game = state.GetCurrentGame();
+    const auto masterlistFingerprint =
+        GetFileFingerprint(game.MasterlistPath());
+    if (!masterlistFingerprint.has_value() || !game.IsInitialised()) {
+      return;
+    }
+
+    auto snapshot =
+        LoadSessionSnapshot(game.SessionSnapshotPath(),
+                            masterlistFingerprint.value(),
+                            GetFileFingerprints(game.GetLoadOrderFilePaths()));
+    if (!snapshot.has_value() || snapshot.value().plugins.empty()) {
+      return;
+    }
+
+    if (logger) {
+      logger->debug(
+          "Displaying the last session's snapshot of {} plugins while game "
+          "data is loaded",
+          snapshot.value().plugins.size());
+    }
+
+    // The snapshot doesn't include init messages, as they may have changed.
+    const auto& snapshotInfo = snapshot.value().generalInformation;
+    auto generalMessages = state.getInitMessages();
+    generalMessages.insert(generalMessages.end(),
+                           snapshotInfo.generalMessages.begin(),
+                           snapshotInfo.generalMessages.end());
+
+    // Set this first so that no editing actions are enabled as the snapshot
+    // is displayed.
+    isShowingSessionSnapshot = true;
+
+    actionSettings->setDisabled(true);
+    actionUpdateMasterlists->setDisabled(true);
+    actionBackupData->setDisabled(true);
+    actionOpenGroupsEditor->setDisabled(true);
+    actionRefreshContent->setDisabled(true);
+    actionClearAllUserMetadata->setDisabled(true);
+    actionEditMetadata->setDisabled(true);
+    actionClearMetadata->setDisabled(true);
+    actionCopyLoadOrder->setDisabled(true);
+    gameComboBox->setDisabled(true);
+
+    // The snapshot's plugins aren't loaded yet, and querying the game for
+    // them would race the query that is loading them.
+    filtersWidget->setOverlapFilterEnabled(false);
+
+    pluginItemModel->setPluginItems(std::move(snapshot.value().plugins));
+    pluginItemModel->setGeneralInformation(
+        snapshotInfo.gameSupportsLightPlugins,
+        snapshotInfo.masterlistRevision,
+        snapshotInfo.preludeRevision,
+        generalMessages);
+  } catch (const std::exception& e) {
+    // The snapshot is only an optimisation, so carry on without it.
+    if (logger) {
+      logger->warn("Failed to load the last session's snapshot: {}",
+                   e.what());
+    }
+  }
+}
+
+void MainWindow::exitSessionSnapshotState() {
+  isShowingSessionSnapshot = false;
+
+  statusBar()->clearMessage();
+
+  actionSettings->setEnabled(true);
+  actionUpdateMasterlists->setEnabled(true);
+  actionBackupData->setEnabled(true);
+  actionOpenGroupsEditor->setEnabled(true);
+  actionRefreshContent->setEnabled(true);
+  actionClearAllUserMetadata->setEnabled(true);
+  actionEditMetadata->setEnabled(true);
+  actionClearMetadata->setEnabled(true);
+  actionCopyLoadOrder->setEnabled(true);
+  gameComboBox->setEnabled(true);
+
+  filtersWidget->setOverlapFilterEnabled(true);
+}
+
+void MainWindow::discardSessionSnapshot() {
+  exitSessionSnapshotState();
+
+  pluginItemModel->setPluginItems({});
+  pluginItemModel->setGeneralMessages(state.getInitMessages());
+}
+
+void MainWindow::saveSessionSnapshot() {
+  // Don't overwrite the last snapshot with itself or with a load order that
+  // hasn't been applied.
+  if (!state.HasCurrentGame() || isShowingSessionSnapshot ||
+      state.HasUnappliedChanges() ||
+      pluginItemModel->getPluginItems().empty()) {
+    return;
+  }
+
+  const auto& game = state.GetCurrentGame();
+  const auto masterlistFingerprint = GetFileFingerprint(game.MasterlistPath());
+  if (!masterlistFingerprint.has_value() || !game.IsInitialised()) {
+    return;
+  }
+
+  SessionSnapshot snapshot;
+  snapshot.masterlistFingerprint = masterlistFingerprint.value();
+  snapshot.loadOrderFileFingerprints =
+      GetFileFingerprints(game.GetLoadOrderFilePaths());
+  snapshot.generalInformation = pluginItemModel->getGeneralInfo();
+  snapshot.plugins = pluginItemModel->getPluginItems();
+
+  auto& generalMessages = snapshot.generalInformation.generalMessages;
+  generalMessages.erase(std::remove_if(generalMessages.begin(),
+                                       generalMessages.end(),
+                                       [](const SourcedMessage& message) {
+                                         return message.source ==
+                                                MessageSource::init;
+                                       }),
+                        generalMessages.end());
+
+  SaveSessionSnapshot(game.SessionSnapshotPath(), snapshot);
+}
+
 void MainWindow::loadGame(bool isOnLOOTStartup) {
   auto progressUpdater = new ProgressUpdater();
 
@@ -908,24 +1172,31 @@ void MainWindow::loadGame(bool isOnLOOTStartup) {
     emit progressUpdater->progressUpdate(QString::fromStdString(message));
   };
 
+  // When not starting up, the game data is being explicitly refreshed, so
+  // reload all plugins in case a change was missed.
   std::unique_ptr<Query> query =
       std::make_unique<GetGameDataQuery>(state.GetCurrentGame(),
                                          state.getSettings().getLanguage(),
+                                         !isOnLOOTStartup,
                                          sendProgressUpdate);
 
   const auto handler = isOnLOOTStartup
                            ? &MainWindow::handleStartupGameDataLoaded
                            : &MainWindow::handleRefreshGameDataLoaded;
 
-  executeBackgroundQuery(std::move(query), handler, progressUpdater);
+  executeBackgroundQuery(createGeneralInformationQueryTask(std::move(query)),
+                         handler,
+                         progressUpdater);
 }
 
-void MainWindow::updateCounts(
-    const std::vector<SourcedMessage>& generalMessages,
-    const std::vector<PluginItem>& plugins) {
-  const auto counters = GeneralInformationCounters(generalMessages, plugins);
-  const auto hiddenMessageCount =
-      countHiddenMessages(plugins, filtersWidget->getCardContentFiltersState());
+void MainWindow::updateCounts() {
+  const auto counters =
+      GeneralInformationCounters(pluginItemModel->getGeneralMessages(),
+                                 *pluginItemModel->getPluginTable());
+  // The hidden message count is kept up to date as plugins and the card
+  // content filters change, and the filter model only re-filters the rows
+  // that have changed, so neither count needs a pass over every plugin.
+  const auto hiddenMessageCount = hiddenMessageCounter.getTotal();
   const auto hiddenPluginCount =
       counters.totalPlugins - static_cast<size_t>(proxyModel->rowCount()) + 1;
 
@@ -934,39 +1205,25 @@ void MainWindow::updateCounts(
 }
 
 void MainWindow::updateGeneralInformation() {
-  const auto preludeInfo = getFileRevisionSummary(state.getPreludePath(),
-                                                  FileType::MasterlistPrelude);
-  auto initMessages = state.getInitMessages();
-
-  if (!state.HasCurrentGame()) {
-    pluginItemModel->setGeneralInformation(
-        false, FileRevisionSummary(), preludeInfo, initMessages);
-    return;
-  }
-
-  const auto masterlistInfo = getFileRevisionSummary(
-      state.GetCurrentGame().MasterlistPath(), FileType::Masterlist);
-
-  const auto gameMessages =
-      state.GetCurrentGame().GetMessages(state.getSettings().getLanguage());
-  initMessages.insert(
-      initMessages.end(), gameMessages.begin(), gameMessages.end());
+  // Use the general information that was loaded alongside the results that
+  // are being handled, if there is any, as it's expensive to get.
+  const auto generalInformation = loadedGeneralInformation.has_value()
+                                      ? loadedGeneralInformation.value()
+                                      : getGeneralInformation(state);
 
   pluginItemModel->setGeneralInformation(
-      SupportsLightPlugins(state.GetCurrentGame().GetSettings().Type()),
-      masterlistInfo,
-      preludeInfo,
-      initMessages);
+      generalInformation.gameSupportsLightPlugins,
+      generalInformation.masterlistRevision,
+      generalInformation.preludeRevision,
+      generalInformation.generalMessages);
 }
 
 void MainWindow::updateGeneralMessages() {
-  auto initMessages = state.getInitMessages();
-  auto gameMessages =
-      state.GetCurrentGame().GetMessages(state.getSettings().getLanguage());
-  initMessages.insert(
-      initMessages.end(), gameMessages.begin(), gameMessages.end());
+  // This is called after messages have been added on the GUI thread, so any
+  // loaded general information is now out of date.
+  loadedGeneralInformation.reset();
 
-  pluginItemModel->setGeneralMessages(std::move(initMessages));
+  pluginItemModel->setGeneralMessages(getGeneralMessages(state));
 }
 
 void MainWindow::updateSidebarColumnWidths() {
@@ -1023,9 +1280,9 @@ void MainWindow::updateSidebarColumnWidths() {
 
 void MainWindow::setFiltersState(PluginFiltersState&& filtersState) {
   proxyModel->setFiltersState(std::move(filtersState));
+  handleContentFilterTimeout();
 
-  updateCounts(pluginItemModel->getGeneralMessages(),
-               pluginItemModel->getPluginItems());
+  updateCounts();
   refreshSearch();
 }
 
@@ -1034,24 +1291,83 @@ void MainWindow::setFiltersState(
     std::vector<std::string>&& overlappingPluginNames) {
   proxyModel->setFiltersState(std::move(filtersState),
                               std::move(overlappingPluginNames));
+  handleContentFilterTimeout();
 
-  updateCounts(pluginItemModel->getGeneralMessages(),
-               pluginItemModel->getPluginItems());
+  updateCounts();
   refreshSearch();
 }
 
+void MainWindow::handleContentFilterTimeout() {
+  if (!proxyModel->hasContentFilterTimedOut()) {
+    return;
+  }
+
+  const auto logger = getLogger();
+  if (logger) {
+    logger->warn(
+        "The content filter regex exceeded its time budget, so not all "
+        "plugins were checked.");
+  }
+
+  filtersWidget->showContentFilterTimedOutTooltip();
+}
+
 void MainWindow::refreshSearch() {
   on_searchDialog_textChanged(searchDialog->getSearchText());
 }
 
+void MainWindow::refreshSearch(const std::vector<RowRange>& rowRanges) {
+  if (isSearchPending) {
+    // The pending search may have been cancelled before it searched rows
+    // outside the given ranges, so they need to be searched too.
+    refreshSearch();
+    return;
+  }
+
+  const auto matcher = getSearchMatcher(searchDialog->getSearchText());
+
+  // If there's no search text there are no search results to refresh, and an
+  // invalid regex never replaces the current search results.
+  if (matcher.isEmpty() || !matcher.isValid()) {
+    return;
+  }
+
+  // Search the changed rows that are visible, and clear the search results of
+  // the changed rows that aren't.
+  std::vector<int> searchedRows;
+  std::vector<int> visibleRows;
+  for (const auto& range : rowRanges) {
+    for (auto row = std::max(range.first, 1); row <= range.last; row += 1) {
+      searchedRows.push_back(row);
+
+      const auto sourceIndex = pluginItemModel->index(row, 0);
+      if (proxyModel->mapFromSource(sourceIndex).isValid()) {
+        visibleRows.push_back(row);
+      }
+    }
+  }
+
+  startSearch(matcher, visibleRows, std::move(searchedRows));
+}
+
+void MainWindow::startSearch(const ContentMatcher& matcher,
+                             const std::vector<int>& rows,
+                             std::optional<std::vector<int>>&& searchedRows) {
+  partialSearchRows = std::move(searchedRows);
+  isSearchPending = true;
+
+  searchEngine->search(matcher, pluginItemModel->getSearchIndex(rows));
+}
+
 void MainWindow::refreshPluginRawData(const std::string& pluginName) {
   const auto loadOrder = state.GetCurrentGame().GetLoadOrder();
 
-  for (int i = 1; i < pluginItemModel->rowCount(); i += 1) {
-    const auto index = pluginItemModel->index(i, 0);
-    const auto pluginItem = index.data(RawDataRole).value<PluginItem>();
-
-    if (pluginItem.name == pluginName) {
+  // Look up the plugin's row without copying every plugin item out of the
+  // model.
+  const auto& pluginItems = pluginItemModel->getPluginItems();
+  for (size_t i = 0; i < pluginItems.size(); i += 1) {
+    if (pluginItems.at(i).name == pluginName) {
+      const auto index = pluginItemModel->index(static_cast<int>(i) + 1, 0);
       const auto& plugin = *state.GetCurrentGame().GetPlugin(pluginName);
       const auto newPluginItem = PluginItem(
           plugin,
@@ -1068,8 +1384,9 @@ void MainWindow::refreshPluginRawData(const std::string& pluginName) {
 }
 
 bool MainWindow::hasErrorMessages() const {
-  const auto counters = GeneralInformationCounters(
-      pluginItemModel->getGeneralMessages(), pluginItemModel->getPluginItems());
+  const auto counters =
+      GeneralInformationCounters(pluginItemModel->getGeneralMessages(),
+                                 *pluginItemModel->getPluginTable());
 
   return counters.errors != 0;
 }
@@ -1100,13 +1417,21 @@ void MainWindow::sortPlugins(bool isAutoSort) {
     emit progressUpdater->progressUpdate(QString::fromStdString(message));
   };
 
+  std::vector<PluginItemInputs> previousItems;
+  previousItems.reserve(pluginItemModel->getPluginItems().size());
+  for (const auto& pluginItem : pluginItemModel->getPluginItems()) {
+    previousItems.emplace_back(pluginItem);
+  }
+
   std::unique_ptr<Query> sortPluginsQuery =
       std::make_unique<SortPluginsQuery>(state.GetCurrentGame(),
                                          state,
                                          state.getSettings().getLanguage(),
+                                         std::move(previousItems),
                                          sendProgressUpdate);
 
-  auto sortTask = new QueryTask(std::move(sortPluginsQuery));
+  auto sortTask =
+      createGeneralInformationQueryTask(std::move(sortPluginsQuery));
 
   const auto sortHandler = isAutoSort ? &MainWindow::handlePluginsAutoSorted
                                       : &MainWindow::handlePluginsManualSorted;
@@ -1120,6 +1445,16 @@ void MainWindow::sortPlugins(bool isAutoSort) {
   executeBackgroundTasks(executor, progressUpdater, sortHandler);
 }
 
+void MainWindow::applySortedLoadOrder(
+    void (MainWindow::*onApplied)(QueryResult)) {
+  handleProgressUpdate(translate("Applying sorted load order..."));
+
+  std::unique_ptr<Query> query = std::make_unique<ApplySortQuery<>>(
+      state.GetCurrentGame(), state, pluginItemModel->getPluginNames());
+
+  executeBackgroundQuery(std::move(query), onApplied, nullptr);
+}
+
 void MainWindow::showFirstRunDialog() {
   auto zipPath = createBackup();
 
@@ -1229,6 +1564,56 @@ PluginItem MainWindow::getSelectedPlugin() const {
   return indexData.value<PluginItem>();
 }
 
+QJsonObject MainWindow::collectDiagnostics() const {
+  const auto pluginTable = pluginItemModel->getPluginTable();
+  const auto cardDelegate =
+      qobject_cast<const CardDelegate*>(pluginCardsView->itemDelegate());
+  const auto& threadPool = GetThreadPool();
+
+  QJsonObject caches{
+      {"cardSizing", ToJson(cardSizingCache.getStatistics())},
+      {"iconPixmaps", ToJson(IconFactory::getPixmapCacheStatistics())},
+      {"iconAtlases", ToJson(IconFactory::getAtlasCacheStatistics())},
+  };
+  if (cardDelegate != nullptr) {
+    caches.insert("cardSizeHints",
+                  ToJson(cardDelegate->getSizeHintCacheStatistics()));
+  }
+
+  auto workerThreads = ToJson(GetWorkerThreadActivity());
+  workerThreads.insert("threadPoolSize",
+                       static_cast<qint64>(threadPool.size()));
+  workerThreads.insert("threadPoolBusyThreads",
+                       static_cast<qint64>(threadPool.getBusyThreadCount()));
+
+  return QJsonObject{
+      {"lootVersion", QString::fromStdString(gui::Version::string())},
+      {"timestamp",
+       QDateTime::currentDateTimeUtc().toString(Qt::ISODateWithMs)},
+      {"taskDurations", ToJson(GetRecentTaskDurations())},
+      {"plugins",
+       QJsonObject{
+           {"count", static_cast<qint64>(pluginTable->size())},
+           {"messageCount",
+            static_cast<qint64>(pluginTable->getTotalMessageCount())},
+           {"warningCount",
+            static_cast<qint64>(pluginTable->getTotalWarningCount())},
+           {"errorCount",
+            static_cast<qint64>(pluginTable->getTotalErrorCount())},
+           {"generalMessageCount",
+            static_cast<qint64>(
+                pluginItemModel->getGeneralMessages().size())},
+       }},
+      {"caches", caches},
+      {"memory",
+       QJsonObject{
+           {"pluginItemModelBytes",
+            static_cast<qint64>(pluginItemModel->estimateMemoryUsage())},
+       }},
+      {"workerThreads", workerThreads},
+  };
+}
+
 void MainWindow::closeEvent(QCloseEvent* event) {
   if (state.HasUnappliedChanges()) {
     auto changeType = pluginEditorWidget->isVisible()
@@ -1278,6 +1663,21 @@ void MainWindow::closeEvent(QCloseEvent* event) {
     }
   }
 
+  try {
+    saveSessionSnapshot();
+  } catch (const std::exception& e) {
+    auto logger = getLogger();
+    if (logger) {
+      logger->error("Failed to save the session snapshot: {}", e.what());
+    }
+  }
+
+  try {
+    userMetadataSaver.Flush();
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+
   try {
     state.getSettings().storeLastGame(
         state.GetCurrentGame().GetSettings().FolderName());
@@ -1301,12 +1701,39 @@ void MainWindow::closeEvent(QCloseEvent* event) {
   event->accept();
 }
 
+QueryTask* MainWindow::createGeneralInformationQueryTask(
+    std::unique_ptr<Query> query) {
+  const auto task = new QueryTask(std::move(query));
+
+  loadGeneralInformationAfter(task);
+
+  return task;
+}
+
+void MainWindow::loadGeneralInformationAfter(Task* task) {
+  // The general information is got in the worker thread after the task has
+  // done its work.
+  task->setGeneralInformationGetter(
+      [this]() { return getGeneralInformation(state); });
+
+  connect(task,
+          &Task::generalInformationLoaded,
+          this,
+          &MainWindow::handleGeneralInformationLoaded);
+}
+
 void MainWindow::executeBackgroundQuery(
     std::unique_ptr<Query> query,
     void (MainWindow::*onComplete)(QueryResult),
     ProgressUpdater* progressUpdater) {
-  auto task = new QueryTask(std::move(query));
+  executeBackgroundQuery(
+      new QueryTask(std::move(query)), onComplete, progressUpdater);
+}
 
+void MainWindow::executeBackgroundQuery(
+    QueryTask* task,
+    void (MainWindow::*onComplete)(QueryResult),
+    ProgressUpdater* progressUpdater) {
   connect(task, &Task::finished, this, onComplete);
   connect(task, &Task::error, this, &MainWindow::handleError);
 
@@ -1319,6 +1746,20 @@ void MainWindow::executeBackgroundTasks(
     TaskExecutor* executor,
     const ProgressUpdater* progressUpdater,
     void (MainWindow::*onComplete)(std::vector<QueryResult>)) {
+  try {
+    userMetadataSaver.Flush();
+  } catch (...) {
+    // Don't run the tasks, as they may discard the unsaved edits.
+    if (progressUpdater != nullptr) {
+      connect(executor,
+              &QObject::destroyed,
+              progressUpdater,
+              &QObject::deleteLater);
+    }
+    executor->deleteLater();
+    throw;
+  }
+
   if (progressUpdater != nullptr) {
     connect(progressUpdater,
             &ProgressUpdater::progressUpdate,
@@ -1351,6 +1792,11 @@ void MainWindow::executeBackgroundTasks(
 void MainWindow::handleError(const std::string& message) {
   progressDialog->reset();
 
+  if (isShowingSessionSnapshot) {
+    // The snapshot can't be validated, so don't leave it displayed.
+    discardSessionSnapshot();
+  }
+
   QMessageBox::critical(
       this, translate("Error"), QString::fromStdString(message));
 }
@@ -1370,20 +1816,12 @@ void MainWindow::handleException(const std::exception& exception) {
   handleError(message);
 }
 
-void MainWindow::handleQueryException(const Query& query,
-                                      const std::exception& exception) {
-  auto logger = getLogger();
-  if (logger) {
-    logger->error("Caught an exception: {}", exception.what());
-  }
-
-  handleError(query.getErrorMessage());
-}
-
 void MainWindow::handleGameDataLoaded(QueryResult result) {
   progressDialog->reset();
 
-  pluginItemModel->setPluginItems(std::move(std::get<PluginItems>(result)));
+  // Only update the rows that differ from the displayed plugins, whether those
+  // come from a session snapshot, the previous sort or the previous load.
+  pluginItemModel->applyPluginItems(std::move(std::get<PluginItems>(result)));
 
   updateGeneralInformation();
 
@@ -1393,6 +1831,21 @@ void MainWindow::handleGameDataLoaded(QueryResult result) {
       state.GetCurrentGame().GetKnownBashTags());
 
   enableGameActions();
+
+  if (isShowingSessionSnapshot) {
+    exitSessionSnapshotState();
+
+    // The selection may have changed while the snapshot was displayed.
+    const auto selectedRows =
+        sidebarPluginsView->selectionModel()->selectedRows();
+    const auto hasPluginSelected =
+        std::any_of(selectedRows.begin(),
+                    selectedRows.end(),
+                    [](const QModelIndex& index) { return index.row() > 0; });
+    if (hasPluginSelected) {
+      enablePluginActions();
+    }
+  }
 }
 
 bool MainWindow::handlePluginsSorted(std::vector<QueryResult> results) {
@@ -1402,7 +1855,9 @@ bool MainWindow::handlePluginsSorted(std::vector<QueryResult> results) {
 
   filtersWidget->resetOverlapAndGroupsFilters();
 
-  auto sortedPlugins = std::get<PluginItems>(results.back());
+  auto sortedPlugins =
+      applySortResult(pluginItemModel->getPluginItems(),
+                      std::get<SortPluginsResult>(std::move(results.back())));
 
   if (sortedPlugins.empty()) {
     // If there was a sorting failure the array of plugins will be empty.
@@ -1415,7 +1870,7 @@ bool MainWindow::handlePluginsSorted(std::vector<QueryResult> results) {
                   "General Information section."));
 
     // Plugins didn't change but general messages may have.
-    updateGeneralMessages();
+    updateGeneralInformation();
     return false;
   }
 
@@ -1546,19 +2001,30 @@ void MainWindow::on_actionUpdateMasterlists_triggered() {
 
     tasks.push_back(preludeTask);
 
+    std::vector<MasterlistUpdateTarget> targets;
     for (const auto& settings : state.getSettings().getGameSettings()) {
       // Masterlist update assumes that the game folder exists, so ensure that.
       InitLootGameFolder(state.getLootDataPath(), settings);
 
-      const auto task = new UpdateMasterlistTask(
+      targets.push_back(MasterlistUpdateTarget{
           settings.FolderName(),
           settings.MasterlistSource(),
-          GetMasterlistPath(state.getLootDataPath(), settings));
+          GetMasterlistPath(state.getLootDataPath(), settings)});
+    }
 
-      connect(task, &Task::error, this, &MainWindow::handleError);
+    // Use a single task for all the masterlists so that games that share a
+    // masterlist source only cause it to be fetched once.
+    const auto masterlistsTask = new UpdateMasterlistsTask(targets);
 
-      tasks.push_back(task);
-    }
+    // Failures to update individual masterlists are reported once all the
+    // tasks have finished, by handleMasterlistsUpdated().
+    connect(masterlistsTask, &Task::error, this, &MainWindow::handleError);
+
+    // The prelude is updated in parallel, so its revision is refreshed once
+    // all the tasks have finished if it was updated.
+    loadGeneralInformationAfter(masterlistsTask);
+
+    tasks.push_back(masterlistsTask);
 
     handleProgressUpdate(translate("Updating all masterlists..."));
 
@@ -1615,7 +2081,8 @@ void MainWindow::on_actionOpenGroupsEditor_triggered() {
     groupsEditor->setGroups(state.GetCurrentGame().GetMasterlistGroups(),
                             state.GetCurrentGame().GetUserGroups(),
                             installedPluginGroups,
-                            groupNodePositions);
+                            groupNodePositions,
+                            state.GetCurrentGame().GroupLayoutCachePath());
 
     groupsEditor->show();
   } catch (const std::exception& e) {
@@ -1728,6 +2195,8 @@ void MainWindow::on_actionClearAllUserMetadata_triggered() {
 
     auto result = query.executeLogic();
 
+    userMetadataSaver.Schedule();
+
     // Clearing all user metadata can clear general messages (though
     // user-defined general messages aren't editable through the LOOT GUI),
     // change the known Bash Tags (though again they aren't editable in the GUI)
@@ -1913,6 +2382,8 @@ void MainWindow::on_actionClearMetadata_triggered() {
 
     auto result = query.executeLogic();
 
+    userMetadataSaver.Schedule();
+
     // The result is the changed plugin's derived metadata. Update the
     // model's data and also the message counts.
 
@@ -1944,7 +2415,7 @@ void MainWindow::on_actionClearMetadata_triggered() {
 void MainWindow::on_actionViewDocs_triggered() {
   try {
     const auto logger = getLogger();
-    if (logger) {
+    if (isTraceLoggingEnabled(logger)) {
       logger->trace("Opening LOOT's readme.");
     }
 
@@ -1969,7 +2440,7 @@ void MainWindow::on_actionViewDocs_triggered() {
 void MainWindow::on_actionOpenFAQs_triggered() {
   try {
     const auto logger = getLogger();
-    if (logger) {
+    if (isTraceLoggingEnabled(logger)) {
       logger->trace("Opening LOOT's FAQs.");
     }
 
@@ -1983,7 +2454,7 @@ void MainWindow::on_actionOpenFAQs_triggered() {
 void MainWindow::on_actionOpenLOOTDataFolder_triggered() {
   try {
     const auto logger = getLogger();
-    if (logger) {
+    if (isTraceLoggingEnabled(logger)) {
       logger->trace("Opening LOOT's local appdata folder.");
     }
 
@@ -1997,6 +2468,12 @@ void MainWindow::on_actionJoinDiscordServer_triggered() {
   QDesktopServices::openUrl(QUrl("https://loot.github.io/discord/"));
 }
 
+void MainWindow::on_actionViewDiagnostics_triggered() {
+  diagnosticsDialog->show();
+  diagnosticsDialog->raise();
+  diagnosticsDialog->activateWindow();
+}
+
 void MainWindow::on_actionAbout_triggered() {
   try {
     std::string textTemplate = R"(
@@ -2057,6 +2534,15 @@ void MainWindow::on_gameComboBox_activated(int index) {
       return;
     }
 
+    try {
+      saveSessionSnapshot();
+    } catch (const std::exception& e) {
+      auto logger = getLogger();
+      if (logger) {
+        logger->error("Failed to save the session snapshot: {}", e.what());
+      }
+    }
+
     auto progressUpdater = new ProgressUpdater();
 
     // This lambda will run from the worker thread.
@@ -2087,24 +2573,7 @@ void MainWindow::on_actionSort_triggered() {
 
 void MainWindow::on_actionApplySort_triggered() {
   try {
-    auto sortedPluginNames = pluginItemModel->getPluginNames();
-
-    auto query =
-        ApplySortQuery<>(state.GetCurrentGame(), state, sortedPluginNames);
-
-    try {
-      query.executeLogic();
-
-      exitSortingState();
-
-      if (state.GetCurrentGame().IsLoadOrderAmbiguous()) {
-        actionFixAmbiguousLoadOrder->setEnabled(true);
-
-        showAmbiguousLoadOrderSetWarning(this, state);
-      }
-    } catch (const std::exception& e) {
-      handleQueryException(query, e);
-    }
+    applySortedLoadOrder(&MainWindow::handleSortApplied);
   } catch (const std::exception& e) {
     handleException(e);
   }
@@ -2115,28 +2584,14 @@ void MainWindow::on_actionDiscardSort_triggered() {
     auto query = CancelSortQuery(state.GetCurrentGame(), state);
 
     auto result = query.executeLogic();
+    const auto& loadOrder = std::get<CancelSortResult>(result);
 
-    auto pluginItems = pluginItemModel->getPluginItems();
-
-    std::vector<PluginItem> newPluginItems;
-    newPluginItems.reserve(pluginItems.size());
-    for (const auto& pluginPair : std::get<CancelSortResult>(result)) {
-      auto pluginName = pluginPair.first;
-
-      auto it = std::find_if(pluginItems.cbegin(),
-                             pluginItems.cend(),
-                             [&](const auto& pluginItem) {
-                               return pluginItem.name == pluginName;
-                             });
+    // The sorted items hold the same plugin data as the pre-sort items, so
+    // they only need to be put back into the pre-sort load order.
+    auto newPluginItems =
+        reorderPluginItems(pluginItemModel->getPluginItems(), loadOrder);
 
-      if (it != pluginItems.end()) {
-        auto newPluginItem = *it;
-        newPluginItem.loadOrderIndex = pluginPair.second;
-        newPluginItems.push_back(newPluginItem);
-      }
-    }
-
-    pluginItemModel->setPluginItems(std::move(newPluginItems));
+    pluginItemModel->applyPluginItems(std::move(newPluginItems));
 
     updateGeneralMessages();
 
@@ -2161,6 +2616,10 @@ void MainWindow::on_actionUpdateMasterlist_triggered() {
 
     connect(masterlistTask, &Task::error, this, &MainWindow::handleError);
 
+    // The masterlist is updated after the prelude, so the general information
+    // is up to date once it has been updated.
+    loadGeneralInformationAfter(masterlistTask);
+
     const auto executor =
         new SequentialTaskExecutor(this, {preludeTask, masterlistTask});
 
@@ -2180,7 +2639,8 @@ void MainWindow::on_sidebarPluginsView_customContextMenuRequested(
     const QPoint& position) {
   const auto itemIndex = sidebarPluginsView->indexAt(position);
 
-  if (!itemIndex.isValid() || itemIndex.row() == 0) {
+  if (!itemIndex.isValid() || itemIndex.row() == 0 ||
+      isShowingSessionSnapshot) {
     return;
   }
 
@@ -2214,7 +2674,7 @@ void MainWindow::handleSidebarPluginsSelectionChanged(
     }
   }
 
-  if (hasPluginSelected) {
+  if (hasPluginSelected && !isShowingSessionSnapshot) {
     enablePluginActions();
   } else {
     disablePluginActions();
@@ -2247,7 +2707,8 @@ void MainWindow::on_pluginCardsView_customContextMenuRequested(
     const QPoint& position) {
   const auto itemIndex = pluginCardsView->indexAt(position);
 
-  if (!itemIndex.isValid() || itemIndex.row() == 0) {
+  if (!itemIndex.isValid() || itemIndex.row() == 0 ||
+      isShowingSessionSnapshot) {
     return;
   }
 
@@ -2265,57 +2726,117 @@ void MainWindow::on_pluginItemModel_dataChanged(const QModelIndex& topLeft,
     return;
   }
 
+  if (roles.size() == 1 && roles.contains(SearchResultRole)) {
+    // Search results don't affect card sizes.
+    return;
+  }
+
+  // The cache must be updated before the view next lays out or paints the
+  // changed rows, so this can't wait for the coalesced changes. It only
+  // touches the changed rows.
   cardSizingCache.update(topLeft, bottomRight);
+}
 
-  if (roles.isEmpty() || roles.contains(CardContentFiltersRole)) {
-    proxyModel->invalidate();
+void MainWindow::on_pluginItemChanges_changed(const DataChanges& changes) {
+  // The filter model doesn't need to be invalidated here: it re-filters rows
+  // as their dataChanged signals are emitted, and a change to the card content
+  // filters is signalled for every plugin row.
+  const auto filtersChanged = changes.hasRole(CardContentFiltersRole);
+
+  if (!filtersChanged && !changes.hasRowsChanged &&
+      !changes.hasRole(RawDataRole)) {
+    return;
   }
 
-  if (roles.isEmpty() || roles.contains(RawDataRole) ||
-      roles.contains(CardContentFiltersRole)) {
-    updateCounts(pluginItemModel->getGeneralMessages(),
-                 pluginItemModel->getPluginItems());
-    refreshSearch();
+  const auto& pluginItems = pluginItemModel->getPluginItems();
+  if (filtersChanged || changes.hasRowsChanged) {
+    // Every plugin's hidden messages may have changed, or their rows no longer
+    // line up with their counts.
+    hiddenMessageCounter.reset(pluginItems,
+                               pluginItemModel->getCardContentFiltersState());
+  } else {
+    for (const auto& range : changes.rowRanges) {
+      // Row 0 is the general information row, which has no plugin.
+      if (range.last > 0) {
+        hiddenMessageCounter.update(
+            pluginItems,
+            static_cast<size_t>(std::max(range.first, 1) - 1),
+            static_cast<size_t>(range.last - 1));
+      }
+    }
   }
 
-  if (roles.isEmpty() || roles.contains(RawDataRole)) {
-    // Also update the plugin name lists in the filters sidebar panel and the
-    // metadata editor's autocompletions in case raw data changed because the
-    // game was changed or content was refreshed.
-    auto pluginNames = pluginItemModel->getPluginNames();
+  updateCounts();
 
-    filtersWidget->setPlugins(pluginNames);
-    pluginEditorWidget->setFilenameCompletions(pluginNames);
+  // Any search that was running when rows changed has been cancelled, so it
+  // must be redone. Otherwise only the changed rows need to be searched again,
+  // and the general information row isn't searched, so changes to only it
+  // can't change the search results.
+  if (filtersChanged || changes.hasRowsChanged) {
+    refreshSearch();
+  } else if (!changes.rowRanges.empty() && changes.rowRanges.back().last > 0) {
+    refreshSearch(changes.rowRanges);
   }
 }
 
 void MainWindow::on_pluginItemModel_rowsInserted(const QModelIndex&,
                                                  int first,
                                                  int last) {
+  // Search results are rows, so a running search's results are now stale.
+  // The search is redone when the coalesced changes are handled.
+  searchEngine->cancel();
+
+  cardSizingCache.insertRows(first, last);
   cardSizingCache.update(pluginItemModel, first, last);
 }
 
+void MainWindow::on_pluginItemModel_rowsRemoved(const QModelIndex&,
+                                                int first,
+                                                int last) {
+  searchEngine->cancel();
+
+  cardSizingCache.removeRows(first, last);
+}
+
+void MainWindow::on_pluginItemModel_rowsMoved(const QModelIndex&,
+                                              int start,
+                                              int end,
+                                              const QModelIndex&,
+                                              int row) {
+  searchEngine->cancel();
+
+  cardSizingCache.moveRows(start, end, row);
+}
+
+void MainWindow::on_pluginItemModel_layoutChanged() {
+  searchEngine->cancel();
+
+  // Rows may have been reordered arbitrarily, so re-key every row. The cards
+  // themselves are reused.
+  cardSizingCache.update(pluginItemModel);
+}
+
 void MainWindow::on_pluginEditorWidget_accepted(PluginMetadata userMetadata) {
   try {
     auto logger = getLogger();
     auto pluginName = userMetadata.GetName();
 
     // Erase any existing userlist entry.
-    if (logger) {
+    if (isTraceLoggingEnabled(logger)) {
       logger->trace("Erasing the existing userlist entry.");
     }
     state.GetCurrentGame().ClearUserMetadata(pluginName);
 
     // Add a new userlist entry if necessary.
     if (!userMetadata.HasNameOnly()) {
-      if (logger) {
+      if (isTraceLoggingEnabled(logger)) {
         logger->trace("Adding new metadata to new userlist entry.");
       }
       state.GetCurrentGame().AddUserMetadata(userMetadata);
     }
 
     // Save edited userlist.
-    state.GetCurrentGame().SaveUserMetadata();
+    userMetadataSaver.Schedule();
 
     pluginItemModel->setEditorPluginName(std::nullopt);
 
@@ -2350,7 +2871,7 @@ void MainWindow::on_filtersWidget_overlapFilterChanged(
       return;
     }
 
-    if (!state.HasCurrentGame()) {
+    if (!state.HasCurrentGame() || isShowingSessionSnapshot) {
       return;
     }
 
@@ -2376,6 +2897,9 @@ void MainWindow::on_filtersWidget_cardContentFilterChanged(
 void MainWindow::on_settingsDialog_accepted() {
   try {
     const auto currentTheme = state.getSettings().getTheme();
+
+    // Recording the settings may replace the current game's object.
+    userMetadataSaver.Flush();
     settingsDialog->recordInputValues(state);
 
     state.getSettings().save(state.getSettingsPath());
@@ -2413,7 +2937,7 @@ void MainWindow::on_groupsEditor_accepted() {
       refreshPluginRawData(pluginName);
     }
 
-    state.GetCurrentGame().SaveUserMetadata();
+    userMetadataSaver.Schedule();
 
     SaveGroupNodePositions(state.GetCurrentGame().GroupNodePositionsPath(),
                            groupsEditor->getNodePositions());
@@ -2425,34 +2949,30 @@ void MainWindow::on_groupsEditor_accepted() {
 void MainWindow::on_searchDialog_finished() { searchDialog->reset(); }
 
 void MainWindow::on_searchDialog_textChanged(const QVariant& text) {
-  const auto isEmpty =
-      (text.userType() == QMetaType::QString && text.toString().isEmpty()) ||
-      (text.userType() == QMetaType::QRegularExpression &&
-       text.toRegularExpression().pattern().isEmpty());
+  const auto matcher = getSearchMatcher(text);
 
-  if (isEmpty) {
-    proxyModel->clearSearchResults();
+  if (matcher.isEmpty()) {
+    searchEngine->cancel();
+    partialSearchRows = std::nullopt;
+    isSearchPending = false;
+    pluginItemModel->clearSearchResults();
     return;
   }
 
-  if (text.userType() == QMetaType::QRegularExpression &&
-      !text.toRegularExpression().isValid()) {
+  if (!matcher.isValid()) {
     // Do nothing if given an invalid regex.
+    return;
   }
 
-  const auto flags = text.userType() == QMetaType::QRegularExpression
-                         ? Qt::MatchRegularExpression | Qt::MatchWrap
-                         : Qt::MatchContains | Qt::MatchWrap;
-
-  auto results =
-      proxyModel->match(proxyModel->index(0, PluginItemModel::CARDS_COLUMN),
-                        ContentSearchRole,
-                        text,
-                        -1,
-                        flags);
+  // Only search the cards that are currently visible.
+  std::vector<int> rows;
+  rows.reserve(proxyModel->rowCount());
+  for (int row = 1; row < proxyModel->rowCount(); row += 1) {
+    const auto proxyIndex = proxyModel->index(row, 0);
+    rows.push_back(proxyModel->mapToSource(proxyIndex).row());
+  }
 
-  proxyModel->setSearchResults(results);
-  searchDialog->setSearchResults(results.size());
+  startSearch(matcher, rows, std::nullopt);
 }
 
 void MainWindow::on_searchDialog_currentResultChanged(size_t resultIndex) {
@@ -2462,6 +2982,27 @@ void MainWindow::on_searchDialog_currentResultChanged(size_t resultIndex) {
   pluginCardsView->scrollTo(proxyIndex, QAbstractItemView::PositionAtTop);
 }
 
+void MainWindow::on_diagnosticsDialog_refreshRequested() {
+  diagnosticsDialog->setDiagnostics(collectDiagnostics());
+}
+
+void MainWindow::on_searchEngine_finished(const std::vector<int>& rows) {
+  isSearchPending = false;
+
+  if (partialSearchRows.has_value()) {
+    pluginItemModel->updateSearchResults(partialSearchRows.value(), rows);
+    partialSearchRows = std::nullopt;
+  } else {
+    pluginItemModel->setSearchResults(rows);
+  }
+
+  searchDialog->setSearchResults(pluginItemModel->countSearchResults());
+}
+
+void MainWindow::on_searchEngine_timedOut() {
+  searchDialog->showSearchTimedOutTooltip();
+}
+
 void MainWindow::handleGameChanged(QueryResult result) {
   try {
     filtersWidget->setGameId(state.GetCurrentGame().GetSettings().Id());
@@ -2492,6 +3033,26 @@ void MainWindow::handleRefreshGameDataLoaded(QueryResult result) {
   }
 }
 
+void MainWindow::handlePrefetchedGameDataLoaded(QueryResult result) {
+  loadedGeneralInformation = prefetchedGameDataQuery->getGeneralInformation();
+
+  // The query may be the sender of the signal that called this function, so
+  // don't destroy it immediately.
+  prefetchedGameDataQuery.release()->deleteLater();
+  progressDialog->reset();
+
+  handleStartupGameDataLoaded(result);
+
+  // The general information was only valid for the prefetched result.
+  loadedGeneralInformation.reset();
+}
+
+void MainWindow::handlePrefetchedGameDataError(const std::string& message) {
+  prefetchedGameDataQuery.release()->deleteLater();
+
+  handleError(message);
+}
+
 void MainWindow::handleStartupGameDataLoaded(QueryResult result) {
   try {
     handleGameDataLoaded(result);
@@ -2538,17 +3099,38 @@ void MainWindow::handlePluginsAutoSorted(std::vector<QueryResult> results) {
     handlePluginsSorted(results);
 
     if (actionApplySort->isVisible()) {
-      actionApplySort->trigger();
+      // Quitting is deferred until the load order has been applied.
+      applySortedLoadOrder(&MainWindow::handleAutoSortApplied);
+    } else if (!hasErrorMessages()) {
+      on_actionQuit_triggered();
     }
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
 
-    if (!hasErrorMessages()) {
-      on_actionQuit_triggered();
+void MainWindow::handleSortApplied(QueryResult) {
+  try {
+    exitSortingState();
+
+    if (state.GetCurrentGame().IsLoadOrderAmbiguous()) {
+      actionFixAmbiguousLoadOrder->setEnabled(true);
+
+      showAmbiguousLoadOrderSetWarning(this, state);
     }
   } catch (const std::exception& e) {
     handleException(e);
   }
 }
 
+void MainWindow::handleAutoSortApplied(QueryResult result) {
+  handleSortApplied(result);
+
+  if (!hasErrorMessages()) {
+    on_actionQuit_triggered();
+  }
+}
+
 void MainWindow::handleMasterlistUpdated(std::vector<QueryResult> results) {
   try {
     const auto wasPreludeUpdated = std::get<bool>(results.at(0));
@@ -2567,6 +3149,11 @@ void MainWindow::handleMasterlistUpdated(std::vector<QueryResult> results) {
 
     state.GetCurrentGame().LoadMetadata();
 
+    // The masterlist's general messages have only just been loaded.
+    if (loadedGeneralInformation.has_value()) {
+      loadedGeneralInformation->generalMessages = getGeneralMessages(state);
+    }
+
     const auto pluginItems =
         GetPluginItems(state.GetCurrentGame().GetLoadOrder(),
                        state.GetCurrentGame(),
@@ -2600,15 +3187,25 @@ void MainWindow::handleMasterlistsUpdated(std::vector<QueryResult> results) {
     const auto logger = getLogger();
     const auto gamesSettings = state.getSettings().getGameSettings();
 
-    std::vector<std::string> updatedGameNames;
-    bool wasCurrentGameMasterlistUpdated{false};
+    MasterlistUpdateResults updateResults;
+    std::vector<std::string> updateErrors;
     for (const auto& result : results) {
-      if (!std::holds_alternative<MasterlistUpdateResult>(result)) {
-        continue;
+      if (std::holds_alternative<MasterlistsUpdateResult>(result)) {
+        const auto& taskResult = std::get<MasterlistsUpdateResult>(result);
+        updateResults.insert(updateResults.end(),
+                             taskResult.updates.begin(),
+                             taskResult.updates.end());
+        updateErrors.insert(updateErrors.end(),
+                            taskResult.errors.begin(),
+                            taskResult.errors.end());
+      } else if (std::holds_alternative<MasterlistUpdateResult>(result)) {
+        updateResults.push_back(std::get<MasterlistUpdateResult>(result));
       }
+    }
 
-      const auto updateResult = std::get<MasterlistUpdateResult>(result);
-
+    std::vector<std::string> updatedGameNames;
+    bool wasCurrentGameMasterlistUpdated{false};
+    for (const auto& updateResult : updateResults) {
       if (wasPreludeUpdated || updateResult.second) {
         const auto it =
             std::find_if(gamesSettings.begin(),
@@ -2634,13 +3231,25 @@ void MainWindow::handleMasterlistsUpdated(std::vector<QueryResult> results) {
       }
     }
 
+    if (wasPreludeUpdated && loadedGeneralInformation.has_value()) {
+      // The prelude task may have finished after the general information was
+      // loaded.
+      loadedGeneralInformation->preludeRevision = getFileRevisionSummary(
+          state.getPreludePath(), FileType::MasterlistPrelude);
+    }
+
     if (updatedGameNames.empty()) {
       progressDialog->reset();
-      showNotification(translate("No masterlist updates were necessary."));
+
+      if (updateErrors.empty()) {
+        showNotification(translate("No masterlist updates were necessary."));
+      }
 
       // Update general info as the timestamp may have changed and if
       // metadata was previously missing it can now be displayed.
       updateGeneralInformation();
+
+      showMasterlistUpdateErrors(updateErrors);
       return;
     }
 
@@ -2648,6 +3257,11 @@ void MainWindow::handleMasterlistsUpdated(std::vector<QueryResult> results) {
       // Need to reload the current game data.
       state.GetCurrentGame().LoadMetadata();
 
+      // The masterlist's general messages have only just been loaded.
+      if (loadedGeneralInformation.has_value()) {
+        loadedGeneralInformation->generalMessages = getGeneralMessages(state);
+      }
+
       const auto pluginItems =
           GetPluginItems(state.GetCurrentGame().GetLoadOrder(),
                          state.GetCurrentGame(),
@@ -2665,11 +3279,27 @@ void MainWindow::handleMasterlistsUpdated(std::vector<QueryResult> results) {
     auto messageBox = QMessageBox(
         QMessageBox::NoIcon, "LOOT", message, QMessageBox::Ok, this);
     messageBox.exec();
+
+    showMasterlistUpdateErrors(updateErrors);
   } catch (const std::exception& e) {
     handleException(e);
   }
 }
 
+void MainWindow::showMasterlistUpdateErrors(
+    const std::vector<std::string>& errors) {
+  if (errors.empty()) {
+    return;
+  }
+
+  auto message = translate("The following masterlist updates failed:\n\n");
+  for (const auto& error : errors) {
+    message += QString::fromStdString(error + "\n");
+  }
+
+  QMessageBox::warning(this, translate("Error"), message);
+}
+
 void MainWindow::handleOverlapFilterChecked(QueryResult result) {
   try {
     progressDialog->reset();
@@ -2704,6 +3334,12 @@ void MainWindow::handleOverlapFilterChecked(QueryResult result) {
 }
 
 void MainWindow::handleProgressUpdate(const QString& message) {
+  if (isShowingSessionSnapshot) {
+    // Don't block scrolling through and filtering the snapshot.
+    statusBar()->showMessage(message);
+    return;
+  }
+
   progressDialog->open();
   progressDialog->setLabelText(message);
   progressDialog->adjustSize();
@@ -2756,23 +3392,39 @@ void MainWindow::handleUpdateCheckError(const std::string&) {
   }
 }
 
-void MainWindow::handleTaskExecutorFinished() { progressDialog->reset(); }
+void MainWindow::handleGeneralInformationLoaded(
+    GeneralInformation generalInformation) {
+  // This is received before the result of the query that loaded it, which
+  // will install it.
+  loadedGeneralInformation = std::move(generalInformation);
+}
 
-void MainWindow::handleIconColorChanged() {
-  IconFactory::setColours(
-      normalIconColor, disabledIconColor, selectedIconColor);
+void MainWindow::handleTaskExecutorFinished() {
+  progressDialog->reset();
 
-  setIcons();
+  // The general information was only valid for the executor's results.
+  loadedGeneralInformation.reset();
+}
 
-  sidebarPluginsView->reset();
+void MainWindow::handleIconColorChanged() {
+  // Each icon colour is set separately when a theme is applied, so wait until
+  // they have all been set.
+  if (isIconColorUpdatePending) {
+    return;
+  }
 
-  const auto cardDelegate =
-      qobject_cast<CardDelegate*>(pluginCardsView->itemDelegate());
+  isIconColorUpdatePending = true;
+  QTimer::singleShot(0, this, [this]() {
+    isIconColorUpdatePending = false;
 
-  if (cardDelegate) {
-    cardDelegate->setIcons();
-    pluginCardsView->reset();
-  }
+    // The icons are recoloured in a worker thread, and the current icons stay
+    // displayed until that's done.
+    IconFactory::setColoursAsync(normalIconColor,
+                                 disabledIconColor,
+                                 selectedIconColor,
+                                 this,
+                                 [this]() { updateIcons(); });
+  });
 }
 
 void MainWindow::handleSidebarTextColorChanged() {
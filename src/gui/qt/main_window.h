@@ -56,16 +56,23 @@
 #include <QtWidgets/QWidget>
 
 #include "gui/qt/card_delegate.h"
+#include "gui/qt/counters.h"
+#include "gui/qt/data_change_coalescer.h"
+#include "gui/qt/diagnostics_dialog.h"
 #include "gui/qt/filters_widget.h"
 #include "gui/qt/groups_editor/groups_editor_dialog.h"
 #include "gui/qt/plugin_editor/plugin_editor_widget.h"
 #include "gui/qt/plugin_item_filter_model.h"
 #include "gui/qt/plugin_item_model.h"
+#include "gui/qt/plugin_name_list_model.h"
 #include "gui/qt/search_dialog.h"
+#include "gui/qt/search_engine.h"
 #include "gui/qt/settings/settings_dialog.h"
+#include "gui/qt/tasks/prefetched_query.h"
 #include "gui/qt/tasks/tasks.h"
 #include "gui/query/query.h"
 #include "gui/state/loot_state.h"
+#include "gui/state/write_behind_saver.h"
 
 namespace loot {
 class MainWindow : public QMainWindow {
@@ -87,7 +94,10 @@ class MainWindow : public QMainWindow {
 public:
   explicit MainWindow(LootState &state, QWidget *parent = nullptr);
 
-  void initialise();
+  // If a query to get the current game's data is given, its outcome is used
+  // instead of loading the game's data, and the current game must already
+  // have been initialised.
+  void initialise(std::unique_ptr<PrefetchedQuery> gameDataQuery = nullptr);
   void applyTheme();
 
 signals:
@@ -113,6 +123,7 @@ private:
   QAction *actionOpenLOOTDataFolder{new QAction(this)};
   QAction *actionJoinDiscordServer{new QAction(this)};
   QAction *actionAbout{new QAction(this)};
+  QAction *actionViewDiagnostics{new QAction(this)};
   QAction *actionQuit{new QAction(this)};
   QAction *actionOpenGroupsEditor{new QAction(this)};
   QAction *actionCopyLoadOrder{new QAction(this)};
@@ -139,6 +150,12 @@ private:
   QToolBar *toolBar{new QToolBar(this)};
   QComboBox *gameComboBox{new QComboBox(toolBar)};
   QProgressDialog *progressDialog{new QProgressDialog(this)};
+  std::unique_ptr<PrefetchedQuery> prefetchedGameDataQuery;
+  bool isShowingSessionSnapshot{false};
+  bool isIconColorUpdatePending{false};
+  // The general information that was loaded in a worker thread by the
+  // currently-executing tasks, if any.
+  std::optional<GeneralInformation> loadedGeneralInformation;
 
   QSplitter *sidebarSplitter{new QSplitter(this)};
   QToolBox *toolBox{new QToolBox(sidebarSplitter)};
@@ -155,13 +172,37 @@ private:
 
   SettingsDialog *settingsDialog{new SettingsDialog(this)};
   SearchDialog *searchDialog{new SearchDialog(this)};
+  DiagnosticsDialog *diagnosticsDialog{new DiagnosticsDialog(this)};
 
   PluginItemModel *pluginItemModel{new PluginItemModel(this)};
+  // Shared by the overlap filter, the metadata editor's filename completers
+  // and the groups editor's plugin combo box.
+  PluginNameListModel *pluginNameListModel{
+      new PluginNameListModel(this, pluginItemModel)};
+  // The counts and search results are refreshed once for all the data
+  // changes that the model emits before control returns to the event loop.
+  // Search result changes don't affect them.
+  DataChangeCoalescer *pluginItemChanges{
+      new DataChangeCoalescer(pluginItemModel, {SearchResultRole})};
   PluginItemFilterModel *proxyModel{new PluginItemFilterModel(this)};
+  SearchEngine *searchEngine{new SearchEngine(this)};
+  // The rows that the most recently started search was limited to, or nullopt
+  // if it searched all the visible rows.
+  std::optional<std::vector<int>> partialSearchRows;
+  // True if a search has been started and has not yet finished. The search
+  // may have been cancelled, so the current search results may be stale.
+  bool isSearchPending{false};
   CardSizingCache cardSizingCache{pluginCardsView->viewport()};
+  // Only the changed plugins are recounted when plugin data changes.
+  HiddenMessageCounter hiddenMessageCounter;
 
   GroupsEditorDialog *groupsEditor{
-      new GroupsEditorDialog(this, pluginItemModel)};
+      new GroupsEditorDialog(this, pluginItemModel, pluginNameListModel)};
+
+  // User metadata edits are written to the userlist in the background. Any
+  // pending save is flushed before background tasks are run, as they may
+  // change the current game or reload its metadata, and when LOOT quits.
+  WriteBehindSaver userMetadataSaver;
 
   std::optional<QPersistentModelIndex> lastEnteredCardIndex;
 
@@ -183,6 +224,7 @@ private:
 
   void translateUi();
   void setIcons();
+  void updateIcons();
 
   void enableGameActions();
   void disableGameActions();
@@ -195,21 +237,32 @@ private:
   void enterSortingState();
   void exitSortingState();
 
+  void showSessionSnapshot();
+  void exitSessionSnapshotState();
+  void discardSessionSnapshot();
+  void saveSessionSnapshot();
+
   void loadGame(bool isOnLOOTStartup);
-  void updateCounts(const std::vector<SourcedMessage> &generalMessages,
-                    const std::vector<PluginItem> &plugins);
+  void updateCounts();
   void updateGeneralInformation();
   void updateGeneralMessages();
   void updateSidebarColumnWidths();
   void setFiltersState(PluginFiltersState &&state);
   void setFiltersState(PluginFiltersState &&state,
                        std::vector<std::string> &&overlappingPluginNames);
+  void handleContentFilterTimeout();
   void refreshSearch();
+  void refreshSearch(const std::vector<RowRange> &rowRanges);
+  void startSearch(const ContentMatcher &matcher,
+                   const std::vector<int> &rows,
+                   std::optional<std::vector<int>> &&searchedRows);
   void refreshPluginRawData(const std::string &pluginName);
+  void showMasterlistUpdateErrors(const std::vector<std::string> &errors);
 
   bool hasErrorMessages() const;
 
   void sortPlugins(bool isAutoSort);
+  void applySortedLoadOrder(void (MainWindow::*onApplied)(QueryResult));
 
   void showFirstRunDialog();
   void showNotification(const QString &message);
@@ -217,11 +270,18 @@ private:
   QModelIndex getSelectedPluginIndex() const;
   PluginItem getSelectedPlugin() const;
 
+  QJsonObject collectDiagnostics() const;
+
   void closeEvent(QCloseEvent *event) override;
 
+  QueryTask *createGeneralInformationQueryTask(std::unique_ptr<Query> query);
+  void loadGeneralInformationAfter(Task *task);
   void executeBackgroundQuery(std::unique_ptr<Query> query,
                               void (MainWindow::*onComplete)(QueryResult),
                               ProgressUpdater *progressUpdater);
+  void executeBackgroundQuery(QueryTask *task,
+                              void (MainWindow::*onComplete)(QueryResult),
+                              ProgressUpdater *progressUpdater);
   void executeBackgroundTasks(
       TaskExecutor *executor,
       const ProgressUpdater *progressUpdater,
@@ -229,10 +289,10 @@ private:
 
   void handleError(const std::string &message);
   void handleException(const std::exception &exception);
-  void handleQueryException(const Query &query,
-                            const std::exception &exception);
 
   void handleGameDataLoaded(QueryResult result);
+  void handlePrefetchedGameDataLoaded(QueryResult result);
+  void handlePrefetchedGameDataError(const std::string &message);
   bool handlePluginsSorted(std::vector<QueryResult> results);
 
   QMenu *createPopupMenu() override;
@@ -265,6 +325,7 @@ private slots:
   void on_actionOpenFAQs_triggered();
   void on_actionOpenLOOTDataFolder_triggered();
   void on_actionJoinDiscordServer_triggered();
+  void on_actionViewDiagnostics_triggered();
   void on_actionAbout_triggered();
 
   void on_gameComboBox_activated(int index);
@@ -288,6 +349,16 @@ private slots:
   void on_pluginItemModel_rowsInserted(const QModelIndex &,
                                        int first,
                                        int last);
+  void on_pluginItemModel_rowsRemoved(const QModelIndex &,
+                                      int first,
+                                      int last);
+  void on_pluginItemModel_rowsMoved(const QModelIndex &,
+                                    int start,
+                                    int end,
+                                    const QModelIndex &,
+                                    int row);
+  void on_pluginItemModel_layoutChanged();
+  void on_pluginItemChanges_changed(const DataChanges &changes);
 
   void on_pluginEditorWidget_accepted(PluginMetadata userMetadata);
   void on_pluginEditorWidget_rejected();
@@ -305,15 +376,23 @@ private slots:
   void on_searchDialog_textChanged(const QVariant &text);
   void on_searchDialog_currentResultChanged(size_t resultIndex);
 
+  void on_diagnosticsDialog_refreshRequested();
+
+  void on_searchEngine_finished(const std::vector<int> &rows);
+  void on_searchEngine_timedOut();
+
   void handleGameChanged(QueryResult result);
   void handleRefreshGameDataLoaded(QueryResult result);
   void handleStartupGameDataLoaded(QueryResult result);
   void handlePluginsManualSorted(std::vector<QueryResult> results);
   void handlePluginsAutoSorted(std::vector<QueryResult> results);
+  void handleSortApplied(QueryResult result);
+  void handleAutoSortApplied(QueryResult result);
   void handleMasterlistUpdated(std::vector<QueryResult> results);
   void handleMasterlistsUpdated(std::vector<QueryResult> results);
   void handleOverlapFilterChecked(QueryResult result);
   void handleProgressUpdate(const QString &message);
+  void handleGeneralInformationLoaded(GeneralInformation generalInformation);
   void handleUpdateCheckFinished(QueryResult result);
   void handleUpdateCheckError(const std::string &);
   void handleTaskExecutorFinished();
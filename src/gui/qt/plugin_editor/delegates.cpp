@@ -163,18 +163,21 @@ bool MessageContentDelegate::eventFilter(QObject* editor, QEvent* event) {
 
 AutocompletingLineEditDelegate::AutocompletingLineEditDelegate(
     QObject* parent,
-    const QStringList& completions) :
-    QStyledItemDelegate(parent), completions(completions) {}
+    QAbstractItemModel* completionModel) :
+    QStyledItemDelegate(parent), completionModel(completionModel) {}
 
 QWidget* AutocompletingLineEditDelegate::createEditor(
     QWidget* parent,
     const QStyleOptionViewItem&,
     const QModelIndex&) const {
-  auto completer = new QCompleter(completions, parent);
-  completer->setCaseSensitivity(Qt::CaseInsensitive);
-
   QLineEdit* lineEdit = new QLineEdit(parent);
-  lineEdit->setCompleter(completer);
+
+  if (completionModel != nullptr) {
+    auto completer = new QCompleter(completionModel, lineEdit);
+    completer->setCaseSensitivity(Qt::CaseInsensitive);
+
+    lineEdit->setCompleter(completer);
+  }
 
   return lineEdit;
 }
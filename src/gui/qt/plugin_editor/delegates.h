@@ -93,8 +93,10 @@ private:
 
 class AutocompletingLineEditDelegate : public QStyledItemDelegate {
 public:
+  // The completion model is shared, so it isn't owned by the delegate, and
+  // may be null if there are no completions.
   AutocompletingLineEditDelegate(QObject* parent,
-                                 const QStringList& completions);
+                                 QAbstractItemModel* completionModel);
 
   QWidget* createEditor(QWidget* parent,
                         const QStyleOptionViewItem& option,
@@ -107,7 +109,7 @@ public:
                     const QModelIndex& index) const override;
 
 private:
-  const QStringList& completions;
+  QAbstractItemModel* completionModel{nullptr};
 };
 }
 
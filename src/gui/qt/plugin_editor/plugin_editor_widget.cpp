@@ -45,20 +45,20 @@ PluginEditorWidget::PluginEditorWidget(
 
 void PluginEditorWidget::setBashTagCompletions(
     const std::vector<std::string> &knownBashTags) {
-  bashTagCompletions.clear();
+  QStringList bashTagCompletions;
 
   for (const auto &bashTag : knownBashTags) {
     bashTagCompletions.append(QString::fromStdString(bashTag));
   }
-}
 
-void PluginEditorWidget::setFilenameCompletions(
-    const std::vector<std::string> &knownFilenames) {
-  filenameCompletions.clear();
+  bashTagCompletionModel->setStringList(bashTagCompletions);
+}
 
-  for (const auto &filename : knownFilenames) {
-    filenameCompletions.append(QString::fromStdString(filename));
-  }
+void PluginEditorWidget::setFilenameCompletionModel(
+    QAbstractItemModel *completionModel) {
+  loadAfterTab->setCompletionModel(completionModel);
+  requirementsTab->setCompletionModel(completionModel);
+  incompatibilitiesTab->setCompletionModel(completionModel);
 }
 
 void PluginEditorWidget::initialiseInputs(
@@ -28,6 +28,7 @@
 
 #include <loot/metadata/plugin_metadata.h>
 
+#include <QtCore/QStringListModel>
 #include <QtWidgets/QAbstractButton>
 #include <QtWidgets/QLabel>
 #include <QtWidgets/QTabWidget>
@@ -46,7 +47,8 @@ public:
                      const std::string &language);
 
   void setBashTagCompletions(const std::vector<std::string> &knownBashTags);
-  void setFilenameCompletions(const std::vector<std::string> &knownFilenames);
+  // The filename completion model is shared, so is not owned by the widget.
+  void setFilenameCompletionModel(QAbstractItemModel *completionModel);
 
   void initialiseInputs(const std::vector<std::string> &groups,
                         const std::string &pluginName,
@@ -63,23 +65,18 @@ private:
   const std::vector<LootSettings::Language> &languages;
   const std::string language;
 
-  QStringList bashTagCompletions;
-  QStringList filenameCompletions;
+  QStringListModel *bashTagCompletionModel{new QStringListModel(this)};
 
   QLabel *pluginLabel{new QLabel(this)};
   QTabWidget *tabs{new QTabWidget(this)};
   GroupTab *groupTab{new GroupTab(this)};
   LoadAfterFileTableTab *loadAfterTab{
-      new LoadAfterFileTableTab(this,
-                                languages,
-                                language,
-                                filenameCompletions)};
-  FileTableTab *requirementsTab{
-      new FileTableTab(this, languages, language, filenameCompletions)};
+      new LoadAfterFileTableTab(this, languages, language)};
+  FileTableTab *requirementsTab{new FileTableTab(this, languages, language)};
   FileTableTab *incompatibilitiesTab{
-      new FileTableTab(this, languages, language, filenameCompletions)};
+      new FileTableTab(this, languages, language)};
   MessageTableTab *messagesTab{new MessageTableTab(this, languages, language)};
-  TagTableTab *tagsTab{new TagTableTab(this, bashTagCompletions)};
+  TagTableTab *tagsTab{new TagTableTab(this, bashTagCompletionModel)};
   CleaningDataTableTab *dirtyTab{
       new CleaningDataTableTab(this, languages, language)};
   CleaningDataTableTab *cleanTab{
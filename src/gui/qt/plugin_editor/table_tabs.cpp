@@ -334,15 +334,15 @@ void BaseTableTab::onModelRowsRemoved() {
 
 FileTableTab::FileTableTab(QWidget* parent,
                            const std::vector<LootSettings::Language>& languages,
-                           const std::string& language,
-                           const QStringList& completions) :
-    MetadataTableTab(parent),
-    languages(languages),
-    language(language),
-    completions(completions) {
+                           const std::string& language) :
+    MetadataTableTab(parent), languages(languages), language(language) {
   configureAsDropTarget();
 }
 
+void FileTableTab::setCompletionModel(QAbstractItemModel* model) {
+  completionModel = model;
+}
+
 void FileTableTab::initialiseInputs(const std::vector<File>& nonUserMetadata,
                                     const std::vector<File>& userMetadata) {
   auto tableModel =
@@ -350,7 +350,8 @@ void FileTableTab::initialiseInputs(const std::vector<File>& nonUserMetadata,
 
   setTableModel(tableModel);
 
-  auto filenameDelegate = new AutocompletingLineEditDelegate(this, completions);
+  auto filenameDelegate =
+      new AutocompletingLineEditDelegate(this, completionModel);
   auto detailDelegate = new MessageContentDelegate(this, languages);
 
   setItemDelegateForColumn(tableModel->NAME_COLUMN, filenameDelegate);
@@ -515,8 +516,9 @@ bool CleaningDataTableTab::hasUserMetadata() const {
   return !getUserMetadata().empty();
 }
 
-TagTableTab::TagTableTab(QWidget* parent, const QStringList& completions) :
-    MetadataTableTab(parent), completions(completions) {}
+TagTableTab::TagTableTab(QWidget* parent,
+                         QAbstractItemModel* completionModel) :
+    MetadataTableTab(parent), completionModel(completionModel) {}
 
 void TagTableTab::initialiseInputs(const std::vector<Tag>& nonUserMetadata,
                                    const std::vector<Tag>& userMetadata) {
@@ -538,7 +540,8 @@ void TagTableTab::initialiseInputs(const std::vector<Tag>& nonUserMetadata,
           tableModel, tableModel->TYPE_COLUMN, suggestionTypes));
 
   auto addRemoveDelegate = new ComboBoxDelegate(this, suggestionTypes);
-  auto nameDelegate = new AutocompletingLineEditDelegate(this, completions);
+  auto nameDelegate =
+      new AutocompletingLineEditDelegate(this, completionModel);
 
   setItemDelegateForColumn(tableModel->TYPE_COLUMN, addRemoveDelegate);
   setItemDelegateForColumn(tableModel->NAME_COLUMN, nameDelegate);
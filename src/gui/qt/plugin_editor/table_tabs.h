@@ -96,8 +96,11 @@ class FileTableTab : public MetadataTableTab<File> {
 public:
   FileTableTab(QWidget* parent,
                const std::vector<LootSettings::Language>& languages,
-               const std::string& language,
-               const QStringList& completions);
+               const std::string& language);
+
+  // The completion model is not owned by the tab, and only affects editors
+  // created by subsequent calls to initialiseInputs().
+  void setCompletionModel(QAbstractItemModel* completionModel);
 
   void initialiseInputs(const std::vector<File>& nonUserMetadata,
                         const std::vector<File>& userMetadata) override;
@@ -109,7 +112,7 @@ public:
 private:
   const std::vector<LootSettings::Language>& languages;
   const std::string& language;
-  const QStringList& completions;
+  QAbstractItemModel* completionModel{nullptr};
 };
 
 class LoadAfterFileTableTab : public FileTableTab {
@@ -197,7 +200,7 @@ private:
 class TagTableTab : public MetadataTableTab<Tag> {
   Q_OBJECT
 public:
-  TagTableTab(QWidget* parent, const QStringList& completions);
+  TagTableTab(QWidget* parent, QAbstractItemModel* completionModel);
 
   void initialiseInputs(const std::vector<Tag>& nonUserMetadata,
                         const std::vector<Tag>& userMetadata) override;
@@ -207,7 +210,7 @@ public:
   bool hasUserMetadata() const override;
 
 private:
-  const QStringList& completions;
+  QAbstractItemModel* completionModel{nullptr};
 };
 }
 
@@ -25,6 +25,9 @@
 
 #include "gui/qt/plugin_item_filter_model.h"
 
+#include <algorithm>
+#include <iterator>
+
 #include "gui/plugin_item.h"
 #include "gui/qt/plugin_item_model.h"
 
@@ -49,96 +52,203 @@ PluginItemFilterModel::PluginItemFilterModel(QObject* parent) :
 
 void PluginItemFilterModel::setFiltersState(PluginFiltersState&& state) {
   filterState = std::move(state);
+  flagFilterTable.reset();
 
-  invalidateFilter();
+  refilter();
 }
 
 void PluginItemFilterModel::setFiltersState(
     PluginFiltersState&& state,
     std::vector<std::string>&& newOverlappingPluginNames) {
   filterState = std::move(state);
-  this->overlappingPluginNames = std::move(newOverlappingPluginNames);
+  overlappingPluginNames = std::unordered_set<std::string>(
+      std::make_move_iterator(newOverlappingPluginNames.begin()),
+      std::make_move_iterator(newOverlappingPluginNames.end()));
+  flagFilterTable.reset();
+
+  refilter();
+}
 
+void PluginItemFilterModel::refilter() {
+  resetContentFilterTimeBudget();
   invalidateFilter();
 }
 
-void PluginItemFilterModel::setSearchResults(QModelIndexList results) {
-  std::set<int> resultRows;
-  for (const auto& result : results) {
-    resultRows.insert(result.row());
+bool PluginItemFilterModel::hasContentFilterTimedOut() const {
+  return filterState.content.has_value() &&
+         filterState.content.value().hasExceededTimeBudget();
+}
+
+void PluginItemFilterModel::setSourceModel(QAbstractItemModel* newSourceModel) {
+  for (const auto& connection : sourceModelConnections) {
+    disconnect(connection);
+  }
+  sourceModelConnections.clear();
+
+  if (newSourceModel != nullptr) {
+    // Each of these signals causes the base class to start a new filtering
+    // pass over some or all rows, and the content filter's time budget is per
+    // pass. Slots are invoked in the order that they were connected, so these
+    // connections must be made before the base class makes its own.
+    const auto reset = [this]() { resetContentFilterTimeBudget(); };
+
+    sourceModelConnections = {
+        connect(newSourceModel,
+                &QAbstractItemModel::dataChanged,
+                this,
+                [this](const QModelIndex& topLeft,
+                       const QModelIndex& bottomRight) {
+                  resetContentFilterTimeBudget();
+                  updateFlagFilterResults(topLeft.row(), bottomRight.row());
+                }),
+        connect(newSourceModel,
+                &QAbstractItemModel::rowsAboutToBeInserted,
+                this,
+                reset),
+        connect(newSourceModel,
+                &QAbstractItemModel::rowsAboutToBeMoved,
+                this,
+                reset),
+        connect(newSourceModel,
+                &QAbstractItemModel::layoutAboutToBeChanged,
+                this,
+                reset),
+        connect(newSourceModel,
+                &QAbstractItemModel::modelAboutToBeReset,
+                this,
+                reset)};
   }
 
-  for (int row = 1; row < rowCount(); row += 1) {
-    const auto index = this->index(row, PluginItemModel::CARDS_COLUMN);
-    const auto isNewResult = resultRows.find(row) != resultRows.end();
+  QSortFilterProxyModel::setSourceModel(newSourceModel);
+  flagFilterTable.reset();
+}
 
-    // When setting new search results, there is no initial current result.
-    const SearchResultData newValue(isNewResult, false);
-    setData(index, QVariant::fromValue(newValue), SearchResultRole);
+void PluginItemFilterModel::resetContentFilterTimeBudget() {
+  if (filterState.content.has_value()) {
+    filterState.content.value().resetTimeBudget();
   }
 }
 
-void PluginItemFilterModel::clearSearchResults() { setSearchResults({}); }
+const PluginBitset& PluginItemFilterModel::getFlagFilterResults(
+    const std::shared_ptr<const PluginTable>& table) const {
+  if (flagFilterTable == table) {
+    return flagFilterResults;
+  }
 
-bool PluginItemFilterModel::filterAcceptsRow(
-    int sourceRow,
-    const QModelIndex& sourceParent) const {
-  if (sourceRow == 0) {
-    // The general information card is never filtered out.
-    return true;
+  flagFilterResults.resize(table->size());
+  flagFilterResults.set();
+
+  if (filterState.hideInactivePlugins) {
+    flagFilterResults &= table->getFlags(PluginFlag::active);
   }
 
-  const auto sourceIndex = sourceModel()->index(
-      sourceRow, PluginItemModel::CARDS_COLUMN, sourceParent);
+  if (filterState.hideCreationClubPlugins) {
+    flagFilterResults -= table->getFlags(PluginFlag::creationClubPlugin);
+  }
 
-  auto item = sourceIndex.data(RawDataRole).value<PluginItem>();
-  auto contentFilters =
-      sourceIndex.data(CardContentFiltersRole).value<CardContentFiltersState>();
+  if (filterState.showOnlyEmptyPlugins) {
+    flagFilterResults &= table->getFlags(PluginFlag::empty);
+  }
 
-  if (filterState.hideInactivePlugins && !item.isActive) {
-    return false;
+  if (filterState.groupName.has_value()) {
+    flagFilterResults &=
+        table->getGroupMembers(filterState.groupName.value());
   }
 
-  if (filterState.hideMessagelessPlugins &&
-      !anyMessagesVisible(item, contentFilters)) {
+  flagFilterTable = table;
+
+  return flagFilterResults;
+}
+
+bool PluginItemFilterModel::acceptsFlags(const PluginTable& table,
+                                         size_t index) const {
+  if (filterState.hideInactivePlugins &&
+      !table.hasFlag(PluginFlag::active, index)) {
     return false;
   }
 
-  if (filterState.hideCreationClubPlugins && item.isCreationClubPlugin) {
+  if (filterState.hideCreationClubPlugins &&
+      table.hasFlag(PluginFlag::creationClubPlugin, index)) {
     return false;
   }
 
-  if (filterState.showOnlyEmptyPlugins && !item.isEmpty) {
+  if (filterState.showOnlyEmptyPlugins &&
+      !table.hasFlag(PluginFlag::empty, index)) {
     return false;
   }
 
   if (filterState.groupName.has_value() &&
-      item.group.value_or(Group::DEFAULT_NAME) !=
-          filterState.groupName.value()) {
+      !table.isInGroup(index, filterState.groupName.value())) {
     return false;
   }
 
-  if (std::holds_alternative<std::string>(filterState.content) &&
-      !item.containsText(std::get<std::string>(filterState.content))) {
+  return true;
+}
+
+void PluginItemFilterModel::updateFlagFilterResults(int firstRow,
+                                                    int lastRow) {
+  const auto model = qobject_cast<const PluginItemModel*>(sourceModel());
+  if (model == nullptr || !flagFilterTable) {
+    return;
+  }
+
+  // If the table has been replaced, all the results will be recalculated
+  // when they are next needed.
+  const auto table = model->getPluginTable();
+  if (table != flagFilterTable) {
+    return;
+  }
+
+  // Row 0 is the general information row, which has no plugin.
+  for (auto row = std::max(firstRow, 1); row <= lastRow; row += 1) {
+    const auto index = static_cast<size_t>(row) - 1;
+    flagFilterResults.set(index, acceptsFlags(*table, index));
+  }
+}
+
+bool PluginItemFilterModel::filterAcceptsRow(
+    int sourceRow,
+    const QModelIndex& sourceParent) const {
+  if (sourceRow == 0) {
+    // The general information card is never filtered out.
+    return true;
+  }
+
+  const auto model = qobject_cast<const PluginItemModel*>(sourceModel());
+  if (model == nullptr) {
+    return true;
+  }
+
+  const auto itemIndex = static_cast<size_t>(sourceRow) - 1;
+  const auto table = model->getPluginTable();
+
+  if (!getFlagFilterResults(table).test(itemIndex)) {
     return false;
   }
 
-  if (std::holds_alternative<std::regex>(filterState.content) &&
-      !item.containsMatchingText(std::get<std::regex>(filterState.content))) {
+  const auto& item = model->getPluginItems().at(itemIndex);
+
+  if (filterState.hideMessagelessPlugins &&
+      (table->getMessageCount(itemIndex) == 0 ||
+       !anyMessagesVisible(item, model->getCardContentFiltersState()))) {
     return false;
   }
 
-  if (filterState.overlapPluginName.has_value()) {
-    const auto hasOverlap =
-        std::any_of(overlappingPluginNames.begin(),
-                    overlappingPluginNames.end(),
-                    [&](const auto& name) { return name == item.name; });
+  if (filterState.content.has_value()) {
+    const auto sourceIndex = sourceModel()->index(
+        sourceRow, PluginItemModel::CARDS_COLUMN, sourceParent);
 
-    if (!hasOverlap) {
+    if (!filterState.content.value().matches(
+            sourceIndex.data(ContentSearchRole).toStringList())) {
       return false;
     }
   }
 
+  if (filterState.overlapPluginName.has_value() &&
+      overlappingPluginNames.count(item.name) == 0) {
+    return false;
+  }
+
   return true;
 }
 }
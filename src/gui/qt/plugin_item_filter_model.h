@@ -28,6 +28,12 @@
 
 #include <QtCore/QSortFilterProxyModel>
 
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "gui/plugin_table.h"
 #include "gui/qt/filters_states.h"
 
 namespace loot {
@@ -40,16 +46,35 @@ public:
   void setFiltersState(PluginFiltersState&& state,
                        std::vector<std::string>&& overlappingPluginNames);
 
-  void setSearchResults(QModelIndexList results);
-  void clearSearchResults();
+  // Returns true if content filtering was stopped because the content filter's
+  // regex took too long to evaluate during the latest filtering pass.
+  bool hasContentFilterTimedOut() const;
+
+  void setSourceModel(QAbstractItemModel* sourceModel) override;
 
 protected:
   bool filterAcceptsRow(int sourceRow,
                         const QModelIndex& sourceParent) const override;
 
 private:
+  // Re-evaluate the current filters against every row.
+  void refilter();
+  void resetContentFilterTimeBudget();
+  const PluginBitset& getFlagFilterResults(
+      const std::shared_ptr<const PluginTable>& table) const;
+  bool acceptsFlags(const PluginTable& table, size_t index) const;
+  // Update the cached flag and group filter results for the given source
+  // rows, whose data has changed in place.
+  void updateFlagFilterResults(int firstRow, int lastRow);
+
   PluginFiltersState filterState;
-  std::vector<std::string> overlappingPluginNames;
+  std::unordered_set<std::string> overlappingPluginNames;
+  std::vector<QMetaObject::Connection> sourceModelConnections;
+
+  // The results of evaluating the flag and group filters against all plugins
+  // at once, cached for the table they were evaluated against.
+  mutable std::shared_ptr<const PluginTable> flagFilterTable;
+  mutable PluginBitset flagFilterResults;
 };
 }
 
@@ -28,10 +28,147 @@
 #include <QtCore/QMimeData>
 #include <QtCore/QSize>
 
+#include <algorithm>
+#include <climits>
+#include <numeric>
+#include <unordered_set>
+
 #include "gui/qt/helpers.h"
 #include "gui/qt/icon_factory.h"
+#include "gui/state/logging.h"
 
 namespace loot {
+namespace {
+// Moving rows one at a time is much cheaper than rebuilding views and proxy
+// models when only a few rows move, but each move still causes proxy models
+// to update their mappings, so large reorders are done as a single layout
+// change instead.
+constexpr size_t MAX_INDIVIDUAL_ROW_MOVES = 64;
+
+int GetRow(size_t itemIndex) {
+  // Row 0 is the general information card.
+  return static_cast<int>(itemIndex) + 1;
+}
+
+QStringList GetContentToSearch(const PluginItem& item) {
+  const auto fields = item.contentToSearch();
+
+  QStringList qFields;
+  qFields.reserve(static_cast<qsizetype>(fields.size()));
+  for (const auto& field : fields) {
+    qFields.push_back(QString::fromStdString(field));
+  }
+
+  return qFields;
+}
+
+size_t EstimateHeapSize(const std::string& string) {
+  return string.capacity();
+}
+
+size_t EstimateHeapSize(const std::optional<std::string>& string) {
+  return string.has_value() ? EstimateHeapSize(string.value()) : 0;
+}
+
+size_t EstimateHeapSize(const std::vector<std::string>& strings) {
+  size_t size = strings.capacity() * sizeof(std::string);
+  for (const auto& string : strings) {
+    size += EstimateHeapSize(string);
+  }
+
+  return size;
+}
+
+size_t EstimateHeapSize(const std::vector<SourcedMessage>& messages) {
+  size_t size = messages.capacity() * sizeof(SourcedMessage);
+  for (const auto& message : messages) {
+    size += EstimateHeapSize(message.text);
+  }
+
+  return size;
+}
+
+size_t EstimateHeapSize(const PluginItem& item) {
+  size_t size = EstimateHeapSize(item.name) + EstimateHeapSize(item.version) +
+                EstimateHeapSize(item.group) +
+                EstimateHeapSize(item.cleaningUtility) +
+                EstimateHeapSize(item.currentTags) +
+                EstimateHeapSize(item.addTags) +
+                EstimateHeapSize(item.removeTags) +
+                EstimateHeapSize(item.messages);
+
+  size += item.locations.capacity() * sizeof(Location);
+  for (const auto& location : item.locations) {
+    size += location.GetURL().size() + location.GetName().size();
+  }
+
+  return size;
+}
+
+template<typename T>
+void MoveElement(std::vector<T>& vector, size_t from, size_t to) {
+  if (from < to) {
+    std::rotate(vector.begin() + from,
+                vector.begin() + from + 1,
+                vector.begin() + to + 1);
+  } else if (from > to) {
+    std::rotate(
+        vector.begin() + to, vector.begin() + from, vector.begin() + from + 1);
+  }
+}
+
+template<typename T>
+std::vector<T> Permute(std::vector<T>&& vector,
+                       const std::vector<size_t>& order) {
+  std::vector<T> permuted;
+  permuted.reserve(vector.size());
+  for (const auto index : order) {
+    permuted.push_back(std::move(vector.at(index)));
+  }
+
+  return permuted;
+}
+}
+
+std::vector<bool> FindLongestIncreasingSubsequence(
+    const std::vector<size_t>& values) {
+  // tails[i] is the index of the smallest value that ends an increasing
+  // subsequence of length i + 1.
+  std::vector<size_t> tails;
+  std::vector<std::optional<size_t>> predecessors(values.size());
+
+  for (size_t i = 0; i < values.size(); i += 1) {
+    const auto it = std::lower_bound(
+        tails.begin(),
+        tails.end(),
+        values.at(i),
+        [&](size_t tail, size_t value) { return values.at(tail) < value; });
+
+    if (it != tails.begin()) {
+      predecessors.at(i) = *std::prev(it);
+    }
+
+    if (it == tails.end()) {
+      tails.push_back(i);
+    } else {
+      *it = i;
+    }
+  }
+
+  std::vector<bool> isInSubsequence(values.size(), false);
+  std::optional<size_t> index;
+  if (!tails.empty()) {
+    index = tails.back();
+  }
+
+  while (index.has_value()) {
+    isInSubsequence.at(index.value()) = true;
+    index = predecessors.at(index.value());
+  }
+
+  return isInSubsequence;
+}
+
 SearchResultData::SearchResultData(bool isResult, bool isCurrentResult) :
     isResult(isResult), isCurrentResult(isCurrentResult) {}
 
@@ -76,8 +213,8 @@ QVariant PluginItemModel::data(const QModelIndex& index, int role) const {
 
   if (index.row() == 0) {
     if (index.column() == CARDS_COLUMN && role == CountersRole) {
-      const auto counters =
-          GeneralInformationCounters(generalInformation.generalMessages, items);
+      const auto counters = GeneralInformationCounters(
+          generalInformation.generalMessages, *getPluginTable());
       return QVariant::fromValue(counters);
     }
   } else {
@@ -104,6 +241,15 @@ QVariant PluginItemModel::data(const QModelIndex& index, int role) const {
           return currentEditorPluginName.has_value();
         } else if (role == DragRole) {
           return QString::fromStdString(plugin.name);
+        } else if (role == SidebarTextRole) {
+          SidebarRowText text;
+          text.name = QString::fromStdString(plugin.name);
+          if (plugin.group.has_value() &&
+              plugin.group.value() != Group::DEFAULT_NAME) {
+            text.group = QString::fromStdString(plugin.group.value());
+          }
+
+          return QVariant::fromValue(text);
         }
 
         break;
@@ -137,7 +283,7 @@ QVariant PluginItemModel::data(const QModelIndex& index, int role) const {
         if (role == CardContentFiltersRole) {
           return QVariant::fromValue(cardContentFiltersState);
         } else if (role == ContentSearchRole) {
-          return QString::fromStdString(plugin.contentToSearch());
+          return contentSearchIndex.at(index.row() - 1);
         } else if (role == SearchResultRole) {
           const int searchResultsIndex = index.row() - 1;
 
@@ -282,6 +428,12 @@ bool PluginItemModel::setData(const QModelIndex& index,
     const int itemsIndex = index.row() - 1;
 
     items.at(itemsIndex) = value.value<PluginItem>();
+    if (pluginTable) {
+      pluginTable->setPlugin(static_cast<size_t>(itemsIndex),
+                             items.at(itemsIndex));
+    }
+    contentSearchIndex.at(itemsIndex) =
+        GetContentToSearch(items.at(itemsIndex));
   }
 
   // The RawDataRole data changed, emit dataChanged for all columns.
@@ -292,10 +444,40 @@ bool PluginItemModel::setData(const QModelIndex& index,
   return true;
 }
 
+size_t PluginItemModel::estimateMemoryUsage() const {
+  size_t size = sizeof(PluginItemModel) +
+                EstimateHeapSize(generalInformation.generalMessages) +
+                items.capacity() * sizeof(PluginItem);
+
+  for (const auto& item : items) {
+    size += EstimateHeapSize(item);
+  }
+
+  size += contentSearchIndex.capacity() * sizeof(QStringList);
+  for (const auto& fields : contentSearchIndex) {
+    size += static_cast<size_t>(fields.capacity()) * sizeof(QString);
+    for (const auto& field : fields) {
+      size += static_cast<size_t>(field.capacity()) * sizeof(QChar);
+    }
+  }
+
+  size += searchResults.capacity() / CHAR_BIT;
+
+  return size;
+}
+
 const std::vector<PluginItem>& PluginItemModel::getPluginItems() const {
   return items;
 }
 
+std::shared_ptr<const PluginTable> PluginItemModel::getPluginTable() const {
+  if (!pluginTable) {
+    pluginTable = std::make_shared<PluginTable>(items);
+  }
+
+  return pluginTable;
+}
+
 std::vector<std::string> PluginItemModel::getPluginNames() const {
   std::vector<std::string> pluginNames;
 
@@ -327,6 +509,8 @@ void PluginItemModel::setPluginItems(std::vector<PluginItem>&& newItems) {
   beginRemoveRows(QModelIndex(), 1, static_cast<int>(items.size()));
 
   items.clear();
+  pluginTable.reset();
+  contentSearchIndex.clear();
   searchResults.clear();
   currentSearchResultIndex = std::nullopt;
 
@@ -335,11 +519,260 @@ void PluginItemModel::setPluginItems(std::vector<PluginItem>&& newItems) {
   beginInsertRows(QModelIndex(), 1, static_cast<int>(newItems.size()));
 
   std::swap(items, newItems);
+  pluginTable.reset();
+
+  contentSearchIndex.reserve(items.size());
+  for (const auto& item : items) {
+    contentSearchIndex.push_back(GetContentToSearch(item));
+  }
+
   searchResults.resize(items.size(), false);
 
   endInsertRows();
 }
 
+void PluginItemModel::applyPluginItems(std::vector<PluginItem>&& newItems) {
+  std::unordered_map<std::string, size_t> newIndexes;
+  newIndexes.reserve(newItems.size());
+  for (size_t i = 0; i < newItems.size(); i += 1) {
+    newIndexes.emplace(newItems.at(i).name, i);
+  }
+
+  // Search results are cleared once the items have been applied, so there's
+  // no need to keep track of the current result while rows are rearranged.
+  currentSearchResultIndex = std::nullopt;
+
+  // Remove the rows of plugins that aren't in the new items, working
+  // backwards so that each run of contiguous rows can be removed together.
+  bool rowsChanged = false;
+  for (size_t last = items.size(); last > 0;) {
+    if (newIndexes.count(items.at(last - 1).name) != 0) {
+      last -= 1;
+      continue;
+    }
+
+    auto first = last - 1;
+    while (first > 0 && newIndexes.count(items.at(first - 1).name) == 0) {
+      first -= 1;
+    }
+
+    beginRemoveRows(QModelIndex(), GetRow(first), GetRow(last - 1));
+
+    items.erase(items.begin() + first, items.begin() + last);
+    pluginTable.reset();
+    contentSearchIndex.erase(contentSearchIndex.begin() + first,
+                             contentSearchIndex.begin() + last);
+    searchResults.erase(searchResults.begin() + first,
+                        searchResults.begin() + last);
+
+    endRemoveRows();
+
+    rowsChanged = true;
+    last = first;
+  }
+
+  // Now move the remaining rows into their new order.
+  std::vector<size_t> targetIndexes;
+  targetIndexes.reserve(items.size());
+  std::vector<bool> isNewItem(newItems.size(), true);
+  for (const auto& item : items) {
+    const auto targetIndex = newIndexes.at(item.name);
+    targetIndexes.push_back(targetIndex);
+    isNewItem.at(targetIndex) = false;
+  }
+
+  const auto moveCount = moveItems(targetIndexes);
+  rowsChanged = rowsChanged || moveCount > 0;
+
+  // Insert the new plugins' rows, inserting each run of contiguous rows
+  // together. The existing items are now in the same relative order as they
+  // are in the new items, so each run's position in the new items is also
+  // its insertion position.
+  for (size_t first = 0; first < newItems.size();) {
+    if (!isNewItem.at(first)) {
+      first += 1;
+      continue;
+    }
+
+    auto last = first + 1;
+    while (last < newItems.size() && isNewItem.at(last)) {
+      last += 1;
+    }
+
+    std::vector<QStringList> newContentSearchIndex;
+    newContentSearchIndex.reserve(last - first);
+    for (size_t i = first; i < last; i += 1) {
+      newContentSearchIndex.push_back(GetContentToSearch(newItems.at(i)));
+    }
+
+    beginInsertRows(QModelIndex(), GetRow(first), GetRow(last - 1));
+
+    items.insert(items.begin() + first,
+                 std::make_move_iterator(newItems.begin() + first),
+                 std::make_move_iterator(newItems.begin() + last));
+    pluginTable.reset();
+    contentSearchIndex.insert(contentSearchIndex.begin() + first,
+                              newContentSearchIndex.begin(),
+                              newContentSearchIndex.end());
+    searchResults.insert(searchResults.begin() + first, last - first, false);
+
+    endInsertRows();
+
+    rowsChanged = true;
+    first = last;
+  }
+
+  // Finally, replace the items that have changed.
+  std::vector<size_t> changedIndexes;
+  for (size_t i = 0; i < items.size(); i += 1) {
+    if (isNewItem.at(i) || items.at(i) == newItems.at(i)) {
+      continue;
+    }
+
+    items.at(i) = std::move(newItems.at(i));
+    if (pluginTable) {
+      pluginTable->setPlugin(i, items.at(i));
+    }
+    contentSearchIndex.at(i) = GetContentToSearch(items.at(i));
+
+    changedIndexes.push_back(i);
+  }
+
+  const auto logger = getLogger();
+  if (logger) {
+    logger->debug(
+        "Applied {} plugin items with {} moved and {} changed.",
+        items.size(),
+        moveCount,
+        changedIndexes.size());
+  }
+
+  if (rowsChanged || !changedIndexes.empty()) {
+    clearSearchResults();
+  }
+
+  // Emit one signal for each run of contiguous changed rows, as each signal
+  // causes all the rows it covers to be repainted, recounted and refiltered.
+  // The plugins' data may have changed in any way, so don't specify any roles.
+  for (size_t first = 0; first < changedIndexes.size();) {
+    auto last = first + 1;
+    while (last < changedIndexes.size() &&
+           changedIndexes.at(last) == changedIndexes.at(last - 1) + 1) {
+      last += 1;
+    }
+
+    const auto topLeft = index(GetRow(changedIndexes.at(first)), 0);
+    const auto bottomRight =
+        index(GetRow(changedIndexes.at(last - 1)), columnCount() - 1);
+    emit dataChanged(topLeft, bottomRight);
+
+    first = last;
+  }
+}
+
+size_t PluginItemModel::moveItems(const std::vector<size_t>& targetIndexes) {
+  const auto isUnmoved = FindLongestIncreasingSubsequence(targetIndexes);
+  const auto moveCount = static_cast<size_t>(
+      std::count(isUnmoved.begin(), isUnmoved.end(), false));
+
+  if (moveCount == 0) {
+    return 0;
+  }
+
+  // The current indexes of the items, sorted by their target indexes.
+  std::vector<size_t> order(targetIndexes.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+    return targetIndexes.at(lhs) < targetIndexes.at(rhs);
+  });
+
+  if (moveCount > MAX_INDIVIDUAL_ROW_MOVES) {
+    emit layoutAboutToBeChanged({}, QAbstractItemModel::VerticalSortHint);
+
+    std::vector<size_t> newIndexes(order.size());
+    for (size_t i = 0; i < order.size(); i += 1) {
+      newIndexes.at(order.at(i)) = i;
+    }
+
+    const auto oldPersistentIndexes = persistentIndexList();
+    QModelIndexList newPersistentIndexes;
+    newPersistentIndexes.reserve(oldPersistentIndexes.size());
+    for (const auto& oldIndex : oldPersistentIndexes) {
+      if (oldIndex.row() == 0) {
+        newPersistentIndexes.push_back(oldIndex);
+      } else {
+        const auto newRow = GetRow(newIndexes.at(oldIndex.row() - 1));
+        newPersistentIndexes.push_back(index(newRow, oldIndex.column()));
+      }
+    }
+
+    items = Permute(std::move(items), order);
+    pluginTable.reset();
+    contentSearchIndex = Permute(std::move(contentSearchIndex), order);
+    searchResults = Permute(std::move(searchResults), order);
+
+    changePersistentIndexList(oldPersistentIndexes, newPersistentIndexes);
+
+    emit layoutChanged({}, QAbstractItemModel::VerticalSortHint);
+
+    return moveCount;
+  }
+
+  // Process the items in their target order, moving each item that isn't part
+  // of the longest increasing subsequence of target indexes to just after the
+  // previously processed item. Items that are part of the subsequence are
+  // always after all previously processed items, so they stay where they are.
+  auto currentTargetIndexes = targetIndexes;
+  std::optional<size_t> previousIndex;
+  for (const auto itemIndex : order) {
+    const auto searchStart =
+        isUnmoved.at(itemIndex) && previousIndex.has_value()
+            ? previousIndex.value() + 1
+            : 0;
+    const auto it = std::find(currentTargetIndexes.begin() + searchStart,
+                              currentTargetIndexes.end(),
+                              targetIndexes.at(itemIndex));
+    const auto currentIndex =
+        static_cast<size_t>(std::distance(currentTargetIndexes.begin(), it));
+
+    if (isUnmoved.at(itemIndex)) {
+      previousIndex = currentIndex;
+      continue;
+    }
+
+    const auto destination =
+        previousIndex.has_value() ? previousIndex.value() + 1 : 0;
+    if (currentIndex == destination) {
+      previousIndex = currentIndex;
+      continue;
+    }
+
+    // The destination row is given in terms of the rows before the move, but
+    // moving an item down also moves the items between its current and new
+    // positions up by one.
+    const auto newIndex =
+        currentIndex < destination ? destination - 1 : destination;
+
+    beginMoveRows(QModelIndex(),
+                  GetRow(currentIndex),
+                  GetRow(currentIndex),
+                  QModelIndex(),
+                  GetRow(destination));
+
+    MoveElement(items, currentIndex, newIndex);
+    pluginTable.reset();
+    MoveElement(contentSearchIndex, currentIndex, newIndex);
+    MoveElement(searchResults, currentIndex, newIndex);
+    MoveElement(currentTargetIndexes, currentIndex, newIndex);
+
+    endMoveRows();
+
+    previousIndex = newIndex;
+  }
+
+  return moveCount;
+}
+
 void PluginItemModel::setEditorPluginName(
     const std::optional<std::string>& editorPluginName) {
   currentEditorPluginName = editorPluginName;
@@ -399,6 +832,99 @@ void PluginItemModel::setCardContentFiltersState(
   emit dataChanged(startIndex, endIndex, {CardContentFiltersRole});
 }
 
+const CardContentFiltersState& PluginItemModel::getCardContentFiltersState()
+    const {
+  return cardContentFiltersState;
+}
+
+SearchIndex PluginItemModel::getSearchIndex(
+    const std::vector<int>& rows) const {
+  SearchIndex index;
+  index.reserve(rows.size());
+
+  for (const auto row : rows) {
+    if (row > 0 && row < rowCount()) {
+      // QStringList is implicitly shared, so this doesn't copy the text.
+      index.push_back({row, contentSearchIndex.at(row - 1)});
+    }
+  }
+
+  return index;
+}
+
+void PluginItemModel::setSearchResults(const std::vector<int>& resultRows) {
+  std::vector<bool> newSearchResults(items.size(), false);
+  for (const auto row : resultRows) {
+    if (row > 0 && row < rowCount()) {
+      newSearchResults.at(row - 1) = true;
+    }
+  }
+
+  // Find the range of rows that have changed so that only one dataChanged
+  // signal needs to be emitted. When setting new search results, there is no
+  // initial current result.
+  std::optional<int> firstChanged = currentSearchResultIndex;
+  std::optional<int> lastChanged = currentSearchResultIndex;
+  for (size_t i = 0; i < newSearchResults.size(); i += 1) {
+    if (newSearchResults.at(i) != searchResults.at(i)) {
+      const auto changedIndex = static_cast<int>(i);
+      if (!firstChanged.has_value() || changedIndex < firstChanged.value()) {
+        firstChanged = changedIndex;
+      }
+      if (!lastChanged.has_value() || changedIndex > lastChanged.value()) {
+        lastChanged = changedIndex;
+      }
+    }
+  }
+
+  searchResults = std::move(newSearchResults);
+  currentSearchResultIndex = std::nullopt;
+
+  if (firstChanged.has_value() && lastChanged.has_value()) {
+    const auto topLeft = index(firstChanged.value() + 1, CARDS_COLUMN);
+    const auto bottomRight = index(lastChanged.value() + 1, CARDS_COLUMN);
+    emit dataChanged(topLeft, bottomRight, {SearchResultRole});
+  }
+}
+
+void PluginItemModel::clearSearchResults() { setSearchResults({}); }
+
+void PluginItemModel::updateSearchResults(const std::vector<int>& searchedRows,
+                                          const std::vector<int>& resultRows) {
+  const std::unordered_set<int> results(resultRows.begin(), resultRows.end());
+
+  // As when setting new search results, there is no initial current result.
+  std::vector<int> changedRows;
+  if (currentSearchResultIndex.has_value()) {
+    changedRows.push_back(currentSearchResultIndex.value() + 1);
+  }
+
+  for (const auto row : searchedRows) {
+    if (row <= 0 || row >= rowCount()) {
+      continue;
+    }
+
+    const auto isResult = results.count(row) != 0;
+    if (searchResults.at(row - 1) != isResult) {
+      searchResults.at(row - 1) = isResult;
+      changedRows.push_back(row);
+    }
+  }
+
+  currentSearchResultIndex = std::nullopt;
+
+  // The searched rows may be far apart, so signal each changed row separately
+  // instead of signalling every row between them.
+  for (const auto row : changedRows) {
+    const auto changedIndex = index(row, CARDS_COLUMN);
+    emit dataChanged(changedIndex, changedIndex, {SearchResultRole});
+  }
+}
+
+size_t PluginItemModel::countSearchResults() const {
+  return std::count(searchResults.begin(), searchResults.end(), true);
+}
+
 QModelIndex PluginItemModel::setCurrentSearchResult(size_t resultIndex) {
   size_t currentResultIndex = 0;
   for (size_t i = 0; i < searchResults.size(); i += 1) {
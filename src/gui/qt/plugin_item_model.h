@@ -28,11 +28,15 @@
 
 #include <QtCore/QAbstractListModel>
 
+#include <memory>
+
 #include "gui/plugin_item.h"
+#include "gui/plugin_table.h"
 #include "gui/qt/counters.h"
 #include "gui/qt/filters_states.h"
 #include "gui/qt/general_info.h"
 #include "gui/qt/helpers.h"
+#include "gui/qt/search_engine.h"
 
 Q_DECLARE_METATYPE(loot::PluginItem);
 
@@ -44,6 +48,7 @@ static constexpr int CardContentFiltersRole = Qt::UserRole + 5;
 static constexpr int ContentSearchRole = Qt::UserRole + 6;
 static constexpr int DragRole = Qt::UserRole + 7;
 static constexpr int SearchResultRole = Qt::UserRole + 8;
+static constexpr int SidebarTextRole = Qt::UserRole + 9;
 
 struct SearchResultData {
   SearchResultData() = default;
@@ -53,6 +58,19 @@ struct SearchResultData {
   bool isCurrentResult{false};
 };
 
+// The text that's displayed in a plugin's sidebar row, which is much cheaper
+// to get than the plugin's raw data. The group is empty if the plugin is in
+// the default group.
+struct SidebarRowText {
+  QString name;
+  QString group;
+};
+
+// Returns a vector that marks the values that are part of one of the longest
+// strictly increasing subsequences of the given values.
+std::vector<bool> FindLongestIncreasingSubsequence(
+    const std::vector<size_t>& values);
+
 class PluginItemModel : public QAbstractListModel {
   Q_OBJECT
 public:
@@ -87,12 +105,24 @@ public:
 
   const std::vector<PluginItem>& getPluginItems() const;
 
+  // The table is rebuilt from the current plugin items the first time it is
+  // requested after rows are added, removed or moved. When a plugin's data
+  // changes, only its row of the table is updated, and the table is updated
+  // in place before dataChanged is emitted.
+  std::shared_ptr<const PluginTable> getPluginTable() const;
+
   std::vector<std::string> getPluginNames() const;
 
   std::unordered_map<std::string, int> getPluginNameToRowMap() const;
 
   void setPluginItems(std::vector<PluginItem>&& items);
 
+  // Replace the current items with the given items by removing, moving and
+  // inserting only the rows that need it, and emitting dataChanged only for
+  // the rows whose items have changed, so that views and caches keep their
+  // state for unchanged rows. Also clears any search results.
+  void applyPluginItems(std::vector<PluginItem>&& items);
+
   void setEditorPluginName(const std::optional<std::string>& editorPluginName);
 
   void setGeneralInformation(bool gameSupportsLightPlugins,
@@ -110,19 +140,45 @@ public:
 
   void setCardContentFiltersState(CardContentFiltersState&& state);
 
+  const CardContentFiltersState& getCardContentFiltersState() const;
+
+  SearchIndex getSearchIndex(const std::vector<int>& rows) const;
+
+  void setSearchResults(const std::vector<int>& resultRows);
+  void clearSearchResults();
+
+  // Set whether each of the given searched rows is a search result, leaving
+  // the other rows' search results unchanged.
+  void updateSearchResults(const std::vector<int>& searchedRows,
+                           const std::vector<int>& resultRows);
+
+  size_t countSearchResults() const;
+
   QModelIndex setCurrentSearchResult(size_t resultIndex);
 
+  // Returns an approximate number of bytes used by the model's data. It only
+  // counts the sizes of objects and their strings' and vectors' capacities,
+  // so ignores allocator overhead and small string optimisations.
+  size_t estimateMemoryUsage() const;
+
 private:
   GeneralInformation generalInformation;
   std::vector<PluginItem> items;
+  mutable std::shared_ptr<PluginTable> pluginTable;
+  std::vector<QStringList> contentSearchIndex;
   std::vector<bool> searchResults;
   std::optional<int> currentSearchResultIndex;
 
   std::optional<std::string> currentEditorPluginName;
   CardContentFiltersState cardContentFiltersState;
+
+  // Reorder the current items so that they are in the order of the given
+  // indexes, returning the number of items that were moved.
+  size_t moveItems(const std::vector<size_t>& targetIndexes);
 };
 }
 
 Q_DECLARE_METATYPE(loot::SearchResultData);
+Q_DECLARE_METATYPE(loot::SidebarRowText);
 
 #endif
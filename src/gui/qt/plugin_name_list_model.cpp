@@ -0,0 +1,261 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/plugin_name_list_model.h"
+
+#include <QtCore/QHash>
+#include <algorithm>
+#include <optional>
+
+namespace loot {
+namespace {
+// Row 0 of the plugin item model is the general information row, so the
+// plugin in source row N is in row N - 1 of this model.
+int ToListRow(int sourceRow) { return sourceRow - 1; }
+}
+
+PluginNameListModel::PluginNameListModel(QObject* parent,
+                                         PluginItemModel* pluginItemModel) :
+    QAbstractListModel(parent), pluginItemModel(pluginItemModel) {
+  for (const auto& plugin : pluginItemModel->getPluginItems()) {
+    pluginNames.append(QString::fromStdString(plugin.name));
+  }
+
+  connect(pluginItemModel,
+          &QAbstractItemModel::dataChanged,
+          this,
+          &PluginNameListModel::handleSourceDataChanged);
+  connect(pluginItemModel,
+          &QAbstractItemModel::rowsInserted,
+          this,
+          &PluginNameListModel::handleSourceRowsInserted);
+  connect(pluginItemModel,
+          &QAbstractItemModel::rowsRemoved,
+          this,
+          &PluginNameListModel::handleSourceRowsRemoved);
+  connect(pluginItemModel,
+          &QAbstractItemModel::rowsMoved,
+          this,
+          &PluginNameListModel::handleSourceRowsMoved);
+  connect(pluginItemModel,
+          &QAbstractItemModel::layoutAboutToBeChanged,
+          this,
+          &PluginNameListModel::handleSourceLayoutAboutToBeChanged);
+  connect(pluginItemModel,
+          &QAbstractItemModel::layoutChanged,
+          this,
+          &PluginNameListModel::handleSourceLayoutChanged);
+  connect(pluginItemModel,
+          &QAbstractItemModel::modelAboutToBeReset,
+          this,
+          &PluginNameListModel::handleSourceModelAboutToBeReset);
+  connect(pluginItemModel,
+          &QAbstractItemModel::modelReset,
+          this,
+          &PluginNameListModel::handleSourceModelReset);
+}
+
+int PluginNameListModel::rowCount(const QModelIndex& parent) const {
+  if (parent.isValid()) {
+    return 0;
+  }
+
+  return static_cast<int>(pluginNames.size());
+}
+
+QVariant PluginNameListModel::data(const QModelIndex& index, int role) const {
+  if (!index.isValid() || index.row() >= rowCount()) {
+    return QVariant();
+  }
+
+  if (role != Qt::DisplayRole && role != Qt::EditRole) {
+    return QVariant();
+  }
+
+  return pluginNames.at(index.row());
+}
+
+QString PluginNameListModel::getSourcePluginName(int sourceRow) const {
+  const auto& pluginItems = pluginItemModel->getPluginItems();
+
+  return QString::fromStdString(pluginItems.at(ToListRow(sourceRow)).name);
+}
+
+void PluginNameListModel::handleSourceDataChanged(
+    const QModelIndex& topLeft,
+    const QModelIndex& bottomRight,
+    const QList<int>& roles) {
+  if (!topLeft.isValid() || !bottomRight.isValid()) {
+    return;
+  }
+
+  if (!roles.isEmpty() && !roles.contains(RawDataRole)) {
+    return;
+  }
+
+  // Emit dataChanged once for each contiguous run of rows whose names have
+  // changed, as most raw data changes don't change the plugin's name.
+  std::optional<int> firstChangedRow;
+  const auto emitChanged = [&](int lastChangedRow) {
+    if (firstChangedRow.has_value()) {
+      emit dataChanged(index(firstChangedRow.value()),
+                       index(lastChangedRow),
+                       {Qt::DisplayRole, Qt::EditRole});
+      firstChangedRow = std::nullopt;
+    }
+  };
+
+  const auto firstSourceRow = std::max(topLeft.row(), 1);
+  for (int sourceRow = firstSourceRow; sourceRow <= bottomRight.row();
+       sourceRow += 1) {
+    const auto row = ToListRow(sourceRow);
+    auto name = getSourcePluginName(sourceRow);
+
+    if (name == pluginNames.at(row)) {
+      emitChanged(row - 1);
+      continue;
+    }
+
+    pluginNames[row] = std::move(name);
+    if (!firstChangedRow.has_value()) {
+      firstChangedRow = row;
+    }
+  }
+
+  emitChanged(ToListRow(bottomRight.row()));
+}
+
+void PluginNameListModel::handleSourceRowsInserted(const QModelIndex&,
+                                                   int first,
+                                                   int last) {
+  first = std::max(first, 1);
+  if (last < first) {
+    return;
+  }
+
+  beginInsertRows(QModelIndex(), ToListRow(first), ToListRow(last));
+
+  for (int sourceRow = first; sourceRow <= last; sourceRow += 1) {
+    pluginNames.insert(ToListRow(sourceRow), getSourcePluginName(sourceRow));
+  }
+
+  endInsertRows();
+}
+
+void PluginNameListModel::handleSourceRowsRemoved(const QModelIndex&,
+                                                  int first,
+                                                  int last) {
+  first = std::max(first, 1);
+  if (last < first) {
+    return;
+  }
+
+  beginRemoveRows(QModelIndex(), ToListRow(first), ToListRow(last));
+
+  pluginNames.remove(ToListRow(first), last - first + 1);
+
+  endRemoveRows();
+}
+
+void PluginNameListModel::handleSourceRowsMoved(const QModelIndex&,
+                                                int start,
+                                                int end,
+                                                const QModelIndex&,
+                                                int row) {
+  const auto first = ToListRow(start);
+  const auto last = ToListRow(end);
+  const auto destination = ToListRow(row);
+
+  if (first < 0 || destination < 0) {
+    // The general information row never moves, but resync just in case.
+    handleSourceModelAboutToBeReset();
+    handleSourceModelReset();
+    return;
+  }
+
+  if (!beginMoveRows(
+          QModelIndex(), first, last, QModelIndex(), destination)) {
+    return;
+  }
+
+  const auto count = last - first + 1;
+  const auto movedNames = pluginNames.mid(first, count);
+  pluginNames.remove(first, count);
+
+  const auto insertAt = destination > first ? destination - count : destination;
+  for (int i = 0; i < count; i += 1) {
+    pluginNames.insert(insertAt + i, movedNames.at(i));
+  }
+
+  endMoveRows();
+}
+
+void PluginNameListModel::handleSourceLayoutAboutToBeChanged() {
+  emit layoutAboutToBeChanged({}, QAbstractItemModel::VerticalSortHint);
+}
+
+void PluginNameListModel::handleSourceLayoutChanged() {
+  QStringList newPluginNames;
+  QHash<QString, int> newRows;
+  newPluginNames.reserve(pluginNames.size());
+  newRows.reserve(pluginNames.size());
+
+  for (const auto& plugin : pluginItemModel->getPluginItems()) {
+    auto name = QString::fromStdString(plugin.name);
+    newRows.insert(name, static_cast<int>(newPluginNames.size()));
+    newPluginNames.append(std::move(name));
+  }
+
+  // Plugin names are unique, so each persistent index can follow its plugin.
+  const auto oldPersistentIndexes = persistentIndexList();
+  QModelIndexList newPersistentIndexes;
+  newPersistentIndexes.reserve(oldPersistentIndexes.size());
+  for (const auto& oldIndex : oldPersistentIndexes) {
+    const auto it = newRows.constFind(pluginNames.at(oldIndex.row()));
+    newPersistentIndexes.append(
+        it == newRows.constEnd() ? QModelIndex() : index(it.value()));
+  }
+
+  pluginNames = std::move(newPluginNames);
+
+  changePersistentIndexList(oldPersistentIndexes, newPersistentIndexes);
+
+  emit layoutChanged({}, QAbstractItemModel::VerticalSortHint);
+}
+
+void PluginNameListModel::handleSourceModelAboutToBeReset() {
+  beginResetModel();
+}
+
+void PluginNameListModel::handleSourceModelReset() {
+  pluginNames.clear();
+
+  for (const auto& plugin : pluginItemModel->getPluginItems()) {
+    pluginNames.append(QString::fromStdString(plugin.name));
+  }
+
+  endResetModel();
+}
+}
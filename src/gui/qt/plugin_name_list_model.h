@@ -0,0 +1,78 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_PLUGIN_NAME_LIST_MODEL
+#define LOOT_GUI_QT_PLUGIN_NAME_LIST_MODEL
+
+#include <QtCore/QAbstractListModel>
+#include <QtCore/QStringList>
+
+#include "gui/qt/plugin_item_model.h"
+
+namespace loot {
+/**
+ * A single-column list of the installed plugins' names in load order, for use
+ * by combo boxes and completers. It follows the structural changes of the
+ * given PluginItemModel row by row (skipping its general information row),
+ * and only emits dataChanged for rows whose plugin names have changed, so
+ * that views of it don't need to be repopulated when a plugin's data changes.
+ */
+class PluginNameListModel : public QAbstractListModel {
+  Q_OBJECT
+public:
+  PluginNameListModel(QObject* parent, PluginItemModel* pluginItemModel);
+
+  int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+
+  QVariant data(const QModelIndex& index,
+                int role = Qt::DisplayRole) const override;
+
+private:
+  PluginItemModel* pluginItemModel{nullptr};
+  QStringList pluginNames;
+
+  QString getSourcePluginName(int sourceRow) const;
+
+private slots:
+  void handleSourceDataChanged(const QModelIndex& topLeft,
+                               const QModelIndex& bottomRight,
+                               const QList<int>& roles);
+  void handleSourceRowsInserted(const QModelIndex& parent,
+                                int first,
+                                int last);
+  void handleSourceRowsRemoved(const QModelIndex& parent, int first, int last);
+  void handleSourceRowsMoved(const QModelIndex& parent,
+                             int start,
+                             int end,
+                             const QModelIndex& destination,
+                             int row);
+  void handleSourceLayoutAboutToBeChanged();
+  void handleSourceLayoutChanged();
+  void handleSourceModelAboutToBeReset();
+  void handleSourceModelReset();
+};
+}
+
+#endif
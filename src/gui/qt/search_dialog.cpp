@@ -35,6 +35,9 @@
 #include "gui/qt/helpers.h"
 
 namespace loot {
+// How long to wait after the last keystroke before searching.
+static constexpr int INPUT_DEBOUNCE_INTERVAL_MS = 150;
+
 SearchDialog::SearchDialog(QWidget* parent) : QDialog(parent) { setupUi(); }
 
 QVariant SearchDialog::getSearchText() const {
@@ -48,6 +51,7 @@ QVariant SearchDialog::getSearchText() const {
 }
 
 void SearchDialog::reset() {
+  inputTimer->stop();
   searchInput->clear();
   countLabel->setText("0 / 0");
 
@@ -71,9 +75,17 @@ void SearchDialog::setSearchResults(size_t resultsCount) {
   }
 }
 
+void SearchDialog::showSearchTimedOutTooltip() {
+  showRegexTimedOutTooltip(*searchInput);
+}
+
 void SearchDialog::setupUi() {
   searchInput->setObjectName("searchInput");
   regexCheckbox->setObjectName("regexCheckbox");
+  inputTimer->setObjectName("inputTimer");
+
+  inputTimer->setSingleShot(true);
+  inputTimer->setInterval(INPUT_DEBOUNCE_INTERVAL_MS);
 
   searchInput->setClearButtonEnabled(true);
 
@@ -126,12 +138,8 @@ void SearchDialog::updateCountLabel() {
                       QString::number(state.resultsCount));
 }
 
-void SearchDialog::on_searchInput_textChanged(const QString& text) {
-  searchInput->style()->polish(searchInput);
-
-  if (text.isEmpty()) {
-    reset();
-  }
+void SearchDialog::emitTextChanged() {
+  inputTimer->stop();
 
   const auto value = getSearchText();
 
@@ -147,8 +155,23 @@ void SearchDialog::on_searchInput_textChanged(const QString& text) {
   emit textChanged(value);
 }
 
+void SearchDialog::on_searchInput_textChanged(const QString& text) {
+  searchInput->style()->polish(searchInput);
+
+  if (text.isEmpty()) {
+    // Clear the results immediately.
+    reset();
+    emitTextChanged();
+    return;
+  }
+
+  inputTimer->start();
+}
+
 void SearchDialog::on_regexCheckbox_stateChanged() {
-  on_searchInput_textChanged(searchInput->text());
+  if (!searchInput->text().isEmpty()) {
+    emitTextChanged();
+  }
 }
 
 void SearchDialog::on_previousButton_clicked() {
@@ -194,4 +217,6 @@ void SearchDialog::on_nextButton_clicked() {
 
   emit currentResultChanged(newIndex);
 }
+
+void SearchDialog::on_inputTimer_timeout() { emitTextChanged(); }
 }
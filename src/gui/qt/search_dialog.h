@@ -27,6 +27,7 @@
 #define LOOT_GUI_QT_SEARCH_DIALOG
 
 #include <QtCore/QModelIndex>
+#include <QtCore/QTimer>
 #include <QtWidgets/QCheckBox>
 #include <QtWidgets/QDialog>
 #include <QtWidgets/QLabel>
@@ -50,6 +51,7 @@ public:
 
   void reset();
   void setSearchResults(size_t resultsCount);
+  void showSearchTimedOutTooltip();
 
 signals:
   void textChanged(const QVariant &text);
@@ -61,6 +63,7 @@ private:
   QPushButton *previousButton{new QPushButton(this)};
   QPushButton *nextButton{new QPushButton(this)};
   QCheckBox *regexCheckbox{new QCheckBox(this)};
+  QTimer *inputTimer{new QTimer(this)};
 
   SearchState state;
 
@@ -68,12 +71,14 @@ private:
   void translateUi();
 
   void updateCountLabel();
+  void emitTextChanged();
 
 private slots:
   void on_searchInput_textChanged(const QString &text);
   void on_regexCheckbox_stateChanged();
   void on_previousButton_clicked();
   void on_nextButton_clicked();
+  void on_inputTimer_timeout();
 };
 }
 
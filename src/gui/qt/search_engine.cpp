@@ -0,0 +1,106 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/search_engine.h"
+
+namespace loot {
+std::vector<int> findSearchMatches(const ContentMatcher& matcher,
+                                   const SearchIndex& index,
+                                   const std::function<bool()>& isCancelled) {
+  std::vector<int> rows;
+
+  if (matcher.isEmpty() || !matcher.isValid()) {
+    return rows;
+  }
+
+  for (const auto& entry : index) {
+    if (isCancelled()) {
+      return {};
+    }
+
+    if (matcher.hasExceededTimeBudget()) {
+      break;
+    }
+
+    if (matcher.matches(entry.fields)) {
+      rows.push_back(entry.row);
+    }
+  }
+
+  return rows;
+}
+
+SearchEngine::SearchEngine(QObject* parent) : QObject(parent) {
+  worker->moveToThread(&workerThread);
+  connect(&workerThread, &QThread::finished, worker, &QObject::deleteLater);
+
+  workerThread.setObjectName("searchThread");
+  workerThread.start();
+}
+
+SearchEngine::~SearchEngine() {
+  cancel();
+
+  workerThread.quit();
+  workerThread.wait();
+}
+
+void SearchEngine::search(const ContentMatcher& matcher, SearchIndex&& index) {
+  const auto searchGeneration = ++generation;
+
+  QMetaObject::invokeMethod(
+      worker,
+      [this, searchGeneration, matcher, index = std::move(index)]() {
+        const auto isCancelled = [&]() {
+          return generation != searchGeneration;
+        };
+
+        auto rows = findSearchMatches(matcher, index, isCancelled);
+        const auto hasTimedOut = matcher.hasExceededTimeBudget();
+
+        if (isCancelled()) {
+          return;
+        }
+
+        QMetaObject::invokeMethod(
+            this,
+            [this, searchGeneration, hasTimedOut, rows = std::move(rows)]() {
+              // Another search may have been started while these results
+              // were queued, in which case they're stale.
+              if (generation != searchGeneration) {
+                return;
+              }
+
+              if (hasTimedOut) {
+                emit timedOut();
+              }
+
+              emit finished(rows);
+            });
+      });
+}
+
+void SearchEngine::cancel() { ++generation; }
+}
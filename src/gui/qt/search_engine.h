@@ -0,0 +1,87 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_SEARCH_ENGINE
+#define LOOT_GUI_QT_SEARCH_ENGINE
+
+#include <QtCore/QObject>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QThread>
+#include <atomic>
+#include <functional>
+#include <vector>
+
+#include "gui/qt/content_matcher.h"
+
+namespace loot {
+struct SearchIndexEntry {
+  int row{0};
+  QStringList fields;
+};
+
+typedef std::vector<SearchIndexEntry> SearchIndex;
+
+/**
+ * Get the rows of the index entries that the given matcher matches. Returns an
+ * empty vector if isCancelled returns true while the index is being searched,
+ * and stops searching if the matcher exceeds its time budget.
+ */
+std::vector<int> findSearchMatches(const ContentMatcher& matcher,
+                                   const SearchIndex& index,
+                                   const std::function<bool()>& isCancelled);
+
+/**
+ * Searches a prebuilt index on a worker thread. Starting a new search cancels
+ * any search that is still running, and only the results of the most recent
+ * search are emitted. If a search exceeds its matcher's time budget, timedOut
+ * is emitted before finished is emitted with the results found so far.
+ */
+class SearchEngine : public QObject {
+  Q_OBJECT
+public:
+  explicit SearchEngine(QObject* parent);
+  SearchEngine(const SearchEngine&) = delete;
+  SearchEngine(SearchEngine&&) = delete;
+  ~SearchEngine();
+
+  SearchEngine& operator=(const SearchEngine&) = delete;
+  SearchEngine& operator=(SearchEngine&&) = delete;
+
+  void search(const ContentMatcher& matcher, SearchIndex&& index);
+  void cancel();
+
+signals:
+  void finished(const std::vector<int>& rows);
+  void timedOut();
+
+private:
+  QThread workerThread;
+  QObject* worker{new QObject()};
+  std::atomic<uint64_t> generation{0};
+};
+}
+
+#endif
@@ -0,0 +1,447 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/session_snapshot.h"
+
+#include <fstream>
+
+namespace {
+using loot::FileFingerprint;
+using loot::FileFingerprints;
+using loot::FileRevisionSummary;
+using loot::Location;
+using loot::MessageSource;
+using loot::MessageType;
+using loot::PluginItem;
+using loot::SourcedMessage;
+
+constexpr uint32_t LGSS_MAGIC_NUMBER = 0x53534C47;
+// Increment this whenever the snapshot's key, PluginItem or GeneralInformation
+// gain a field that is written to the snapshot.
+constexpr uint8_t LGSS_FORMAT_VERSION = 3;
+
+constexpr uint16_t IS_ACTIVE_FLAG = 1 << 0;
+constexpr uint16_t IS_DIRTY_FLAG = 1 << 1;
+constexpr uint16_t IS_EMPTY_FLAG = 1 << 2;
+constexpr uint16_t IS_MASTER_FLAG = 1 << 3;
+constexpr uint16_t IS_LIGHT_PLUGIN_FLAG = 1 << 4;
+constexpr uint16_t IS_OVERRIDE_PLUGIN_FLAG = 1 << 5;
+constexpr uint16_t LOADS_ARCHIVE_FLAG = 1 << 6;
+constexpr uint16_t HAS_USER_METADATA_FLAG = 1 << 7;
+constexpr uint16_t IS_CREATION_CLUB_PLUGIN_FLAG = 1 << 8;
+
+// Don't care about endianness because the files don't need to be portable.
+class SnapshotWriter {
+public:
+  explicit SnapshotWriter(std::ostream& out) : out(out) {}
+
+  template<typename T>
+  void write(T value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof value);
+  }
+
+  void write(const std::string& value) {
+    write(static_cast<uint32_t>(value.size()));
+    out.write(value.data(), value.size());
+  }
+
+  void write(const std::vector<std::string>& values) {
+    write(static_cast<uint32_t>(values.size()));
+    for (const auto& value : values) {
+      write(value);
+    }
+  }
+
+  void write(const std::optional<std::string>& value) {
+    write(value.has_value());
+    if (value.has_value()) {
+      write(value.value());
+    }
+  }
+
+  void write(const FileFingerprint& fingerprint) {
+    write(static_cast<uint64_t>(fingerprint.size));
+    write(static_cast<int64_t>(
+        fingerprint.lastWriteTime.time_since_epoch().count()));
+  }
+
+  void write(const FileFingerprints& fingerprints) {
+    write(static_cast<uint32_t>(fingerprints.size()));
+    for (const auto& [path, fingerprint] : fingerprints) {
+      write(path.u8string());
+      write(fingerprint.has_value());
+      if (fingerprint.has_value()) {
+        write(fingerprint.value());
+      }
+    }
+  }
+
+  void write(const FileRevisionSummary& revision) {
+    write(revision.id);
+    write(revision.date);
+  }
+
+  void write(const std::vector<SourcedMessage>& messages) {
+    write(static_cast<uint32_t>(messages.size()));
+    for (const auto& message : messages) {
+      write(static_cast<uint8_t>(message.type));
+      write(static_cast<uint32_t>(message.source));
+      write(message.text);
+    }
+  }
+
+  void write(const std::vector<Location>& locations) {
+    write(static_cast<uint32_t>(locations.size()));
+    for (const auto& location : locations) {
+      write(location.GetURL());
+      write(location.GetName());
+    }
+  }
+
+private:
+  std::ostream& out;
+};
+
+class SnapshotReader {
+public:
+  SnapshotReader(std::istream& in, const std::filesystem::path& filePath) :
+      in(in), filePath(filePath) {
+    in.seekg(0, std::ios_base::end);
+    fileSize = static_cast<uint64_t>(in.tellg());
+    in.seekg(0, std::ios_base::beg);
+  }
+
+  template<typename T>
+  T read() {
+    T value{};
+    in.read(reinterpret_cast<char*>(&value), sizeof value);
+    check();
+
+    return value;
+  }
+
+  bool readBool() { return read<uint8_t>() != 0; }
+
+  FileFingerprint readFingerprint() {
+    FileFingerprint fingerprint;
+    fingerprint.size = read<uint64_t>();
+    fingerprint.lastWriteTime = std::filesystem::file_time_type(
+        std::filesystem::file_time_type::duration(read<int64_t>()));
+
+    return fingerprint;
+  }
+
+  FileFingerprints readFingerprints() {
+    FileFingerprints fingerprints;
+    const auto count = readLength();
+    for (uint32_t i = 0; i < count; i += 1) {
+      const auto path = std::filesystem::u8path(readString());
+      if (readBool()) {
+        fingerprints.emplace(path, readFingerprint());
+      } else {
+        fingerprints.emplace(path, std::nullopt);
+      }
+    }
+
+    return fingerprints;
+  }
+
+  std::string readString() {
+    const auto length = readLength();
+
+    std::string value(length, '\0');
+    in.read(value.data(), length);
+    check();
+
+    return value;
+  }
+
+  std::vector<std::string> readStrings() {
+    std::vector<std::string> values(readLength());
+    for (auto& value : values) {
+      value = readString();
+    }
+
+    return values;
+  }
+
+  std::optional<std::string> readOptionalString() {
+    if (readBool()) {
+      return readString();
+    }
+
+    return std::nullopt;
+  }
+
+  FileRevisionSummary readRevision() {
+    auto id = readString();
+    auto date = readString();
+
+    return FileRevisionSummary(id, date);
+  }
+
+  std::vector<SourcedMessage> readMessages() {
+    std::vector<SourcedMessage> messages(readLength());
+    for (auto& message : messages) {
+      message.type = static_cast<MessageType>(read<uint8_t>());
+      message.source = static_cast<MessageSource>(read<uint32_t>());
+      message.text = readString();
+    }
+
+    return messages;
+  }
+
+  std::vector<Location> readLocations() {
+    std::vector<Location> locations;
+    const auto count = readLength();
+    locations.reserve(count);
+    for (uint32_t i = 0; i < count; i += 1) {
+      auto url = readString();
+      auto name = readString();
+      locations.push_back(Location(url, name));
+    }
+
+    return locations;
+  }
+
+  // Lengths and counts are checked against the file size so that a corrupt
+  // value can't cause a huge allocation.
+  uint32_t readLength() {
+    const auto length = read<uint32_t>();
+    if (length > fileSize) {
+      throw std::runtime_error("Failed to parse " + filePath.u8string() +
+                               ": invalid length");
+    }
+
+    return length;
+  }
+
+private:
+  std::istream& in;
+  const std::filesystem::path& filePath;
+  uint64_t fileSize{0};
+
+  void check() const {
+    if (!in.good()) {
+      throw std::runtime_error("Failed to parse " + filePath.u8string() +
+                               ": unexpected end of file");
+    }
+  }
+};
+
+void writePlugin(SnapshotWriter& writer, const PluginItem& plugin) {
+  writer.write(plugin.name);
+
+  writer.write(plugin.loadOrderIndex.has_value());
+  writer.write(plugin.loadOrderIndex.value_or(0));
+  writer.write(plugin.crc.has_value());
+  writer.write(plugin.crc.value_or(0));
+  writer.write(plugin.version);
+  writer.write(plugin.group);
+  writer.write(plugin.cleaningUtility);
+
+  uint16_t flags = 0;
+  flags |= plugin.isActive ? IS_ACTIVE_FLAG : 0;
+  flags |= plugin.isDirty ? IS_DIRTY_FLAG : 0;
+  flags |= plugin.isEmpty ? IS_EMPTY_FLAG : 0;
+  flags |= plugin.isMaster ? IS_MASTER_FLAG : 0;
+  flags |= plugin.isLightPlugin ? IS_LIGHT_PLUGIN_FLAG : 0;
+  flags |= plugin.isOverridePlugin ? IS_OVERRIDE_PLUGIN_FLAG : 0;
+  flags |= plugin.loadsArchive ? LOADS_ARCHIVE_FLAG : 0;
+  flags |= plugin.hasUserMetadata ? HAS_USER_METADATA_FLAG : 0;
+  flags |= plugin.isCreationClubPlugin ? IS_CREATION_CLUB_PLUGIN_FLAG : 0;
+  writer.write(flags);
+
+  writer.write(plugin.currentTags);
+  writer.write(plugin.addTags);
+  writer.write(plugin.removeTags);
+  writer.write(plugin.messages);
+  writer.write(plugin.locations);
+}
+
+PluginItem readPlugin(SnapshotReader& reader) {
+  PluginItem plugin;
+  plugin.name = reader.readString();
+
+  const auto hasLoadOrderIndex = reader.readBool();
+  const auto loadOrderIndex = reader.read<short>();
+  if (hasLoadOrderIndex) {
+    plugin.loadOrderIndex = loadOrderIndex;
+  }
+
+  const auto hasCrc = reader.readBool();
+  const auto crc = reader.read<uint32_t>();
+  if (hasCrc) {
+    plugin.crc = crc;
+  }
+
+  plugin.version = reader.readOptionalString();
+  plugin.group = reader.readOptionalString();
+  plugin.cleaningUtility = reader.readOptionalString();
+
+  const auto flags = reader.read<uint16_t>();
+  plugin.isActive = (flags & IS_ACTIVE_FLAG) != 0;
+  plugin.isDirty = (flags & IS_DIRTY_FLAG) != 0;
+  plugin.isEmpty = (flags & IS_EMPTY_FLAG) != 0;
+  plugin.isMaster = (flags & IS_MASTER_FLAG) != 0;
+  plugin.isLightPlugin = (flags & IS_LIGHT_PLUGIN_FLAG) != 0;
+  plugin.isOverridePlugin = (flags & IS_OVERRIDE_PLUGIN_FLAG) != 0;
+  plugin.loadsArchive = (flags & LOADS_ARCHIVE_FLAG) != 0;
+  plugin.hasUserMetadata = (flags & HAS_USER_METADATA_FLAG) != 0;
+  plugin.isCreationClubPlugin = (flags & IS_CREATION_CLUB_PLUGIN_FLAG) != 0;
+
+  plugin.currentTags = reader.readStrings();
+  plugin.addTags = reader.readStrings();
+  plugin.removeTags = reader.readStrings();
+  plugin.messages = reader.readMessages();
+  plugin.locations = reader.readLocations();
+
+  return plugin;
+}
+}
+
+namespace loot {
+// FNV-1a, used because its output is stable across runs and platforms, unlike
+// std::hash.
+uint64_t CalculatePluginNamesChecksum(const std::vector<PluginItem>& plugins) {
+  static constexpr uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325;
+  static constexpr uint64_t FNV_PRIME = 0x100000001B3;
+
+  uint64_t hash{FNV_OFFSET_BASIS};
+  const auto addByte = [&hash](uint8_t byte) {
+    hash ^= byte;
+    hash *= FNV_PRIME;
+  };
+
+  for (const auto& plugin : plugins) {
+    for (const auto character : plugin.name) {
+      addByte(static_cast<uint8_t>(character));
+    }
+
+    // Terminate the name so that adjacent names can't run together.
+    addByte(0);
+  }
+
+  return hash;
+}
+
+std::optional<SessionSnapshot> LoadSessionSnapshot(
+    const std::filesystem::path& filePath,
+    const FileFingerprint& expectedMasterlistFingerprint,
+    const FileFingerprints& expectedLoadOrderFileFingerprints) {
+  if (!std::filesystem::exists(filePath)) {
+    return std::nullopt;
+  }
+
+  std::ifstream in(filePath, std::ios_base::in | std::ios_base::binary);
+  if (!in.is_open()) {
+    throw std::runtime_error(filePath.u8string() +
+                             " could not be opened for parsing");
+  }
+
+  SnapshotReader reader(in, filePath);
+
+  if (reader.read<uint32_t>() != LGSS_MAGIC_NUMBER) {
+    throw std::runtime_error("Failed to parse " + filePath.u8string() +
+                             ": wrong magic number");
+  }
+
+  // Snapshots are disposable, so treat one written by a different version of
+  // LOOT as if it didn't exist.
+  if (reader.read<uint8_t>() != LGSS_FORMAT_VERSION) {
+    return std::nullopt;
+  }
+
+  SessionSnapshot snapshot;
+  snapshot.masterlistFingerprint = reader.readFingerprint();
+
+  if (snapshot.masterlistFingerprint != expectedMasterlistFingerprint) {
+    return std::nullopt;
+  }
+
+  // The load order may have been changed outside of LOOT.
+  snapshot.loadOrderFileFingerprints = reader.readFingerprints();
+
+  if (snapshot.loadOrderFileFingerprints !=
+      expectedLoadOrderFileFingerprints) {
+    return std::nullopt;
+  }
+
+  const auto pluginNamesChecksum = reader.read<uint64_t>();
+
+  auto& generalInformation = snapshot.generalInformation;
+  generalInformation.gameSupportsLightPlugins = reader.readBool();
+  generalInformation.masterlistRevision = reader.readRevision();
+  generalInformation.preludeRevision = reader.readRevision();
+  generalInformation.generalMessages = reader.readMessages();
+
+  const auto pluginCount = reader.readLength();
+  snapshot.plugins.reserve(pluginCount);
+  for (uint32_t i = 0; i < pluginCount; i += 1) {
+    snapshot.plugins.push_back(readPlugin(reader));
+  }
+
+  if (CalculatePluginNamesChecksum(snapshot.plugins) != pluginNamesChecksum) {
+    throw std::runtime_error("Failed to parse " + filePath.u8string() +
+                             ": plugin names checksum mismatch");
+  }
+
+  return snapshot;
+}
+
+void SaveSessionSnapshot(const std::filesystem::path& filePath,
+                         const SessionSnapshot& snapshot) {
+  std::ofstream out(
+      filePath,
+      std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+  if (!out.is_open()) {
+    throw std::runtime_error(filePath.u8string() +
+                             " could not be opened for writing");
+  }
+
+  SnapshotWriter writer(out);
+
+  writer.write(LGSS_MAGIC_NUMBER);
+  writer.write(LGSS_FORMAT_VERSION);
+  writer.write(snapshot.masterlistFingerprint);
+  writer.write(snapshot.loadOrderFileFingerprints);
+  writer.write(CalculatePluginNamesChecksum(snapshot.plugins));
+
+  const auto& generalInformation = snapshot.generalInformation;
+  writer.write(generalInformation.gameSupportsLightPlugins);
+  writer.write(generalInformation.masterlistRevision);
+  writer.write(generalInformation.preludeRevision);
+  writer.write(generalInformation.generalMessages);
+
+  writer.write(static_cast<uint32_t>(snapshot.plugins.size()));
+  for (const auto& plugin : snapshot.plugins) {
+    writePlugin(writer, plugin);
+  }
+
+  if (!out.good()) {
+    throw std::runtime_error("Failed to write " + filePath.u8string());
+  }
+}
+}
@@ -0,0 +1,70 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_SESSION_SNAPSHOT
+#define LOOT_GUI_QT_SESSION_SNAPSHOT
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "gui/plugin_item.h"
+#include "gui/qt/general_info.h"
+#include "gui/state/game/helpers.h"
+
+namespace loot {
+// The plugin cards and general information that were displayed at the end of
+// a session, so that they can be displayed while the next session's game data
+// is loaded. The snapshot is keyed by the fingerprints of the masterlist that
+// its metadata was evaluated against and of the files that the load order is
+// read from, which are cheap enough to get on the GUI thread as LOOT starts.
+// A load order that is only defined by plugin timestamps isn't covered.
+struct SessionSnapshot {
+  FileFingerprint masterlistFingerprint;
+  FileFingerprints loadOrderFileFingerprints;
+  GeneralInformation generalInformation;
+  std::vector<PluginItem> plugins;
+};
+
+// A checksum of the plugin names in order, which is written with a snapshot's
+// plugins so that a corrupt snapshot can be detected when it is loaded.
+uint64_t CalculatePluginNamesChecksum(const std::vector<PluginItem>& plugins);
+
+// Returns std::nullopt if there is no snapshot at the given path, if it was
+// written using a different format version, or if it was created using a
+// different masterlist or load order files. Throws if the file cannot be
+// parsed or its plugin names don't match their recorded checksum.
+std::optional<SessionSnapshot> LoadSessionSnapshot(
+    const std::filesystem::path& filePath,
+    const FileFingerprint& expectedMasterlistFingerprint,
+    const FileFingerprints& expectedLoadOrderFileFingerprints);
+
+void SaveSessionSnapshot(const std::filesystem::path& filePath,
+                         const SessionSnapshot& snapshot);
+}
+
+#endif
@@ -25,8 +25,6 @@
 
 #include "gui/qt/sidebar_plugin_name_delegate.h"
 
-#include "gui/qt/plugin_item_model.h"
-
 namespace loot {
 qreal getSidebarRowHeight(bool inEditMode) {
   static constexpr double MULTIPLIER = 1.125;
@@ -37,8 +35,23 @@ qreal getSidebarRowHeight(bool inEditMode) {
   return inEditMode ? lineHeight * 2.0 : lineHeight;
 }
 
-SidebarPluginNameDelegate::SidebarPluginNameDelegate(QObject* parent) :
-    QStyledItemDelegate(parent) {}
+SidebarPluginNameDelegate::SidebarPluginNameDelegate(
+    QAbstractItemView* parent) :
+    QStyledItemDelegate(parent) {
+  const auto model = parent->model();
+  if (model == nullptr) {
+    return;
+  }
+
+  // Text is cached by plugin name, so it stays valid when rows are inserted,
+  // removed, moved or filtered, and a plugin's changed text is detected when
+  // its row is next painted. The text of plugins that no longer exist is only
+  // discarded on reset, as it's small and there are few such plugins.
+  connect(model,
+          &QAbstractItemModel::modelReset,
+          this,
+          &SidebarPluginNameDelegate::clearTextCache);
+}
 
 void SidebarPluginNameDelegate::setColors(QColor selectedText,
                                           QColor unselectedGroup) {
@@ -64,7 +77,7 @@ void SidebarPluginNameDelegate::paint(QPainter* painter,
 
   painter->save();
 
-  auto pluginItem = index.data(RawDataRole).value<PluginItem>();
+  const auto& rowText = getRowText(painter, index, styleOption.rect.width());
   auto isEditorOpen = index.data(EditorStateRole).toBool();
 
   const auto isSelected = styleOption.state.testFlag(QStyle::State_Selected);
@@ -77,17 +90,9 @@ void SidebarPluginNameDelegate::paint(QPainter* painter,
     painter->setPen(pluginColor);
   }
 
-  auto name = QFontMetricsF(painter->font())
-                  .elidedText(QString::fromStdString(pluginItem.name),
-                              Qt::ElideRight,
-                              styleOption.rect.width());
-  painter->drawText(styleOption.rect, Qt::AlignLeft, name);
-
-  if (isEditorOpen && pluginItem.group.has_value() &&
-      pluginItem.group.value() != Group::DEFAULT_NAME) {
-    auto groupRect = styleOption.rect;
-    groupRect.translate(0, getSidebarRowHeight(true) / 2.0);
+  painter->drawStaticText(styleOption.rect.topLeft(), rowText.name);
 
+  if (isEditorOpen && !rowText.group.text().isEmpty()) {
     if (!isSelected) {
       const auto groupColor =
           unselectedGroupColor.isValid()
@@ -96,13 +101,79 @@ void SidebarPluginNameDelegate::paint(QPainter* painter,
       painter->setPen(groupColor);
     }
 
-    auto group = painter->fontMetrics().elidedText(
-        QString::fromStdString(pluginItem.group.value()),
-        Qt::ElideRight,
-        groupRect.width());
-    painter->drawText(groupRect, Qt::AlignLeft, group);
+    painter->drawStaticText(
+        QPointF(styleOption.rect.topLeft()) + QPointF(0, groupOffset),
+        rowText.group);
   }
 
   painter->restore();
 }
+
+const SidebarTextCache::Entry& SidebarPluginNameDelegate::getRowText(
+    QPainter* painter,
+    const QModelIndex& index,
+    int width) const {
+  if (!textCacheFont.has_value() || painter->font() != textCacheFont.value()) {
+    textCache.clear();
+    textCacheFont = painter->font();
+    groupOffset = getSidebarRowHeight(true) / 2.0;
+  }
+
+  const auto text = index.data(SidebarTextRole).value<SidebarRowText>();
+
+  const auto cachedText = textCache.find(text, width);
+  if (cachedText != nullptr) {
+    return *cachedText;
+  }
+
+  const auto fontMetrics = QFontMetricsF(painter->font());
+
+  const auto prepare = [&](const QString& fullText) {
+    QStaticText staticText(
+        fontMetrics.elidedText(fullText, Qt::ElideRight, width));
+    staticText.setTextFormat(Qt::PlainText);
+    staticText.prepare(painter->transform(), painter->font());
+    return staticText;
+  };
+
+  return textCache.insert(
+      text,
+      width,
+      prepare(text.name),
+      text.group.isEmpty() ? QStaticText() : prepare(text.group));
+}
+
+void SidebarPluginNameDelegate::clearTextCache() { textCache.clear(); }
+
+const SidebarTextCache::Entry* SidebarTextCache::find(
+    const SidebarRowText& text,
+    int width) const {
+  const auto it = entries.constFind(text.name);
+  if (it == entries.constEnd() || it->width != width ||
+      it->text.group != text.group) {
+    return nullptr;
+  }
+
+  return &it.value();
+}
+
+const SidebarTextCache::Entry& SidebarTextCache::insert(
+    const SidebarRowText& text,
+    int width,
+    QStaticText name,
+    QStaticText group) {
+  auto& entry = entries[text.name];
+  entry.width = width;
+  entry.text = text;
+  entry.name = std::move(name);
+  entry.group = std::move(group);
+
+  return entry;
+}
+
+void SidebarTextCache::clear() { entries.clear(); }
+
+size_t SidebarTextCache::size() const {
+  return static_cast<size_t>(entries.size());
+}
 }
@@ -26,17 +26,56 @@
 #ifndef LOOT_GUI_QT_SIDEBAR_PLUGIN_NAME_DELEGATE
 #define LOOT_GUI_QT_SIDEBAR_PLUGIN_NAME_DELEGATE
 
+#include <optional>
+
+#include <QtCore/QHash>
+#include <QtGui/QFont>
 #include <QtGui/QPainter>
+#include <QtGui/QStaticText>
+#include <QtWidgets/QAbstractItemView>
 #include <QtWidgets/QApplication>
 #include <QtWidgets/QStyledItemDelegate>
 
+#include "gui/qt/plugin_item_model.h"
+
 namespace loot {
 qreal getSidebarRowHeight(bool inEditMode);
 
+// Holds each plugin's elided and laid-out sidebar text, keyed by plugin name
+// so that it stays valid when the plugin's row changes. A plugin's text is
+// only reused at the width it was laid out for, and while its name and group
+// are unchanged.
+class SidebarTextCache {
+public:
+  struct Entry {
+    int width{0};
+    SidebarRowText text;
+    QStaticText name;
+    // Empty if the plugin is in the default group.
+    QStaticText group;
+  };
+
+  const Entry* find(const SidebarRowText& text, int width) const;
+
+  const Entry& insert(const SidebarRowText& text,
+                      int width,
+                      QStaticText name,
+                      QStaticText group);
+
+  void clear();
+
+  size_t size() const;
+
+private:
+  QHash<QString, Entry> entries;
+};
+
+// The delegate caches each plugin's elided and laid-out text, so the view's
+// model must be set before the delegate is created.
 class SidebarPluginNameDelegate : public QStyledItemDelegate {
   Q_OBJECT
 public:
-  explicit SidebarPluginNameDelegate(QObject* parent);
+  explicit SidebarPluginNameDelegate(QAbstractItemView* parent);
 
   void setColors(QColor selectedName, QColor selectedGroup);
 
@@ -47,6 +86,15 @@ public:
 private:
   QColor selectedTextColor;
   QColor unselectedGroupColor;
+
+  mutable SidebarTextCache textCache;
+  mutable std::optional<QFont> textCacheFont;
+  mutable qreal groupOffset{0};
+
+  const SidebarTextCache::Entry& getRowText(QPainter* painter,
+                                            const QModelIndex& index,
+                                            int width) const;
+  void clearTextCache();
 };
 }
 
@@ -126,7 +126,7 @@ void CheckForUpdateTask::sendHttpRequest(
 void CheckForUpdateTask::onGetLatestReleaseReplyFinished() {
   try {
     const auto logger = getLogger();
-    if (logger) {
+    if (isTraceLoggingEnabled(logger)) {
       logger->trace(
           "Finished receiving a response for getting the latest release's tag");
     }
@@ -167,7 +167,7 @@ void CheckForUpdateTask::onGetLatestReleaseReplyFinished() {
 void CheckForUpdateTask::onGetTagCommitReplyFinished() {
   try {
     const auto logger = getLogger();
-    if (logger) {
+    if (isTraceLoggingEnabled(logger)) {
       logger->trace(
           "Finished receiving a response for getting the latest release tag's "
           "commit");
@@ -209,7 +209,7 @@ void CheckForUpdateTask::onGetTagCommitReplyFinished() {
 void CheckForUpdateTask::onGetBuildCommitReplyFinished() {
   try {
     const auto logger = getLogger();
-    if (logger) {
+    if (isTraceLoggingEnabled(logger)) {
       logger->trace(
           "Finished receiving a response for getting the LOOT build's "
           "commit");
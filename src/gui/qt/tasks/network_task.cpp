@@ -25,9 +25,21 @@
 
 #include "gui/qt/tasks/network_task.h"
 
+#include <QtCore/QThreadStorage>
 #include <boost/locale.hpp>
 
 namespace loot {
+QNetworkAccessManager &NetworkTask::getNetworkAccessManager() {
+  static QThreadStorage<QNetworkAccessManager *> networkAccessManagers;
+
+  // Lazily create the manager so that it's created in the correct thread.
+  if (!networkAccessManagers.hasLocalData()) {
+    networkAccessManagers.setLocalData(new QNetworkAccessManager());
+  }
+
+  return *networkAccessManagers.localData();
+}
+
 void NetworkTask::handleException(const std::exception &exception) {
   const auto logger = getLogger();
   if (logger) {
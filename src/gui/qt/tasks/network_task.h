@@ -26,6 +26,7 @@
 #ifndef LOOT_GUI_QT_TASKS_NETWORK_TASK
 #define LOOT_GUI_QT_TASKS_NETWORK_TASK
 
+#include <QtNetwork/QNetworkAccessManager>
 #include <QtNetwork/QNetworkReply>
 
 #include "gui/qt/tasks/tasks.h"
@@ -34,6 +35,14 @@ namespace loot {
 class NetworkTask : public Task {
   Q_OBJECT
 protected:
+  // Get the current thread's network access manager. A QNetworkAccessManager
+  // can only be used from the thread that created it, so it's only shared by
+  // network tasks that run one after another in the same worker thread (e.g.
+  // those run by a SequentialTaskExecutor), which can reuse its connections.
+  // Tasks run in parallel each get their own. It's deleted when the thread
+  // exits.
+  static QNetworkAccessManager &getNetworkAccessManager();
+
   void handleException(const std::exception &exception);
 
 protected slots:
@@ -0,0 +1,84 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/tasks/prefetched_query.h"
+
+namespace loot {
+PrefetchedQuery::PrefetchedQuery(std::unique_ptr<Query> query) :
+    PrefetchedQuery(std::move(query), nullptr) {}
+
+PrefetchedQuery::PrefetchedQuery(
+    std::unique_ptr<Query> query,
+    std::function<GeneralInformation()> getGeneralInformation) {
+  const auto task =
+      new QueryTask(std::move(query), std::move(getGeneralInformation));
+
+  task->moveToThread(&workerThread);
+  connect(&workerThread, &QThread::finished, task, &QObject::deleteLater);
+  connect(task,
+          &Task::generalInformationLoaded,
+          this,
+          &PrefetchedQuery::onGeneralInformationLoaded);
+  connect(task, &Task::finished, this, &PrefetchedQuery::onTaskFinished);
+  connect(task, &Task::error, this, &PrefetchedQuery::onTaskError);
+  connect(&workerThread, &QThread::started, task, &Task::execute);
+
+  workerThread.setObjectName("prefetchThread");
+  workerThread.start();
+}
+
+PrefetchedQuery::~PrefetchedQuery() {
+  workerThread.quit();
+  workerThread.wait();
+}
+
+bool PrefetchedQuery::isDone() const {
+  return result.has_value() || errorMessage.has_value();
+}
+
+const std::optional<GeneralInformation> &
+PrefetchedQuery::getGeneralInformation() const {
+  return generalInformation;
+}
+
+void PrefetchedQuery::onGeneralInformationLoaded(
+    GeneralInformation loadedGeneralInformation) {
+  generalInformation = std::move(loadedGeneralInformation);
+}
+
+void PrefetchedQuery::onTaskFinished(QueryResult queryResult) {
+  workerThread.quit();
+
+  result = queryResult;
+  emit finished(queryResult);
+}
+
+void PrefetchedQuery::onTaskError(const std::string &message) {
+  workerThread.quit();
+
+  errorMessage = message;
+  emit error(message);
+}
+}
@@ -0,0 +1,93 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_TASKS_PREFETCHED_QUERY
+#define LOOT_GUI_QT_TASKS_PREFETCHED_QUERY
+
+#include <QtCore/QThread>
+#include <optional>
+#include <string>
+
+#include "gui/qt/tasks/tasks.h"
+
+namespace loot {
+// Runs a query in a worker thread as soon as it is constructed, and holds on
+// to its outcome so that it can be handled by an object that didn't exist yet
+// when the query was started.
+class PrefetchedQuery : public QObject {
+  Q_OBJECT
+public:
+  explicit PrefetchedQuery(std::unique_ptr<Query> query);
+
+  // getGeneralInformation is called in the worker thread once the query has
+  // finished, and its result is available before the query's result is
+  // delivered.
+  PrefetchedQuery(std::unique_ptr<Query> query,
+                  std::function<GeneralInformation()> getGeneralInformation);
+  PrefetchedQuery(const PrefetchedQuery &) = delete;
+  PrefetchedQuery(PrefetchedQuery &&) = delete;
+  ~PrefetchedQuery();
+
+  PrefetchedQuery &operator=(const PrefetchedQuery &) = delete;
+  PrefetchedQuery &operator=(PrefetchedQuery &&) = delete;
+
+  bool isDone() const;
+
+  const std::optional<GeneralInformation> &getGeneralInformation() const;
+
+  // If the query is done, immediately call the handler for its outcome,
+  // otherwise call it once the query is done.
+  template<typename Receiver>
+  void deliverTo(Receiver *receiver,
+                 void (Receiver::*onFinished)(QueryResult),
+                 void (Receiver::*onError)(const std::string &)) {
+    if (result.has_value()) {
+      (receiver->*onFinished)(result.value());
+    } else if (errorMessage.has_value()) {
+      (receiver->*onError)(errorMessage.value());
+    } else {
+      connect(this, &PrefetchedQuery::finished, receiver, onFinished);
+      connect(this, &PrefetchedQuery::error, receiver, onError);
+    }
+  }
+
+signals:
+  void finished(QueryResult result);
+  void error(const std::string &message);
+
+private:
+  QThread workerThread;
+  std::optional<QueryResult> result;
+  std::optional<std::string> errorMessage;
+  std::optional<GeneralInformation> generalInformation;
+
+private slots:
+  void onGeneralInformationLoaded(GeneralInformation generalInformation);
+  void onTaskFinished(QueryResult result);
+  void onTaskError(const std::string &message);
+};
+}
+
+#endif
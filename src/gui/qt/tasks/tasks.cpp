@@ -25,9 +25,78 @@
 
 #include "gui/qt/tasks/tasks.h"
 
+#include <boost/core/demangle.hpp>
+#include <chrono>
+#include <typeinfo>
+
+#include "gui/qt/diagnostics.h"
+
 namespace loot {
+namespace {
+// Strip any namespaces, template arguments and "class " prefixes from the
+// given type name.
+std::string getUnqualifiedTypeName(std::string typeName) {
+  const auto templateStart = typeName.find('<');
+  if (templateStart != std::string::npos) {
+    typeName.erase(templateStart);
+  }
+
+  const auto lastSeparator = typeName.rfind("::");
+  if (lastSeparator != std::string::npos) {
+    typeName.erase(0, lastSeparator + 2);
+  }
+
+  const auto lastSpace = typeName.rfind(' ');
+  if (lastSpace != std::string::npos) {
+    typeName.erase(0, lastSpace + 1);
+  }
+
+  return typeName;
+}
+
+void recordTaskDuration(const Task *task, const QElapsedTimer &timer) {
+  if (task != nullptr && timer.isValid()) {
+    RecordTaskDuration(task->getName(),
+                       std::chrono::milliseconds(timer.elapsed()));
+  }
+}
+}
+
+std::string Task::getName() const {
+  return getUnqualifiedTypeName(metaObject()->className());
+}
+
+void Task::setGeneralInformationGetter(
+    std::function<GeneralInformation()> getter) {
+  getGeneralInformation = std::move(getter);
+}
+
+void Task::finish(QueryResult result) {
+  if (getGeneralInformation) {
+    emit generalInformationLoaded(getGeneralInformation());
+  }
+
+  emit finished(result);
+}
+
 QueryTask::QueryTask(std::unique_ptr<Query> query) : query(std::move(query)) {}
 
+QueryTask::QueryTask(
+    std::unique_ptr<Query> query,
+    std::function<GeneralInformation()> getGeneralInformation) :
+    query(std::move(query)) {
+  setGeneralInformationGetter(std::move(getGeneralInformation));
+}
+
+std::string QueryTask::getName() const {
+  if (query == nullptr) {
+    return Task::getName();
+  }
+
+  const auto &queryRef = *query;
+  return getUnqualifiedTypeName(boost::core::demangle(typeid(queryRef).name()));
+}
+
 void QueryTask::execute() {
   try {
     if (query == nullptr) {
@@ -35,7 +104,9 @@ void QueryTask::execute() {
           "Attempted to execute a query with no query set!");
     }
 
-    emit finished(query->executeLogic());
+    auto result = query->executeLogic();
+
+    finish(result);
   } catch (const std::exception &e) {
     auto logger = getLogger();
     if (logger) {
@@ -68,6 +139,10 @@ SequentialTaskExecutor::SequentialTaskExecutor(QObject *parent,
           &QThread::finished,
           this,
           &SequentialTaskExecutor::onWorkerThreadFinished);
+  connect(&workerThread, &QThread::started, &RecordWorkerThreadStarted);
+  connect(&workerThread, &QThread::finished, &RecordWorkerThreadFinished);
+
+  connect(this, &TaskExecutor::start, this, [this]() { taskTimer.start(); });
 
   if (!tasks.empty()) {
     auto firstTask = tasks.at(currentTask);
@@ -88,6 +163,8 @@ void SequentialTaskExecutor::onTaskFinished(QueryResult result) {
 
   auto task = qobject_cast<Task *>(sender());
 
+  recordTaskDuration(task, taskTimer);
+
   // Disconnect the finished task from the start signal so that it doesn't
   // get restarted when the start signal is next sent.
   disconnect(this, &TaskExecutor::start, task, &Task::execute);
@@ -122,6 +199,8 @@ ParallelTaskExecutor::ParallelTaskExecutor(QObject *parent,
     throw std::invalid_argument("Tasks must not be empty");
   }
 
+  connect(this, &TaskExecutor::start, this, [this]() { tasksTimer.start(); });
+
   // Create a worker thread for each task.
   for (auto task : tasks) {
     const auto workerThread = new QThread(this);
@@ -138,6 +217,8 @@ ParallelTaskExecutor::ParallelTaskExecutor(QObject *parent,
             &QThread::finished,
             this,
             &ParallelTaskExecutor::onWorkerThreadFinished);
+    connect(workerThread, &QThread::started, &RecordWorkerThreadStarted);
+    connect(workerThread, &QThread::finished, &RecordWorkerThreadFinished);
 
     workerThread->setObjectName("workerThread");
     workerThread->start();
@@ -158,6 +239,8 @@ void ParallelTaskExecutor::onTaskFinished(QueryResult result) {
 
   const auto task = qobject_cast<Task *>(sender());
 
+  recordTaskDuration(task, tasksTimer);
+
   task->thread()->quit();
 }
 
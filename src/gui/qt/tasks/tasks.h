@@ -26,10 +26,13 @@
 #ifndef LOOT_GUI_QT_TASKS_TASKS
 #define LOOT_GUI_QT_TASKS_TASKS
 
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QMetaType>
 #include <QtCore/QString>
 #include <QtCore/QThread>
+#include <functional>
 
+#include "gui/qt/general_info.h"
 #include "gui/query/query.h"
 
 Q_DECLARE_METATYPE(loot::QueryResult);
@@ -44,12 +47,30 @@ signals:
 
 class Task : public QObject {
   Q_OBJECT
+public:
+  // Identifies the type of task in diagnostics.
+  virtual std::string getName() const;
+
+  // getGeneralInformation is called in the task's thread once the task has
+  // done its work, and its result is emitted before the task's result.
+  void setGeneralInformationGetter(
+      std::function<GeneralInformation()> getGeneralInformation);
+
 public slots:
   virtual void execute() = 0;
 
 signals:
   void finished(QueryResult result);
   void error(const std::string &exception);
+  void generalInformationLoaded(GeneralInformation generalInformation);
+
+protected:
+  // Emits the general information if there's a getter for it, then the
+  // result.
+  void finish(QueryResult result);
+
+private:
+  std::function<GeneralInformation()> getGeneralInformation;
 };
 
 class QueryTask : public Task {
@@ -57,6 +78,11 @@ class QueryTask : public Task {
 public:
   explicit QueryTask(std::unique_ptr<Query> query);
 
+  QueryTask(std::unique_ptr<Query> query,
+            std::function<GeneralInformation()> getGeneralInformation);
+
+  std::string getName() const override;
+
 public slots:
   void execute() override;
 
@@ -89,6 +115,7 @@ private:
   QThread workerThread;
   std::vector<Task *> tasks;
   size_t currentTask{0};
+  QElapsedTimer taskTimer;
 
   std::vector<QueryResult> taskResults;
 
@@ -114,6 +141,7 @@ private:
   std::vector<Task *> tasks;
   std::vector<QueryResult> taskResults;
   std::vector<QThread *> workerThreads;
+  QElapsedTimer tasksTimer;
 
 private slots:
   void onTaskFinished(QueryResult result);
@@ -27,6 +27,36 @@
 
 #include "gui/qt/helpers.h"
 
+namespace {
+using loot::HttpCacheValidators;
+using loot::MasterlistUpdateTarget;
+
+// Get validators that can be used for a request whose response will be written
+// to all the given targets. If the targets don't all have the same validators
+// (e.g. one was downloaded more recently than another), no validators are
+// used, as a Not Modified response would then not be valid for all of them.
+HttpCacheValidators getSharedHttpCacheValidators(
+    const std::vector<const MasterlistUpdateTarget *> &targets) {
+  if (targets.empty()) {
+    return HttpCacheValidators();
+  }
+
+  const auto validators =
+      loot::getHttpCacheValidators(targets.front()->masterlistPath);
+  if (validators.empty()) {
+    return validators;
+  }
+
+  for (auto it = std::next(targets.begin()); it != targets.end(); ++it) {
+    if (!(loot::getHttpCacheValidators((*it)->masterlistPath) == validators)) {
+      return HttpCacheValidators();
+    }
+  }
+
+  return validators;
+}
+}
+
 namespace loot {
 UpdatePreludeTask::UpdatePreludeTask(const LootState &state) :
     preludeSource(state.getSettings().getPreludeSource()),
@@ -34,31 +64,26 @@ UpdatePreludeTask::UpdatePreludeTask(const LootState &state) :
 
 void UpdatePreludeTask::execute() {
   try {
-    // Delay construction of the manager so that it's created in the correct
-    // thread.
-    if (networkAccessManager == nullptr) {
-      networkAccessManager = new QNetworkAccessManager(this);
-    }
-
     if (!isValidUrl(preludeSource)) {
       // Treat the source as a local path, and copy the file from there.
       auto sourcePath = std::filesystem::u8path(preludeSource);
 
       const auto preludeUpdated = updateFile(sourcePath, preludePath);
 
-      emit finished(preludeUpdated);
+      finish(preludeUpdated);
       return;
     }
 
     auto logger = getLogger();
-    if (logger) {
+    if (isTraceLoggingEnabled(logger)) {
       logger->trace("Sending a prelude update request to GET {}",
                     preludeSource);
     }
 
     QNetworkRequest request(QUrl(QString::fromStdString(preludeSource)));
+    setConditionalRequestHeaders(request, getHttpCacheValidators(preludePath));
 
-    const auto reply = networkAccessManager->get(request);
+    const auto reply = getNetworkAccessManager().get(request);
 
     connect(reply,
             &QNetworkReply::finished,
@@ -79,22 +104,22 @@ void UpdatePreludeTask::execute() {
 void UpdatePreludeTask::onReplyFinished() {
   try {
     auto logger = getLogger();
-    if (logger) {
+    if (isTraceLoggingEnabled(logger)) {
       logger->trace("Finished receiving a response for prelude update");
     }
 
-    auto responseData =
-        readHttpResponse(qobject_cast<QNetworkReply *>(sender()));
+    const auto response =
+        readHttpFileResponse(qobject_cast<QNetworkReply *>(sender()));
 
-    if (!responseData.has_value()) {
+    if (!response.has_value()) {
       emit error("Prelude update response errored");
       return;
     }
 
     const auto preludeUpdated =
-        updateFileWithData(preludePath, responseData.value());
+        updateFileWithResponse(preludePath, response.value());
 
-    emit finished(preludeUpdated);
+    finish(preludeUpdated);
   } catch (const std::exception &e) {
     handleException(e);
   }
@@ -115,31 +140,27 @@ UpdateMasterlistTask::UpdateMasterlistTask(
 
 void UpdateMasterlistTask::execute() {
   try {
-    // Delay construction of the manager so that it's created in the correct
-    // thread.
-    if (networkAccessManager == nullptr) {
-      networkAccessManager = new QNetworkAccessManager(this);
-    }
-
     if (!isValidUrl(masterlistSource)) {
       // Treat the source as a local path, and copy the file from there.
       const auto sourcePath = std::filesystem::u8path(masterlistSource);
 
       const auto masterlistUpdated = updateFile(sourcePath, masterlistPath);
 
-      emit finished(std::make_pair(gameFolderName, masterlistUpdated));
+      finish(std::make_pair(gameFolderName, masterlistUpdated));
       return;
     }
 
     auto logger = getLogger();
-    if (logger) {
+    if (isTraceLoggingEnabled(logger)) {
       logger->trace("Sending a masterlist update request to GET {}",
                     masterlistSource);
     }
 
     QNetworkRequest request(QUrl(QString::fromStdString(masterlistSource)));
+    setConditionalRequestHeaders(request,
+                                 getHttpCacheValidators(masterlistPath));
 
-    const auto reply = networkAccessManager->get(request);
+    const auto reply = getNetworkAccessManager().get(request);
 
     connect(reply,
             &QNetworkReply::finished,
@@ -162,22 +183,154 @@ void UpdateMasterlistTask::execute() {
 void UpdateMasterlistTask::onReplyFinished() {
   try {
     auto logger = getLogger();
-    if (logger) {
+    if (isTraceLoggingEnabled(logger)) {
       logger->trace("Finished receiving a response for masterlist update");
     }
 
-    auto responseData =
-        readHttpResponse(qobject_cast<QNetworkReply *>(sender()));
+    const auto response =
+        readHttpFileResponse(qobject_cast<QNetworkReply *>(sender()));
 
-    if (!responseData.has_value()) {
+    if (!response.has_value()) {
       emit error("Masterlist update response errored");
       return;
     }
 
     const auto masterlistUpdated =
-        updateFileWithData(masterlistPath, responseData.value());
+        updateFileWithResponse(masterlistPath, response.value());
+
+    finish(std::make_pair(gameFolderName, masterlistUpdated));
+  } catch (const std::exception &e) {
+    handleException(e);
+  }
+}
+
+UpdateMasterlistsTask::UpdateMasterlistsTask(
+    std::vector<MasterlistUpdateTarget> targets) :
+    targets(std::move(targets)) {}
+
+void UpdateMasterlistsTask::execute() {
+  try {
+    result = MasterlistsUpdateResult();
+    pendingReplies.clear();
+
+    const auto logger = getLogger();
+
+    std::map<std::string, std::vector<const MasterlistUpdateTarget *>>
+        targetsBySource;
+    for (const auto &target : targets) {
+      if (isValidUrl(target.masterlistSource)) {
+        targetsBySource[target.masterlistSource].push_back(&target);
+        continue;
+      }
+
+      // Treat the source as a local path, and copy the file from there.
+      try {
+        const auto sourcePath =
+            std::filesystem::u8path(target.masterlistSource);
+
+        const auto masterlistUpdated =
+            updateFile(sourcePath, target.masterlistPath);
+
+        result.updates.push_back(
+            std::make_pair(target.gameFolderName, masterlistUpdated));
+      } catch (const std::exception &e) {
+        if (logger) {
+          logger->error("Failed to update the masterlist for {}: {}",
+                        target.gameFolderName,
+                        e.what());
+        }
+        result.errors.push_back(e.what());
+      }
+    }
+
+    for (const auto &[source, sourceTargets] : targetsBySource) {
+      if (isTraceLoggingEnabled(logger)) {
+        logger->trace(
+            "Sending a masterlist update request for {} games to GET {}",
+            sourceTargets.size(),
+            source);
+      }
+
+      QNetworkRequest request(QUrl(QString::fromStdString(source)));
+      setConditionalRequestHeaders(request,
+                                   getSharedHttpCacheValidators(sourceTargets));
+
+      const auto reply = getNetworkAccessManager().get(request);
+
+      pendingReplies.emplace(reply, sourceTargets);
+
+      // Network and SSL errors are handled once the reply finishes, as
+      // emitting error() would stop the other sources' updates.
+      connect(reply,
+              &QNetworkReply::finished,
+              this,
+              &UpdateMasterlistsTask::onReplyFinished);
+    }
+
+    finishIfDone();
+  } catch (const std::exception &e) {
+    handleException(e);
+  }
+}
+
+void UpdateMasterlistsTask::finishIfDone() {
+  if (pendingReplies.empty()) {
+    finish(result);
+  }
+}
+
+void UpdateMasterlistsTask::onReplyFinished() {
+  try {
+    const auto reply = qobject_cast<QNetworkReply *>(sender());
+    const auto it = pendingReplies.find(reply);
+    if (it == pendingReplies.end()) {
+      return;
+    }
+
+    const auto sourceTargets = it->second;
+    pendingReplies.erase(it);
+
+    const auto logger = getLogger();
+    if (isTraceLoggingEnabled(logger)) {
+      logger->trace(
+          "Finished receiving a response for masterlist update from {}",
+          reply->url().toString().toStdString());
+    }
+
+    const auto errorString =
+        reply->error() == QNetworkReply::NoError
+            ? std::string("Masterlist update response errored")
+            : reply->errorString().toStdString();
+
+    const auto response = readHttpFileResponse(reply);
+
+    if (!response.has_value()) {
+      if (logger) {
+        logger->error("Failed to fetch the masterlist from {}: {}",
+                      reply->url().toString().toStdString(),
+                      errorString);
+      }
+      result.errors.push_back(errorString);
+    } else {
+      for (const auto target : sourceTargets) {
+        try {
+          const auto masterlistUpdated =
+              updateFileWithResponse(target->masterlistPath, response.value());
+
+          result.updates.push_back(
+              std::make_pair(target->gameFolderName, masterlistUpdated));
+        } catch (const std::exception &e) {
+          if (logger) {
+            logger->error("Failed to update the masterlist for {}: {}",
+                          target->gameFolderName,
+                          e.what());
+          }
+          result.errors.push_back(e.what());
+        }
+      }
+    }
 
-    emit finished(std::make_pair(gameFolderName, masterlistUpdated));
+    finishIfDone();
   } catch (const std::exception &e) {
     handleException(e);
   }
@@ -26,7 +26,7 @@
 #ifndef LOOT_GUI_QT_TASKS_UPDATE_MASTERLIST_TASK
 #define LOOT_GUI_QT_TASKS_UPDATE_MASTERLIST_TASK
 
-#include <QtNetwork/QNetworkAccessManager>
+#include <map>
 
 #include "gui/qt/tasks/network_task.h"
 
@@ -43,8 +43,6 @@ private:
   std::string preludeSource;
   std::filesystem::path preludePath;
 
-  QNetworkAccessManager* networkAccessManager{nullptr};
-
 private slots:
   void onReplyFinished();
 };
@@ -65,7 +63,37 @@ private:
   std::string masterlistSource;
   std::filesystem::path masterlistPath;
 
-  QNetworkAccessManager* networkAccessManager{nullptr};
+private slots:
+  void onReplyFinished();
+};
+
+struct MasterlistUpdateTarget {
+  std::string gameFolderName;
+  std::string masterlistSource;
+  std::filesystem::path masterlistPath;
+};
+
+// Updates the masterlists for many games at once, fetching each distinct
+// source URL only once and writing the response to every game that uses it.
+// A failure to fetch one source does not stop the others from being updated:
+// its error message is included in the MasterlistsUpdateResult that the task
+// emits through finished(), alongside the results for the games that could be
+// updated.
+class UpdateMasterlistsTask : public NetworkTask {
+  Q_OBJECT
+public:
+  explicit UpdateMasterlistsTask(std::vector<MasterlistUpdateTarget> targets);
+
+public slots:
+  void execute() override;
+
+private:
+  std::vector<MasterlistUpdateTarget> targets;
+  std::map<QNetworkReply*, std::vector<const MasterlistUpdateTarget*>>
+      pendingReplies;
+  MasterlistsUpdateResult result;
+
+  void finishIfDone();
 
 private slots:
   void onReplyFinished();
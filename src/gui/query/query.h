@@ -41,16 +41,39 @@ namespace loot {
 typedef std::vector<std::pair<std::string, std::optional<short>>>
     CancelSortResult;
 typedef std::pair<std::string, bool> MasterlistUpdateResult;
+typedef std::vector<MasterlistUpdateResult> MasterlistUpdateResults;
+// The results of updating many masterlists at once. Failures to update some of
+// the masterlists don't stop the others from being updated, and their error
+// messages are collected so that they can be reported together.
+struct MasterlistsUpdateResult {
+  MasterlistUpdateResults updates;
+  std::vector<std::string> errors;
+};
 typedef std::vector<PluginItem> PluginItems;
 typedef std::vector<std::pair<PluginItem, bool>> GetOverlappingPluginsResult;
 
+// A plugin's entry in a sorted load order. If the plugin's item from before
+// sorting could be reused, previousIndex is its index in the pre-sort items
+// and only its load order index and CRC need updating, otherwise item holds a
+// newly-built PluginItem.
+struct SortedPluginItem {
+  std::string name;
+  std::optional<size_t> previousIndex;
+  std::optional<short> loadOrderIndex;
+  std::optional<uint32_t> crc;
+  std::optional<PluginItem> item;
+};
+typedef std::vector<SortedPluginItem> SortPluginsResult;
+
 typedef std::variant<std::monostate,
                      bool,
                      CancelSortResult,
                      MasterlistUpdateResult,
+                     MasterlistsUpdateResult,
                      PluginItems,
                      PluginItem,
-                     GetOverlappingPluginsResult>
+                     GetOverlappingPluginsResult,
+                     SortPluginsResult>
     QueryResult;
 
 class Query {
@@ -42,7 +42,7 @@ public:
 
   QueryResult executeLogic() override {
     auto logger = getLogger();
-    if (logger) {
+    if (isTraceLoggingEnabled(logger)) {
       logger->trace("User has accepted sorted load order, applying it.");
     }
     try {
@@ -26,8 +26,6 @@ along with LOOT.  If not, see
 #ifndef LOOT_GUI_QUERY_CANCEL_SORT_QUERY
 #define LOOT_GUI_QUERY_CANCEL_SORT_QUERY
 
-#include <functional>
-
 #include "gui/query/query.h"
 #include "gui/state/game/game.h"
 
@@ -39,20 +37,18 @@ public:
 
   QueryResult executeLogic() override {
     auto logger = getLogger();
-    if (logger) {
+    if (isTraceLoggingEnabled(logger)) {
       logger->trace("User has rejected sorted load order, discarding it.");
     }
 
     counter_.DecrementUnappliedChangeCounter();
     game_.DecrementLoadOrderSortCount();
 
-    const std::function<std::pair<std::string, std::optional<short>>(
-        const PluginInterface* const, std::optional<short>, bool)>
-        mapper = [](const PluginInterface* const plugin,
-                    std::optional<short> loadOrderIndex,
-                    bool) {
-          return std::make_pair(plugin->GetName(), loadOrderIndex);
-        };
+    const auto mapper = [](const PluginInterface* const plugin,
+                           std::optional<short> loadOrderIndex,
+                           bool) {
+      return std::make_pair(plugin->GetName(), loadOrderIndex);
+    };
 
     return MapFromLoadOrderData(game_, game_.GetLoadOrder(), mapper);
   }
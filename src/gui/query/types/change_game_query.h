@@ -42,10 +42,10 @@ public:
 
   QueryResult executeLogic() override {
     gamesManager_.SetCurrentGame(gameFolder_);
-    gamesManager_.GetCurrentGame().Init();
+    gamesManager_.InitialiseCurrentGameData();
 
     GetGameDataQuery subQuery(
-        gamesManager_.GetCurrentGame(), language_, sendProgressUpdate_);
+        gamesManager_.GetCurrentGame(), language_, false, sendProgressUpdate_);
 
     return subQuery.executeLogic();
   }
@@ -46,9 +46,8 @@ public:
 
     // Clear the user metadata.
     game_.ClearAllUserMetadata();
-    game_.SaveUserMetadata();
 
-    if (logger) {
+    if (isTraceLoggingEnabled(logger)) {
       logger->trace(
           "Rederiving display metadata for {} plugins that had user "
           "metadata.",
@@ -44,7 +44,6 @@ public:
     }
 
     game_.ClearUserMetadata(pluginName_);
-    game_.SaveUserMetadata();
 
     auto plugin = game_.GetPlugin(pluginName_);
     if (plugin) {
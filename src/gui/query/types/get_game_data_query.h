@@ -35,11 +35,17 @@ along with LOOT.  If not, see
 namespace loot {
 class GetGameDataQuery : public Query {
 public:
+  // If reloadUnchangedPlugins is true, all installed plugins are reloaded
+  // even if their files don't appear to have changed since they were last
+  // loaded, e.g. because the user has explicitly asked for the content to be
+  // refreshed.
   GetGameDataQuery(gui::Game& game,
                    std::string language,
+                   bool reloadUnchangedPlugins,
                    std::function<void(std::string)> sendProgressUpdate) :
       game_(game),
       language_(language),
+      reloadUnchangedPlugins_(reloadUnchangedPlugins),
       sendProgressUpdate_(sendProgressUpdate) {}
 
   QueryResult executeLogic() override {
@@ -47,7 +53,9 @@ public:
         "Parsing, merging and evaluating metadata..."));
 
     /* If the game's plugins object is empty, this is the first time loading
-       the game data, so also load the metadata lists. */
+       the game data, so load everything. Otherwise only reload the data that
+       has changed since it was last loaded, which is detected using file
+       sizes and modification times, unless a full reload was requested. */
     bool isFirstLoad = game_.GetPlugins().empty();
 
     std::exception_ptr exceptionPointer;
@@ -55,7 +63,11 @@ public:
 
     threads.push_back(std::thread([&]() {
       try {
-        game_.LoadAllInstalledPlugins(true);
+        if (isFirstLoad || reloadUnchangedPlugins_) {
+          game_.LoadAllInstalledPlugins(true);
+        } else {
+          game_.LoadChangedInstalledPlugins();
+        }
       } catch (...) {
         if (exceptionPointer == nullptr) {
           exceptionPointer = std::current_exception();
@@ -63,7 +75,7 @@ public:
       }
     }));
 
-    if (isFirstLoad) {
+    if (isFirstLoad || game_.IsMetadataStale()) {
       threads.push_back(std::thread([&]() {
         try {
           game_.LoadMetadata();
@@ -101,6 +113,7 @@ public:
 private:
   gui::Game& game_;
   std::string language_;
+  bool reloadUnchangedPlugins_;
   std::function<void(std::string)> sendProgressUpdate_;
 };
 }
@@ -62,17 +62,15 @@ private:
                                "\" is not loaded.");
     }
 
-    const std::function<std::pair<PluginItem, bool>(
-        const PluginInterface* const, std::optional<short>, bool)>
-        mapper = [&](const PluginInterface* const otherPlugin,
-                     std::optional<short> loadOrderIndex,
-                     bool isActive) {
-          const auto pluginItem = PluginItem(
-              *otherPlugin, game_, loadOrderIndex, isActive, language_);
-          const auto overlap = plugin->DoRecordsOverlap(*otherPlugin);
-
-          return std::make_pair(pluginItem, overlap);
-        };
+    const auto mapper = [&](const PluginInterface* const otherPlugin,
+                            std::optional<short> loadOrderIndex,
+                            bool isActive) {
+      auto pluginItem = PluginItem(
+          *otherPlugin, game_, loadOrderIndex, isActive, language_);
+      const auto overlap = plugin->DoRecordsOverlap(*otherPlugin);
+
+      return std::make_pair(std::move(pluginItem), overlap);
+    };
 
     return MapFromLoadOrderData(game_, game_.GetLoadOrder(), mapper);
   }
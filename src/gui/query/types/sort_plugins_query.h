@@ -26,7 +26,9 @@ along with LOOT.  If not, see
 #ifndef LOOT_GUI_QUERY_SORT_PLUGINS_QUERY
 #define LOOT_GUI_QUERY_SORT_PLUGINS_QUERY
 
+#include <algorithm>
 #include <boost/locale.hpp>
+#include <unordered_map>
 
 #include "gui/query/query.h"
 #include "gui/state/game/game.h"
@@ -38,10 +40,12 @@ public:
   SortPluginsQuery(gui::Game& game,
                    UnappliedChangeCounter& counter,
                    std::string language,
+                   std::vector<PluginItemInputs> previousItems,
                    std::function<void(std::string)> sendProgressUpdate) :
       game_(game),
       language_(language),
       counter_(counter),
+      previousItems_(std::move(previousItems)),
       sendProgressUpdate_(sendProgressUpdate) {}
 
   QueryResult executeLogic() override {
@@ -68,13 +72,77 @@ public:
   }
 
 private:
-  std::vector<PluginItem> getResult(const std::vector<std::string>& plugins) {
-    return GetPluginItems(plugins, game_, language_);
+  SortPluginsResult getResult(const std::vector<std::string>& plugins) {
+    std::vector<PluginItemInputs> currentInputs;
+    std::unordered_map<std::string, size_t> currentIndexByName;
+    currentInputs.reserve(plugins.size());
+    currentIndexByName.reserve(plugins.size());
+    for (const auto& pluginName : plugins) {
+      const auto plugin = game_.GetPlugin(pluginName);
+      if (plugin) {
+        currentIndexByName.emplace(plugin->GetName(), currentInputs.size());
+        currentInputs.emplace_back(*plugin, game_.IsPluginActive(pluginName));
+      }
+    }
+
+    // Metadata conditions and install validity checks can depend on other
+    // plugins, so items can only be reused if no plugin has changed.
+    const auto canReuseItems =
+        CanReusePluginItems(previousItems_, currentInputs);
+
+    std::unordered_map<std::string, size_t> previousIndexByName;
+    if (canReuseItems) {
+      previousIndexByName.reserve(previousItems_.size());
+      for (size_t i = 0; i < previousItems_.size(); i += 1) {
+        previousIndexByName.emplace(previousItems_.at(i).name, i);
+      }
+    }
+
+    const auto mapper = [&](const PluginInterface* const plugin,
+                            std::optional<short> loadOrderIndex,
+                            bool isActive) {
+      SortedPluginItem sortedItem;
+      sortedItem.name = plugin->GetName();
+      sortedItem.loadOrderIndex = loadOrderIndex;
+      sortedItem.crc = plugin->GetCRC();
+
+      const auto& inputs =
+          currentInputs.at(currentIndexByName.at(sortedItem.name));
+
+      const auto it = previousIndexByName.find(sortedItem.name);
+      if (it != previousIndexByName.end() &&
+          CanReusePluginItem(previousItems_.at(it->second), inputs)) {
+        sortedItem.previousIndex = it->second;
+      } else {
+        sortedItem.item = PluginItem(
+            *plugin, game_, loadOrderIndex, isActive, language_);
+      }
+
+      return sortedItem;
+    };
+
+    auto result = MapFromLoadOrderData(game_, plugins, mapper);
+
+    const auto logger = getLogger();
+    if (logger) {
+      const auto rebuiltCount =
+          std::count_if(result.begin(),
+                        result.end(),
+                        [](const SortedPluginItem& sortedItem) {
+                          return sortedItem.item.has_value();
+                        });
+      logger->debug("Rebuilt {} of {} plugin items after sorting",
+                    rebuiltCount,
+                    result.size());
+    }
+
+    return result;
   }
 
   gui::Game& game_;
   std::string language_;
   UnappliedChangeCounter& counter_;
+  const std::vector<PluginItemInputs> previousItems_;
   const std::function<void(std::string)> sendProgressUpdate_;
 };
 }
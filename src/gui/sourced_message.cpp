@@ -29,6 +29,7 @@
 
 #include <boost/locale.hpp>
 
+#include "gui/message_strings.h"
 #include "gui/state/game/helpers.h"
 
 namespace loot {
@@ -95,53 +96,54 @@ SourcedMessage ToSourcedMessage(const PluginCleaningData& cleaningData,
                  .str(),
              cleaningData.GetDeletedNavmeshCount());
 
+  const auto& strings = GetMessageStrings();
   std::string message;
   if (cleaningData.GetITMCount() > 0 &&
       cleaningData.GetDeletedReferenceCount() > 0 &&
       cleaningData.GetDeletedNavmeshCount() > 0) {
-    message = format(translate("{0} found {1}, {2} and {3}.").str(),
-                     cleaningData.GetCleaningUtility(),
-                     itmRecords,
-                     deletedReferences,
-                     deletedNavmeshes);
+    message = strings.cleaningFoundThree.format(
+        cleaningData.GetCleaningUtility(),
+        itmRecords,
+        deletedReferences,
+        deletedNavmeshes);
   } else if (cleaningData.GetITMCount() == 0 &&
              cleaningData.GetDeletedReferenceCount() == 0 &&
              cleaningData.GetDeletedNavmeshCount() == 0) {
-    message = format(translate("{0} found dirty edits.").str(),
-                     cleaningData.GetCleaningUtility());
+    message = strings.cleaningFoundDirtyEdits.format(
+        cleaningData.GetCleaningUtility());
   } else if (cleaningData.GetITMCount() == 0 &&
              cleaningData.GetDeletedReferenceCount() > 0 &&
              cleaningData.GetDeletedNavmeshCount() > 0) {
-    message = format(translate("{0} found {1} and {2}.").str(),
-                     cleaningData.GetCleaningUtility(),
-                     deletedReferences,
-                     deletedNavmeshes);
+    message = strings.cleaningFoundTwo.format(
+        cleaningData.GetCleaningUtility(),
+        deletedReferences,
+        deletedNavmeshes);
   } else if (cleaningData.GetITMCount() > 0 &&
              cleaningData.GetDeletedReferenceCount() == 0 &&
              cleaningData.GetDeletedNavmeshCount() > 0) {
-    message = format(translate("{0} found {1} and {2}.").str(),
-                     cleaningData.GetCleaningUtility(),
-                     itmRecords,
-                     deletedNavmeshes);
+    message = strings.cleaningFoundTwo.format(
+        cleaningData.GetCleaningUtility(),
+        itmRecords,
+        deletedNavmeshes);
   } else if (cleaningData.GetITMCount() > 0 &&
              cleaningData.GetDeletedReferenceCount() > 0 &&
              cleaningData.GetDeletedNavmeshCount() == 0) {
-    message = format(translate("{0} found {1} and {2}.").str(),
-                     cleaningData.GetCleaningUtility(),
-                     itmRecords,
-                     deletedReferences);
+    message = strings.cleaningFoundTwo.format(
+        cleaningData.GetCleaningUtility(),
+        itmRecords,
+        deletedReferences);
   } else if (cleaningData.GetITMCount() > 0)
-    message = format(translate("{0} found {1}.").str(),
-                     cleaningData.GetCleaningUtility(),
-                     itmRecords);
+    message = strings.cleaningFoundOne.format(
+        cleaningData.GetCleaningUtility(),
+        itmRecords);
   else if (cleaningData.GetDeletedReferenceCount() > 0)
-    message = format(translate("{0} found {1}.").str(),
-                     cleaningData.GetCleaningUtility(),
-                     deletedReferences);
+    message = strings.cleaningFoundOne.format(
+        cleaningData.GetCleaningUtility(),
+        deletedReferences);
   else if (cleaningData.GetDeletedNavmeshCount() > 0)
-    message = format(translate("{0} found {1}.").str(),
-                     cleaningData.GetCleaningUtility(),
-                     deletedNavmeshes);
+    message = strings.cleaningFoundOne.format(
+        cleaningData.GetCleaningUtility(),
+        deletedNavmeshes);
 
   const auto selectedDetail =
       SelectMessageContent(cleaningData.GetDetail(), language);
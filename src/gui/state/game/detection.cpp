@@ -35,7 +35,7 @@ using std::filesystem::u8path;
 namespace loot {
 bool IsInstalled(const GameSettings& settings) {
   const auto logger = getLogger();
-  if (logger) {
+  if (isTraceLoggingEnabled(logger)) {
     logger->trace("Checking if game \"{}\" is installed.", settings.Name());
   }
 
@@ -150,7 +150,7 @@ std::vector<GameInstall> FindGameInstalls(
     const std::vector<std::filesystem::path>& xboxGamingRootPaths,
     const std::vector<std::string>& preferredUILanguages) {
   const auto logger = getLogger();
-  if (logger) {
+  if (isTraceLoggingEnabled(logger)) {
     logger->trace("Checking if game \"{}\" is installed.", GetGameName(gameId));
   }
 
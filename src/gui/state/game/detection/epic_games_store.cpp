@@ -161,7 +161,7 @@ std::optional<std::filesystem::path> GetEgsManifestsPath(
 EgsManifestData GetEgsManifestData(const std::filesystem::path& manifestPath) {
   const auto logger = getLogger();
 
-  if (logger) {
+  if (isTraceLoggingEnabled(logger)) {
     logger->trace("Reading EGS manifest file at {}.", manifestPath.u8string());
   }
 
@@ -222,7 +222,7 @@ std::optional<std::filesystem::path> GetEgsGameInstallPath(
 
   const auto logger = getLogger();
 
-  if (logger) {
+  if (isTraceLoggingEnabled(logger)) {
     logger->trace(
         "Checking if game \"{}\" is installed through the Epic Games "
         "Store.",
@@ -236,7 +236,7 @@ std::optional<std::filesystem::path> GetEgsGameInstallPath(
       const auto manifestData = GetEgsManifestData(entry.path());
 
       if (manifestData.appName == expectedAppName) {
-        if (logger) {
+        if (isTraceLoggingEnabled(logger)) {
           logger->trace(
               "Extracted install location {} from manifest file at {}.",
               manifestData.installLocation,
@@ -143,7 +143,7 @@ std::optional<HeroicGame> GetGameMetdata(
 
   const auto it = gameIdMap.find(appName);
   if (it == gameIdMap.end()) {
-    if (logger) {
+    if (isTraceLoggingEnabled(logger)) {
       logger->trace("Skipping app name {} as it is not a supported game",
                     appName);
     }
@@ -225,7 +225,7 @@ std::vector<HeroicGame> GetInstalledGogGames(
   const auto installedGamesPath =
       heroicConfigPath / "gog_store" / "installed.json";
 
-  if (logger) {
+  if (isTraceLoggingEnabled(logger)) {
     logger->trace("Reading Heroic installed GOG games file at {}.",
                   installedGamesPath.u8string());
   }
@@ -252,7 +252,7 @@ std::vector<HeroicGame> GetInstalledEgsGames(
   const auto installedGamesPath =
       heroicConfigPath / "legendaryConfig" / "legendary" / "installed.json";
 
-  if (logger) {
+  if (isTraceLoggingEnabled(logger)) {
     logger->trace("Reading Heroic installed EGS games file at {}.",
                   installedGamesPath.u8string());
   }
@@ -281,7 +281,7 @@ std::filesystem::path GetGameLocalPath(
   const auto gameConfigPath =
       heroicConfigPath / "GamesConfig" / (appName + ".json");
 
-  if (logger) {
+  if (isTraceLoggingEnabled(logger)) {
     logger->trace("Reading Heroic game config file at {}.",
                   gameConfigPath.u8string());
   }
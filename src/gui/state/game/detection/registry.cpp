@@ -58,7 +58,7 @@ std::optional<std::string> Registry::GetStringValue(
   std::wstring wstr(MAX_PATH, 0);
 
   auto logger = getLogger();
-  if (logger) {
+  if (isTraceLoggingEnabled(logger)) {
     logger->trace(
         "Getting string for registry key, subkey and value: {}, {}, "
         "{}",
@@ -113,7 +113,7 @@ std::vector<std::string> Registry::GetSubKeys(const std::string& rootKey,
                                               const std::string& subKey) const {
 #ifdef _WIN32
   const auto logger = getLogger();
-  if (logger) {
+  if (isTraceLoggingEnabled(logger)) {
     logger->trace("Getting subkey names for registry key and subkey: {}, {}",
                   rootKey,
                   subKey);
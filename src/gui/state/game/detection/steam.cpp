@@ -319,7 +319,7 @@ std::vector<std::filesystem::path> GetSteamLibraryPaths(
 
   try {
     const auto vdfPath = steamInstallPath / "config" / "libraryfolders.vdf";
-    if (logger) {
+    if (isTraceLoggingEnabled(logger)) {
       logger->trace("Reading libraryfolders.vdf file at {}",
                     vdfPath.u8string());
     }
@@ -27,7 +27,6 @@
 
 #include <algorithm>
 #include <cmath>
-#include <execution>
 #include <fstream>
 #include <unordered_set>
 
@@ -44,6 +43,9 @@
 #include <shlobj.h>
 #include <shlwapi.h>
 #include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
 #endif
 
 #include <spdlog/fmt/bundled/ranges.h>
@@ -53,6 +55,7 @@
 #include <boost/locale.hpp>
 
 #include "gui/helpers.h"
+#include "gui/message_strings.h"
 #include "gui/state/game/detection/common.h"
 #include "gui/state/game/detection/detail.h"
 #include "gui/state/game/detection/generic.h"
@@ -81,6 +84,38 @@ std::filesystem::path GetLOOTGamePath(const std::filesystem::path& lootDataPath,
   return lootDataPath / "games" / std::filesystem::u8path(folderName);
 }
 
+// Flushes the file's data from the OS's buffers to the disk, so that it is
+// complete before it's used to replace another file.
+void FlushFileToDisk(const std::filesystem::path& path) {
+#ifdef _WIN32
+  const auto handle = CreateFile(path.wstring().c_str(),
+                                 GENERIC_WRITE,
+                                 FILE_SHARE_READ,
+                                 nullptr,
+                                 OPEN_EXISTING,
+                                 FILE_ATTRIBUTE_NORMAL,
+                                 nullptr);
+  if (handle == INVALID_HANDLE_VALUE) {
+    throw std::runtime_error(path.u8string() + " could not be opened");
+  }
+
+  const auto isFlushed = FlushFileBuffers(handle) != 0;
+  const auto isClosed = CloseHandle(handle) != 0;
+#else
+  const auto fileDescriptor = open(path.c_str(), O_WRONLY);
+  if (fileDescriptor == -1) {
+    throw std::runtime_error(path.u8string() + " could not be opened");
+  }
+
+  const auto isFlushed = fsync(fileDescriptor) == 0;
+  const auto isClosed = close(fileDescriptor) == 0;
+#endif
+
+  if (!isFlushed || !isClosed) {
+    throw std::runtime_error(path.u8string() + " could not be flushed");
+  }
+}
+
 bool IsPathCaseSensitive(const std::filesystem::path& path) {
   const auto lowercased =
       path.parent_path() / std::filesystem::u8path(boost::locale::to_lower(
@@ -304,6 +339,9 @@ Game::Game(Game&& game) {
   loadOrderSortCount_ = std::move(game.loadOrderSortCount_);
   pluginsFullyLoaded_ = std::move(game.pluginsFullyLoaded_);
   isMicrosoftStoreInstall_ = std::move(game.isMicrosoftStoreInstall_);
+  installedPluginPaths_ = std::move(game.installedPluginPaths_);
+  pluginCandidateFingerprints_ = std::move(game.pluginCandidateFingerprints_);
+  metadataFileFingerprints_ = std::move(game.metadataFileFingerprints_);
 }
 
 Game& Game::operator=(Game&& game) {
@@ -316,6 +354,10 @@ Game& Game::operator=(Game&& game) {
     loadOrderSortCount_ = std::move(game.loadOrderSortCount_);
     pluginsFullyLoaded_ = std::move(game.pluginsFullyLoaded_);
     isMicrosoftStoreInstall_ = std::move(game.isMicrosoftStoreInstall_);
+    installedPluginPaths_ = std::move(game.installedPluginPaths_);
+    pluginCandidateFingerprints_ =
+        std::move(game.pluginCandidateFingerprints_);
+    metadataFileFingerprints_ = std::move(game.metadataFileFingerprints_);
   }
 
   return *this;
@@ -336,6 +378,9 @@ void Game::Init() {
   messages_.clear();
   loadOrderSortCount_ = 0;
   pluginsFullyLoaded_ = false;
+  installedPluginPaths_.clear();
+  pluginCandidateFingerprints_.clear();
+  metadataFileFingerprints_ = std::nullopt;
 
   gameHandle_ = CreateGameHandle(
       settings_.Type(), settings_.GamePath(), settings_.GameLocalPath());
@@ -346,6 +391,60 @@ void Game::Init() {
 
 bool Game::IsInitialised() const { return gameHandle_ != nullptr; }
 
+void Game::Unload() {
+  auto logger = getLogger();
+  if (logger) {
+    logger->info("Unloading data for game: {}", settings_.Name());
+  }
+
+  messages_.clear();
+  loadOrderSortCount_ = 0;
+  pluginsFullyLoaded_ = false;
+  installedPluginPaths_.clear();
+  pluginCandidateFingerprints_.clear();
+  metadataFileFingerprints_ = std::nullopt;
+  creationClubPlugins_.clear();
+  gameHandle_.reset();
+}
+
+size_t Game::EstimateMemoryUsage() const {
+  // These figures are only intended to be good enough to compare games
+  // against one another and against a memory budget. Loading a plugin's
+  // header takes a small roughly constant amount of memory, while fully
+  // loading a plugin stores its records' FormIDs, so scales with file size.
+  // Parsed metadata takes up several times the size of its YAML source.
+  static constexpr size_t PLUGIN_HEADER_SIZE_ESTIMATE = 16 * 1024;
+  static constexpr size_t FULLY_LOADED_PLUGIN_SIZE_DIVISOR = 8;
+  static constexpr size_t METADATA_SIZE_MULTIPLIER = 8;
+
+  if (!IsInitialised()) {
+    return 0;
+  }
+
+  size_t estimate = 0;
+  for (const auto& pluginPath : installedPluginPaths_) {
+    estimate += PLUGIN_HEADER_SIZE_ESTIMATE;
+
+    if (pluginsFullyLoaded_) {
+      const auto it = pluginCandidateFingerprints_.find(pluginPath);
+      if (it != pluginCandidateFingerprints_.end() && it->second.has_value()) {
+        estimate += it->second->size / FULLY_LOADED_PLUGIN_SIZE_DIVISOR;
+      }
+    }
+  }
+
+  lock_guard<mutex> guard(userMetadataMutex_);
+  if (metadataFileFingerprints_.has_value()) {
+    for (const auto& [path, fingerprint] : metadataFileFingerprints_.value()) {
+      if (fingerprint.has_value()) {
+        estimate += fingerprint->size * METADATA_SIZE_MULTIPLIER;
+      }
+    }
+  }
+
+  return estimate;
+}
+
 const PluginInterface* Game::GetPlugin(const std::string& name) const {
   return gameHandle_->GetPlugin(name);
 }
@@ -360,11 +459,12 @@ std::vector<SourcedMessage> Game::CheckInstallValidity(
     const std::string& language) const {
   auto logger = getLogger();
 
-  if (logger) {
+  if (isTraceLoggingEnabled(logger)) {
     logger->trace(
         "Checking that the current install is valid according to {}'s data.",
         plugin.GetName());
   }
+  const auto& strings = GetMessageStrings();
   std::vector<SourcedMessage> messages;
   if (IsPluginActive(plugin.GetName())) {
     auto tags = metadata.GetTags();
@@ -384,11 +484,7 @@ std::vector<SourcedMessage> Game::CheckInstallValidity(
           messages.push_back(CreatePlainTextSourcedMessage(
               MessageType::error,
               MessageSource::missingMaster,
-              fmt::format(
-                  boost::locale::translate("This plugin requires \"{0}\" to be "
-                                           "installed, but it is missing.")
-                      .str(),
-                  master)));
+              strings.missingMaster.format(master)));
         } else if (!IsPluginActive(master)) {
           if (logger) {
             logger->error("\"{}\" requires \"{}\", but it is inactive.",
@@ -398,11 +494,7 @@ std::vector<SourcedMessage> Game::CheckInstallValidity(
           messages.push_back(CreatePlainTextSourcedMessage(
               MessageType::error,
               MessageSource::inactiveMaster,
-              fmt::format(
-                  boost::locale::translate("This plugin requires \"{0}\" to be "
-                                           "active, but it is inactive.")
-                      .str(),
-                  master)));
+              strings.inactiveMaster.format(master)));
         }
       }
     }
@@ -428,11 +520,7 @@ std::vector<SourcedMessage> Game::CheckInstallValidity(
           continue;
         }
 
-        auto localisedText = fmt::format(
-            boost::locale::translate("This plugin requires \"{0}\" to be "
-                                     "installed, but it is missing.")
-                .str(),
-            displayName);
+        auto localisedText = strings.missingMaster.format(displayName);
         auto detailContent = SelectMessageContent(req.GetDetail(), language);
         auto messageText =
             detailContent.has_value()
@@ -469,12 +557,7 @@ std::vector<SourcedMessage> Game::CheckInstallValidity(
           continue;
         }
 
-        auto localisedText = fmt::format(
-            boost::locale::translate(
-                "This plugin is incompatible with \"{0}\", but both "
-                "are present.")
-                .str(),
-            displayName);
+        auto localisedText = strings.incompatibility.format(displayName);
         auto detailContent = SelectMessageContent(inc.GetDetail(), language);
         auto messageText =
             detailContent.has_value()
@@ -516,14 +599,7 @@ std::vector<SourcedMessage> Game::CheckInstallValidity(
         messages.push_back(CreatePlainTextSourcedMessage(
             MessageType::error,
             MessageSource::lightPluginRequiresNonMaster,
-            fmt::format(
-                boost::locale::translate(
-                    "This plugin is a light master and requires the non-master "
-                    "plugin \"{0}\". This can cause issues in-game, and "
-                    "sorting "
-                    "will fail while this plugin is installed.")
-                    .str(),
-                masterName)));
+            strings.lightPluginRequiresNonMaster.format(masterName)));
       }
     }
   }
@@ -539,10 +615,7 @@ std::vector<SourcedMessage> Game::CheckInstallValidity(
     messages.push_back(CreatePlainTextSourcedMessage(
         MessageType::error,
         MessageSource::invalidLightPlugin,
-        boost::locale::translate(
-            "This plugin contains records that have FormIDs outside "
-            "the valid range for an ESL plugin. Using this plugin "
-            "will cause irreversible damage to your game saves.")));
+        strings.invalidLightPlugin));
   }
 
   if (plugin.IsOverridePlugin() && !plugin.IsValidAsOverridePlugin()) {
@@ -555,9 +628,7 @@ std::vector<SourcedMessage> Game::CheckInstallValidity(
     messages.push_back(CreatePlainTextSourcedMessage(
         MessageType::error,
         MessageSource::invalidOverridePlugin,
-        boost::locale::translate(
-            "This plugin is an overlay plugin but adds new records. Using "
-            "this plugin may cause irreversible damage to your game saves.")));
+        strings.invalidOverridePlugin));
   }
 
   if (plugin.GetHeaderVersion().has_value() &&
@@ -573,13 +644,7 @@ std::vector<SourcedMessage> Game::CheckInstallValidity(
     messages.push_back(CreatePlainTextSourcedMessage(
         MessageType::warn,
         MessageSource::invalidHeaderVersion,
-        fmt::format(
-            boost::locale::translate(
-                /* translators: A header is the part of a file that stores data
-                   like file name and version. */
-                "This plugin has a header version of {0}, which is less than "
-                "the game's minimum supported header version of {1}.")
-                .str(),
+        strings.invalidHeaderVersion.format(
             plugin.GetHeaderVersion().value(),
             settings_.MinimumHeaderVersion())));
   }
@@ -596,11 +661,7 @@ std::vector<SourcedMessage> Game::CheckInstallValidity(
       messages.push_back(CreatePlainTextSourcedMessage(
           MessageType::error,
           MessageSource::missingGroup,
-          fmt::format(
-              boost::locale::translate("This plugin belongs to the group "
-                                       "\"{0}\", which does not exist.")
-                  .str(),
-              groupName)));
+          strings.missingGroup.format(groupName)));
     }
   }
 
@@ -621,12 +682,7 @@ std::vector<SourcedMessage> Game::CheckInstallValidity(
       messages.push_back(CreatePlainTextSourcedMessage(
           MessageType::say,
           MessageSource::bashTagsOverride,
-          fmt::format(
-              boost::locale::translate(
-                  "This plugin has a BashTags file that will override the "
-                  "suggestions made by LOOT for the following Bash Tags: {0}.")
-                  .str(),
-              commaSeparatedTags)));
+          strings.bashTagsOverride.format(commaSeparatedTags)));
     }
   }
 
@@ -668,7 +724,7 @@ void Game::RedatePlugins() {
       if (thisTime >= lastTime) {
         lastTime = thisTime;
 
-        if (logger) {
+        if (isTraceLoggingEnabled(logger)) {
           logger->trace("No need to redate \"{}\".",
                         filepath.filename().u8string());
         }
@@ -734,34 +790,38 @@ void Game::LoadCreationClubPluginNames() {
 }
 
 void Game::LoadAllInstalledPlugins(bool headersOnly) {
-  try {
-    gameHandle_->LoadCurrentLoadOrderState();
-  } catch (const std::exception& e) {
-    auto logger = getLogger();
-    if (logger) {
-      logger->error("Failed to load current load order. Details: {}", e.what());
-    }
-    AppendMessage(CreatePlainTextSourcedMessage(
-        MessageType::error,
-        MessageSource::caughtException,
-        boost::locale::translate("Failed to load the current load order, "
-                                 "information displayed may be incorrect.")
-            .str()));
+  LoadCurrentLoadOrderState();
+
+  LoadInstalledPlugins(FindPluginCandidatePaths(), headersOnly);
+}
+
+bool Game::LoadChangedInstalledPlugins() {
+  LoadCurrentLoadOrderState();
+
+  const auto candidatePaths = FindPluginCandidatePaths();
+  if (GetFileFingerprints(candidatePaths) != pluginCandidateFingerprints_) {
+    LoadInstalledPlugins(candidatePaths, true);
+    return true;
   }
 
-  const auto installedPluginPaths = GetInstalledPluginPaths();
-  gameHandle_->LoadPlugins(installedPluginPaths, headersOnly);
+  auto logger = getLogger();
+  if (logger) {
+    logger->debug(
+        "No files in the data folders have changed since plugins were last "
+        "loaded, so the loaded plugins will be reused.");
+  }
 
-  // Check if any plugins have been removed.
+  // Check for invalid plugins again, as any message about them may have been
+  // cleared since they were last loaded.
   std::vector<std::string> loadedPluginNames;
   for (auto plugin : gameHandle_->GetLoadedPlugins()) {
     loadedPluginNames.push_back(plugin->GetName());
   }
 
   AppendMessages(
-      CheckForRemovedPlugins(installedPluginPaths, loadedPluginNames));
+      CheckForRemovedPlugins(installedPluginPaths_, loadedPluginNames));
 
-  pluginsFullyLoaded_ = !headersOnly;
+  return false;
 }
 
 bool Game::ArePluginsFullyLoaded() const { return pluginsFullyLoaded_; }
@@ -774,6 +834,14 @@ std::filesystem::path Game::GetActivePluginsFilePath() const {
   return gameHandle_->GetActivePluginsFilePath();
 }
 
+std::vector<std::filesystem::path> Game::GetLoadOrderFilePaths() const {
+  // Games that use loadorder.txt store it alongside plugins.txt.
+  const auto activePluginsFilePath = GetActivePluginsFilePath();
+
+  return {activePluginsFilePath,
+          activePluginsFilePath.parent_path() / "loadorder.txt"};
+}
+
 fs::path Game::UserlistPath() const {
   return GetLOOTGamePath() / "userlist.yaml";
 }
@@ -782,6 +850,14 @@ fs::path Game::GroupNodePositionsPath() const {
   return GetLOOTGamePath() / "group_node_positions.bin";
 }
 
+fs::path Game::GroupLayoutCachePath() const {
+  return GetLOOTGamePath() / "group_layout_cache.bin";
+}
+
+fs::path Game::SessionSnapshotPath() const {
+  return GetLOOTGamePath() / "session_snapshot.bin";
+}
+
 std::vector<std::string> Game::GetLoadOrder() const {
   return gameHandle_->GetLoadOrder();
 }
@@ -830,19 +906,7 @@ bool Game::IsLoadOrderAmbiguous() const {
 std::vector<std::string> Game::SortPlugins() {
   auto logger = getLogger();
 
-  try {
-    gameHandle_->LoadCurrentLoadOrderState();
-  } catch (const std::exception& e) {
-    if (logger) {
-      logger->error("Failed to load current load order. Details: {}", e.what());
-    }
-    AppendMessage(CreatePlainTextSourcedMessage(
-        MessageType::error,
-        MessageSource::caughtException,
-        boost::locale::translate("Failed to load the current load order, "
-                                 "information displayed may be incorrect.")
-            .str()));
-  }
+  LoadCurrentLoadOrderState();
 
   std::vector<std::string> sortedPlugins;
   try {
@@ -912,6 +976,7 @@ std::vector<SourcedMessage> Game::GetMessages(
                         language));
   output.insert(end(output), begin(messages_), end(messages_));
 
+  const auto& strings = GetMessageStrings();
   const auto addWarning = [&output](const MessageSource source,
                                     const std::string& text) {
     output.push_back(
@@ -920,8 +985,7 @@ std::vector<SourcedMessage> Game::GetMessages(
 
   if (loadOrderSortCount_ == 0) {
     addWarning(MessageSource::unsortedLoadOrderCheck,
-               boost::locale::translate(
-                   "You have not sorted your load order this session."));
+               strings.unsortedLoadOrder);
   }
 
   size_t activeNormalPluginsCount = 0;
@@ -968,20 +1032,12 @@ std::vector<SourcedMessage> Game::GetMessages(
 
     if (activeLightPluginsCount > 0) {
       addWarning(MessageSource::activePluginsCountCheck,
-                 fmt::format(boost::locale::translate(
-                                 "You have {0} active normal plugins but the "
-                                 "game only supports up to {1}.")
-                                 .str(),
-                             activeNormalPluginsCount,
-                             safeMaxActiveNormalPlugins));
+                 strings.tooManyActiveNormalPlugins.format(
+                     activeNormalPluginsCount, safeMaxActiveNormalPlugins));
     } else {
       addWarning(MessageSource::activePluginsCountCheck,
-                 fmt::format(boost::locale::translate(
-                                 "You have {0} active plugins but the "
-                                 "game only supports up to {1}.")
-                                 .str(),
-                             activeNormalPluginsCount,
-                             safeMaxActiveNormalPlugins));
+                 strings.tooManyActivePlugins.format(
+                     activeNormalPluginsCount, safeMaxActiveNormalPlugins));
     }
   }
 
@@ -997,10 +1053,7 @@ std::vector<SourcedMessage> Game::GetMessages(
           SAFE_MAX_ACTIVE_NORMAL_PLUGINS);
     }
 
-    addWarning(MessageSource::activePluginsCountCheck,
-               boost::locale::translate(
-                   "Do not launch Morrowind without the use of MWSE or it will "
-                   "cause severe damage to your game."));
+    addWarning(MessageSource::activePluginsCountCheck, strings.mwseRequired);
   }
 
   if (activeLightPluginsCount > SAFE_MAX_ACTIVE_LIGHT_PLUGINS) {
@@ -1012,12 +1065,8 @@ std::vector<SourcedMessage> Game::GetMessages(
     }
 
     addWarning(MessageSource::activePluginsCountCheck,
-               fmt::format(boost::locale::translate(
-                               "You have {0} active light plugins but the "
-                               "game only supports up to {1}.")
-                               .str(),
-                           activeLightPluginsCount,
-                           SAFE_MAX_ACTIVE_LIGHT_PLUGINS));
+               strings.tooManyActiveLightPlugins.format(
+                   activeLightPluginsCount, SAFE_MAX_ACTIVE_LIGHT_PLUGINS));
   }
 
   if (activeNormalPluginsCount >= SAFE_MAX_ACTIVE_NORMAL_PLUGINS &&
@@ -1029,27 +1078,13 @@ std::vector<SourcedMessage> Game::GetMessages(
           activeNormalPluginsCount);
     }
 
-    addWarning(
-        MessageSource::activePluginsCountCheck,
-        boost::locale::translate(
-            "You have a normal plugin and at least one light plugin sharing "
-            "the FE load order index. Deactivate a normal plugin or all your "
-            "light plugins to avoid potential issues."));
+    addWarning(MessageSource::activePluginsCountCheck, strings.sharedFEIndex);
   }
 
   if (IsPathCaseSensitive(GetSettings().DataPath())) {
     addWarning(
         MessageSource::caseSensitivePathCheck,
-        fmt::format(
-            boost::locale::translate(
-                /* translators: The placeholder is for the current game's name.
-                 */
-                "{0} is installed in a case-sensitive location. This may "
-                "cause issues as the game, mods and LOOT may assume that "
-                "filesystem paths are not case-sensitive, which is the default "
-                "on Windows.")
-                .str(),
-            GetSettings().Name()));
+        strings.caseSensitiveGamePath.format(GetSettings().Name()));
   }
 
   const auto gameLocalPath = GetSettings().GameLocalPath();
@@ -1071,16 +1106,7 @@ std::vector<SourcedMessage> Game::GetMessages(
     if (IsPathCaseSensitive(gameLocalPath)) {
       addWarning(
           MessageSource::caseSensitivePathCheck,
-          fmt::format(
-              boost::locale::translate(
-                  /* translators: The placeholder is for the current game's
-                     name. */
-                  "{0}'s local application data is stored in a case-sensitive "
-                  "location. This may cause issues as the game, mods and LOOT "
-                  "may assume that filesystem paths are not case-sensitive, "
-                  "which is the default on Windows.")
-                  .str(),
-              GetSettings().Name()));
+          strings.caseSensitiveGameLocalPath.format(GetSettings().Name()));
     }
   } else if (logger) {
     // This is probably fine because the path shouldn't be empty on Linux and on
@@ -1131,10 +1157,23 @@ void Game::LoadMetadata() {
   if (logger) {
     logger->debug("Parsing metadata list(s).");
   }
+
+  // Get the fingerprints before loading so that any changes made during
+  // loading will be picked up the next time staleness is checked.
+  auto fingerprints = GetFileFingerprints(GetMetadataFilePaths());
+
+  lock_guard<mutex> guard(userMetadataMutex_);
   try {
     gameHandle_->GetDatabase().LoadLists(
         masterlistPath, userlistPath, masterlistPreludePath);
+
+    metadataFileFingerprints_ = std::move(fingerprints);
   } catch (const std::exception& e) {
+    // Leave the metadata marked as stale so that the lists are loaded again,
+    // and the error is recorded again, the next time the game's data is
+    // loaded.
+    metadataFileFingerprints_ = std::nullopt;
+
     if (logger) {
       logger->error("An error occurred while parsing the metadata list(s): {}",
                     e.what());
@@ -1163,6 +1202,13 @@ void Game::LoadMetadata() {
   }
 }
 
+bool Game::IsMetadataStale() const {
+  lock_guard<mutex> guard(userMetadataMutex_);
+  return !metadataFileFingerprints_.has_value() ||
+         GetFileFingerprints(GetMetadataFilePaths()) !=
+             metadataFileFingerprints_.value();
+}
+
 std::vector<std::string> Game::GetKnownBashTags() const {
   return gameHandle_->GetDatabase().GetKnownBashTags();
 }
@@ -1210,101 +1256,155 @@ std::optional<PluginMetadata> Game::GetUserMetadata(
 }
 
 void Game::SetUserGroups(const std::vector<Group>& groups) {
+  lock_guard<mutex> guard(userMetadataMutex_);
   return gameHandle_->GetDatabase().SetUserGroups(groups);
 }
 
 void Game::AddUserMetadata(const PluginMetadata& metadata) {
+  lock_guard<mutex> guard(userMetadataMutex_);
   gameHandle_->GetDatabase().SetPluginUserMetadata(metadata);
 }
 
 void Game::ClearUserMetadata(const std::string& pluginName) {
+  lock_guard<mutex> guard(userMetadataMutex_);
   gameHandle_->GetDatabase().DiscardPluginUserMetadata(pluginName);
 }
 
 void Game::ClearAllUserMetadata() {
+  lock_guard<mutex> guard(userMetadataMutex_);
   gameHandle_->GetDatabase().DiscardAllUserMetadata();
 }
 
 void Game::SaveUserMetadata() {
-  gameHandle_->GetDatabase().WriteUserMetadata(UserlistPath(), true);
+  lock_guard<mutex> guard(userMetadataMutex_);
+
+  // Write to a temporary file in the same folder and then replace the
+  // userlist with it, so that the userlist is never left partially written.
+  const auto userlistPath = UserlistPath();
+  auto tempPath = userlistPath;
+  tempPath += ".tmp";
+
+  // libloot has closed the file once it returns, but the data may not have
+  // reached the disk yet.
+  try {
+    gameHandle_->GetDatabase().WriteUserMetadata(tempPath, true);
+    FlushFileToDisk(tempPath);
+  } catch (...) {
+    std::error_code errorCode;
+    fs::remove(tempPath, errorCode);
+    throw;
+  }
+
+  fs::rename(tempPath, userlistPath);
+
+  // The userlist now matches the loaded user metadata, so it's not stale.
+  if (metadataFileFingerprints_.has_value()) {
+    const auto fingerprints = GetFileFingerprints({userlistPath});
+    metadataFileFingerprints_.value()[userlistPath] =
+        fingerprints.at(userlistPath);
+  }
 }
 
 std::filesystem::path Game::GetLOOTGamePath() const {
   return ::GetLOOTGamePath(lootDataPath_, settings_.FolderName());
 }
 
-std::vector<std::filesystem::path> Game::GetInstalledPluginPaths() const {
+std::vector<std::filesystem::path> Game::FindPluginCandidatePaths() const {
+  // Scan external data paths first, as the game checks them before the main
+  // data path.
+  auto dataPaths = GetExternalDataPaths(settings_.Id(),
+                                        isMicrosoftStoreInstall_,
+                                        settings_.DataPath(),
+                                        settings_.GameLocalPath());
+  dataPaths.push_back(settings_.DataPath());
+
+  return ScanForPluginCandidatePaths(dataPaths);
+}
+
+std::vector<std::filesystem::path> Game::FilterValidPluginPaths(
+    std::vector<std::filesystem::path> maybePlugins) const {
   const auto logger = getLogger();
 
   // Checking to see if a plugin is valid is relatively slow, almost entirely
-  // due to blocking on opening the file, so instead just add all the files
-  // found to a buffer and then check if they're valid plugins in parallel.
-  std::vector<std::filesystem::path> maybePlugins;
-  std::set<Filename> foundPlugins;
-
-  // Scan external data paths first, as the game checks them before the main
-  // data path.
-  for (const auto& dataPath : GetExternalDataPaths(settings_.Id(),
-                                                   isMicrosoftStoreInstall_,
-                                                   settings_.DataPath(),
-                                                   settings_.GameLocalPath())) {
-    if (!std::filesystem::exists(dataPath)) {
-      continue;
-    }
+  // due to blocking on opening the file, so check the candidates in parallel,
+  // but not so many at once that a hard disk drive thrashes.
+  auto& pool = GetThreadPool();
+  const auto isOnRotationalDrive = IsOnRotationalDrive(settings_.DataPath());
+  const auto concurrency =
+      GetPluginValidationConcurrency(isOnRotationalDrive, pool.size() + 1);
 
-    if (logger) {
-      logger->trace("Scanning for plugins in {}", dataPath.u8string());
-    }
+  if (logger) {
+    logger->debug("Validating {} plugin candidates, {} at a time.",
+                  maybePlugins.size(),
+                  concurrency);
+  }
 
-    for (fs::directory_iterator it(dataPath); it != fs::directory_iterator();
-         ++it) {
-      if (fs::is_regular_file(it->status())) {
-        const auto filename = Filename(it->path().filename().u8string());
-        if (foundPlugins.count(filename) == 0) {
-          maybePlugins.push_back(it->path());
-          foundPlugins.insert(filename);
+  const auto isValid = ParallelMap(
+      maybePlugins,
+      [&](const std::filesystem::path& path) {
+        try {
+          if (gameHandle_->IsValidPlugin(path)) {
+            if (logger) {
+              logger->debug("Found plugin: {}", path.u8string());
+            }
+            return true;
+          }
+        } catch (...) {
         }
-      }
+
+        return false;
+      },
+      pool,
+      concurrency);
+
+  std::vector<std::filesystem::path> plugins;
+  for (size_t i = 0; i < maybePlugins.size(); i += 1) {
+    if (isValid.at(i)) {
+      plugins.push_back(std::move(maybePlugins.at(i)));
     }
   }
 
-  // Scan main data path separately as only its filenames need to be stored,
-  // not the whole path, which simplifies the log/debugging.
-  if (logger) {
-    logger->trace("Scanning for plugins in {}",
-                  settings_.DataPath().u8string());
-  }
-
-  for (fs::directory_iterator it(settings_.DataPath());
-       it != fs::directory_iterator();
-       ++it) {
-    if (fs::is_regular_file(it->status())) {
-      const auto filename = Filename(it->path().filename().u8string());
-      if (foundPlugins.count(filename) == 0) {
-        maybePlugins.push_back(it->path());
-        foundPlugins.insert(filename);
-      }
+  return plugins;
+}
+
+std::vector<std::filesystem::path> Game::GetMetadataFilePaths() const {
+  return {preludePath_, MasterlistPath(), UserlistPath()};
+}
+
+void Game::LoadCurrentLoadOrderState() {
+  try {
+    gameHandle_->LoadCurrentLoadOrderState();
+  } catch (const std::exception& e) {
+    auto logger = getLogger();
+    if (logger) {
+      logger->error("Failed to load current load order. Details: {}", e.what());
     }
+    AppendMessage(CreatePlainTextSourcedMessage(
+        MessageType::error,
+        MessageSource::caughtException,
+        boost::locale::translate("Failed to load the current load order, "
+                                 "information displayed may be incorrect.")
+            .str()));
+  }
+}
+
+void Game::LoadInstalledPlugins(
+    const std::vector<std::filesystem::path>& candidatePaths,
+    bool headersOnly) {
+  installedPluginPaths_ = FilterValidPluginPaths(candidatePaths);
+  gameHandle_->LoadPlugins(installedPluginPaths_, headersOnly);
+
+  // Check if any plugins have been removed.
+  std::vector<std::string> loadedPluginNames;
+  for (auto plugin : gameHandle_->GetLoadedPlugins()) {
+    loadedPluginNames.push_back(plugin->GetName());
   }
 
-  const auto newEndIt =
-      std::remove_if(std::execution::par_unseq,
-                     maybePlugins.begin(),
-                     maybePlugins.end(),
-                     [&](const std::filesystem::path& path) {
-                       try {
-                         const auto isValid = gameHandle_->IsValidPlugin(path);
-                         if (isValid && logger) {
-                           logger->debug("Found plugin: {}", path.u8string());
-                         }
-                         return !isValid;
-                       } catch (...) {
-                         return true;
-                       }
-                     });
-  maybePlugins.erase(newEndIt, maybePlugins.end());
-
-  return maybePlugins;
+  AppendMessages(
+      CheckForRemovedPlugins(installedPluginPaths_, loadedPluginNames));
+
+  pluginsFullyLoaded_ = !headersOnly;
+  pluginCandidateFingerprints_ = GetFileFingerprints(candidatePaths);
 }
 
 void Game::AppendMessages(std::vector<SourcedMessage> messages) {
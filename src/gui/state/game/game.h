@@ -26,34 +26,16 @@
 #ifndef LOOT_GUI_STATE_GAME_GAME
 #define LOOT_GUI_STATE_GAME_GAME
 
-#ifndef _WIN32
-#ifdef emit
-// The TBB library is used on Linux to provide the implementation of the
-// standard library parallel execution algorithms, but oneTBB 2021.8.0 defines
-// an emit() function that clashes with Qt's emit macro, which may be defined
-// when this header is included. As such, undefine the macro before including
-// the standard library headers, and redefine it afterwards.
-#undef emit
-#define LOOT_SHOULD_REDEFINE_EMIT
-#endif
-#endif
-
-#include <execution>
 #include <filesystem>
-#include <functional>
 #include <mutex>
 #include <optional>
 #include <string>
-#include <variant>
-
-#ifdef LOOT_SHOULD_REDEFINE_EMIT
-// Assume emit was Qt's emit macro, which is empty.
-#define emit
-#undef LOOT_SHOULD_REDEFINE_EMIT
-#endif
+#include <type_traits>
 
+#include "gui/parallel.h"
 #include "gui/sourced_message.h"
 #include "gui/state/game/game_settings.h"
+#include "gui/state/game/helpers.h"
 #include "gui/state/logging.h"
 #include "loot/api.h"
 
@@ -83,6 +65,10 @@ public:
 
   void Init();
   bool IsInitialised() const;
+  // Discard all data that depends on the libloot game handle.
+  void Unload();
+  // A rough estimate of the memory used by the game's loaded data.
+  size_t EstimateMemoryUsage() const;
 
   const PluginInterface* GetPlugin(const std::string& name) const;
   std::vector<const PluginInterface*> GetPlugins() const;
@@ -98,13 +84,23 @@ public:
 
   void LoadAllInstalledPlugins(
       bool headersOnly);  // Loads all installed plugins.
+  // Reloads the installed plugins' headers only if any files in the data
+  // folders have been added, removed or modified since plugins were last
+  // loaded, otherwise only the current load order state is reloaded. Returns
+  // true if plugins were reloaded.
+  bool LoadChangedInstalledPlugins();
   bool ArePluginsFullyLoaded()
       const;  // Checks if the game's plugins have already been loaded.
 
   std::filesystem::path MasterlistPath() const;
   std::filesystem::path UserlistPath() const;
   std::filesystem::path GroupNodePositionsPath() const;
+  std::filesystem::path GroupLayoutCachePath() const;
+  std::filesystem::path SessionSnapshotPath() const;
   std::filesystem::path GetActivePluginsFilePath() const;
+  // The files that the load order may be read from, which don't all exist for
+  // every game.
+  std::vector<std::filesystem::path> GetLoadOrderFilePaths() const;
 
   std::vector<std::string> GetLoadOrder() const;
   void SetLoadOrder(const std::vector<std::string>& loadOrder);
@@ -125,6 +121,9 @@ public:
   void ClearMessages();
 
   void LoadMetadata();
+  // Returns true if the metadata lists have not been loaded successfully since
+  // they or the masterlist prelude were last modified.
+  bool IsMetadataStale() const;
   std::vector<std::string> GetKnownBashTags() const;
 
   std::vector<Group> GetMasterlistGroups() const;
@@ -143,11 +142,20 @@ public:
   void AddUserMetadata(const PluginMetadata& metadata);
   void ClearUserMetadata(const std::string& pluginName);
   void ClearAllUserMetadata();
+  // Replaces the userlist atomically. It is safe to call this from a
+  // background thread while another thread edits the user metadata.
   void SaveUserMetadata();
 
 private:
   std::filesystem::path GetLOOTGamePath() const;
-  std::vector<std::filesystem::path> GetInstalledPluginPaths() const;
+  std::vector<std::filesystem::path> FindPluginCandidatePaths() const;
+  std::vector<std::filesystem::path> FilterValidPluginPaths(
+      std::vector<std::filesystem::path> candidatePaths) const;
+  std::vector<std::filesystem::path> GetMetadataFilePaths() const;
+  void LoadCurrentLoadOrderState();
+  void LoadInstalledPlugins(
+      const std::vector<std::filesystem::path>& candidatePaths,
+      bool headersOnly);
   void AppendMessages(std::vector<SourcedMessage> messages);
   std::filesystem::path ResolveGameFilePath(
       const std::string& pluginName) const;
@@ -161,6 +169,12 @@ private:
   unsigned short loadOrderSortCount_{0};
   bool pluginsFullyLoaded_{false};
   bool isMicrosoftStoreInstall_{false};
+  std::vector<std::filesystem::path> installedPluginPaths_;
+  FileFingerprints pluginCandidateFingerprints_;
+  std::optional<FileFingerprints> metadataFileFingerprints_;
+  // Guards changes to the user metadata and the metadata file fingerprints
+  // against concurrent userlist saves. It is not moved with the game.
+  mutable std::mutex userMetadataMutex_;
 
   // Use Filename to benefit from libloot's case-insensitive comparisons.
   std::set<Filename> creationClubPlugins_;
@@ -173,12 +187,16 @@ std::string GetLoadOrderAsTextTable(const gui::Game& game,
 std::string GetMetadataAsBBCodeYaml(const gui::Game& game,
                                     const std::string& pluginName);
 
-template<typename T>
-std::vector<T> MapFromLoadOrderData(
-    const gui::Game& game,
-    const std::vector<std::string>& loadOrder,
-    const std::function<
-        T(const PluginInterface* const, std::optional<short>, bool)>& mapper) {
+// The mapper is a template parameter, like ParallelMap's, so that calling it
+// for each plugin doesn't go through a type-erased wrapper.
+template<typename Mapper>
+auto MapFromLoadOrderData(const gui::Game& game,
+                          const std::vector<std::string>& loadOrder,
+                          const Mapper& mapper)
+    -> std::vector<std::decay_t<std::invoke_result_t<const Mapper&,
+                                                     const PluginInterface*,
+                                                     std::optional<short>,
+                                                     bool>>> {
   typedef std::tuple<const PluginInterface* const, std::optional<short>, bool>
       LoadOrderTuple;
 
@@ -219,52 +237,21 @@ std::vector<T> MapFromLoadOrderData(
 
   // Now perform the mapping in a second loop that can be parallelised
   // (because sometimes the mapper is slow).
-  //
-  // Store mapped data in an std::variant because if the transformation is
-  // fallible then there needs to be some way of detecting that. The second
-  // type in the variant holds the exception message string if an exception
-  // is thrown by the mapper.
-  typedef std::variant<T, std::string> MappedDataOrError;
-  const auto transformer = [&mapper](const LoadOrderTuple& loadOrderTuple) {
-    try {
+  try {
+    return ParallelMap(data, [&mapper](const LoadOrderTuple& loadOrderTuple) {
       const auto [plugin, activeLoadOrderIndex, isActive] = loadOrderTuple;
 
-      const auto mappedData = mapper(plugin, activeLoadOrderIndex, isActive);
-
-      return MappedDataOrError(mappedData);
-    } catch (const std::exception& e) {
-      const auto logger = getLogger();
-      if (logger) {
-        logger->error(
-            "Failed to map load order data to output type, exception is: {}",
-            e.what());
-      }
-      return MappedDataOrError(e.what());
-    }
-  };
-
-  // Can't use std::back_inserter as the output iterator when running the
-  // transform in parallel, so presize the vector.
-  std::vector<MappedDataOrError> maybeMappedData(data.size());
-
-  std::transform(std::execution::par_unseq,
-                 data.cbegin(),
-                 data.cend(),
-                 maybeMappedData.begin(),
-                 transformer);
-
-  std::vector<T> mappedData;
-  mappedData.reserve(maybeMappedData.size());
-
-  for (const auto& mappedDataOrError : maybeMappedData) {
-    if (std::holds_alternative<T>(mappedDataOrError)) {
-      mappedData.push_back(std::get<T>(mappedDataOrError));
-    } else {
-      throw std::runtime_error(std::get<std::string>(mappedDataOrError));
+      return mapper(plugin, activeLoadOrderIndex, isActive);
+    });
+  } catch (const std::exception& e) {
+    const auto logger = getLogger();
+    if (logger) {
+      logger->error(
+          "Failed to map load order data to output type, exception is: {}",
+          e.what());
     }
+    throw;
   }
-
-  return mappedData;
 }
 }
 
@@ -26,6 +26,7 @@
 #ifndef LOOT_GUI_STATE_GAME_GAMES_MANAGER
 #define LOOT_GUI_STATE_GAME_GAMES_MANAGER
 
+#include <algorithm>
 #include <boost/locale.hpp>
 #include <filesystem>
 #include <mutex>
@@ -42,6 +43,9 @@
 namespace loot {
 class GamesManager {
 public:
+  // 1 GiB.
+  static constexpr size_t DEFAULT_GAME_DATA_CACHE_BUDGET = 1024 * 1024 * 1024;
+
   GamesManager() = default;
   GamesManager(const GamesManager&) = delete;
   GamesManager(GamesManager&&) = delete;
@@ -84,39 +88,54 @@ public:
         continue;
       }
 
-      if (currentGameFolder.has_value() &&
-          currentGameFolder.value() == gameSettings.FolderName() &&
-          !GameNeedsRecreating(GetCurrentGame(), gameSettings)) {
-        if (logger) {
+      // Keep existing game objects where possible so that any game data they
+      // hold stays cached.
+      const auto existingGame = FindInstalledGame(gameSettings.FolderName());
+      if (existingGame != installedGames_.end() &&
+          !GameNeedsRecreating(*existingGame, gameSettings)) {
+        if (isTraceLoggingEnabled(logger)) {
           logger->trace("Updating game entry for: {}",
                         gameSettings.FolderName());
         }
 
-        GetCurrentGame()
-            .GetSettings()
+        existingGame->GetSettings()
             .SetName(gameSettings.Name())
             .SetMinimumHeaderVersion(gameSettings.MinimumHeaderVersion())
             .SetMasterlistSource(gameSettings.MasterlistSource());
 
-        installedGames.push_back(std::move(GetCurrentGame()));
-        currentGameUpdated = true;
+        installedGames.push_back(std::move(*existingGame));
+
+        if (currentGameFolder.has_value() &&
+            currentGameFolder.value() == gameSettings.FolderName()) {
+          currentGameUpdated = true;
+        }
       } else {
-        if (logger) {
+        if (isTraceLoggingEnabled(logger)) {
           logger->trace("Adding new installed game entry for: {}",
                         gameSettings.FolderName());
         }
 
         installedGames.push_back(
             gui::Game(gameSettings, lootDataPath, preludePath));
+        RemoveFromGameDataCache(gameSettings.FolderName());
       }
     }
     installedGames_ = std::move(installedGames);
 
+    // Forget about any cached data for games that are no longer installed.
+    gameDataCache_.erase(
+        std::remove_if(gameDataCache_.begin(),
+                       gameDataCache_.end(),
+                       [&](const std::string& folderName) {
+                         return !IsGameInstalled(folderName);
+                       }),
+        gameDataCache_.end());
+
     if (currentGameUpdated) {
       SetCurrentGame(currentGameFolder.value());
     } else if (currentGameFolder.has_value()) {
       SetCurrentGame(currentGameFolder.value());
-      InitialiseGameData(GetCurrentGame());
+      InitialiseCurrentGameData();
     } else {
       currentGame_ = installedGames_.end();
     }
@@ -180,6 +199,43 @@ public:
     }
   }
 
+  // Initialise the current game's data, unless it's still cached from when the
+  // game was last current, in which case it will be reused and only the parts
+  // that have changed will be reloaded when the game's data is next loaded.
+  // If the cached data for all games exceeds the cache's memory budget, the
+  // data for the least recently used games other than the current game is
+  // unloaded.
+  void InitialiseCurrentGameData() {
+    std::lock_guard<std::recursive_mutex> guard(mutex_);
+
+    auto& game = GetCurrentGame();
+    const auto folderName = game.GetSettings().FolderName();
+
+    if (RemoveFromGameDataCache(folderName)) {
+      auto logger = getLogger();
+      if (logger) {
+        logger->debug("Reusing cached data for game: {}",
+                      game.GetSettings().Name());
+      }
+
+      ReuseGameData(game);
+    } else {
+      InitialiseGameData(game);
+    }
+
+    gameDataCache_.insert(gameDataCache_.begin(), folderName);
+
+    EnforceGameDataCacheBudget();
+  }
+
+  void SetGameDataCacheBudget(size_t budget) {
+    std::lock_guard<std::recursive_mutex> guard(mutex_);
+
+    gameDataCacheBudget_ = budget;
+
+    EnforceGameDataCacheBudget();
+  }
+
   std::vector<std::string> GetInstalledGameFolderNames() const {
     std::lock_guard<std::recursive_mutex> guard(mutex_);
 
@@ -219,6 +275,79 @@ private:
 
   virtual void InitialiseGameData(gui::Game& game) = 0;
 
+  // Prepare cached game data to be loaded again.
+  virtual void ReuseGameData(gui::Game& game) = 0;
+
+  virtual void UnloadGameData(gui::Game& game) = 0;
+
+  virtual size_t EstimateGameDataSize(const gui::Game& game) const = 0;
+
+  std::vector<gui::Game>::iterator FindInstalledGame(
+      const std::string& folderName) {
+    return std::find_if(installedGames_.begin(),
+                        installedGames_.end(),
+                        [&](const gui::Game& game) {
+                          return folderName == game.GetSettings().FolderName();
+                        });
+  }
+
+  bool RemoveFromGameDataCache(const std::string& folderName) {
+    const auto it =
+        std::find(gameDataCache_.begin(), gameDataCache_.end(), folderName);
+    if (it == gameDataCache_.end()) {
+      return false;
+    }
+
+    gameDataCache_.erase(it);
+    return true;
+  }
+
+  void EnforceGameDataCacheBudget() {
+    const auto currentGameFolder =
+        HasCurrentGame()
+            ? std::optional(GetCurrentGame().GetSettings().FolderName())
+            : std::nullopt;
+
+    std::vector<size_t> sizes;
+    size_t totalSize = 0;
+    for (const auto& folderName : gameDataCache_) {
+      const auto game = FindInstalledGame(folderName);
+      const auto size =
+          game == installedGames_.end() ? 0 : EstimateGameDataSize(*game);
+
+      sizes.push_back(size);
+      totalSize += size;
+    }
+
+    // Evict games from least to most recently used, but never the current
+    // game, even if its data alone exceeds the budget.
+    for (auto i = gameDataCache_.size();
+         i > 0 && totalSize > gameDataCacheBudget_;
+         --i) {
+      const auto index = i - 1;
+      if (gameDataCache_[index] == currentGameFolder) {
+        continue;
+      }
+
+      const auto game = FindInstalledGame(gameDataCache_[index]);
+      if (game != installedGames_.end()) {
+        auto logger = getLogger();
+        if (logger) {
+          logger->debug(
+              "Unloading cached data for game {} to stay within the cache "
+              "budget of {} bytes",
+              game->GetSettings().Name(),
+              gameDataCacheBudget_);
+        }
+
+        UnloadGameData(*game);
+      }
+
+      totalSize -= sizes[index];
+      gameDataCache_.erase(gameDataCache_.begin() + index);
+    }
+  }
+
   static bool GameNeedsRecreating(const gui::Game& game,
                                   const GameSettings& newSettings) {
     return game.GetSettings().GamePath() != newSettings.GamePath() ||
@@ -229,6 +358,11 @@ private:
   std::vector<gui::Game> installedGames_;
   std::vector<gui::Game>::iterator currentGame_{installedGames_.end()};
 
+  // The folder names of games that have initialised data, most recently used
+  // first.
+  std::vector<std::string> gameDataCache_;
+  size_t gameDataCacheBudget_{DEFAULT_GAME_DATA_CACHE_BUDGET};
+
   // Mutex used to protect access to member variables.
   mutable std::recursive_mutex mutex_;
 };
@@ -30,6 +30,8 @@
 namespace loot {
 constexpr uint32_t LGNP_MAGIC_NUMBER = 0x504E474C;
 constexpr uint8_t LGNP_FORMAT_VERSION = 1;
+constexpr uint32_t LGLC_MAGIC_NUMBER = 0x434C474C;
+constexpr uint8_t LGLC_FORMAT_VERSION = 1;
 
 size_t readStringLength(std::istream& in) {
   uint16_t length{0};
@@ -53,22 +55,14 @@ void writeStringLength(std::ostream& out, size_t length) {
   }
 }
 
-std::vector<GroupNodePosition> LoadGroupNodePositions(
-    const std ::filesystem::path& filePath) {
-  if (!std::filesystem::exists(filePath)) {
-    return {};
-  }
-
-  std::ifstream in(filePath, std::ios_base::in | std::ios_base::binary);
-  if (!in.is_open()) {
-    throw std::runtime_error(filePath.u8string() +
-                             " could not be opened for parsing");
-  }
-
+void readHeader(std::istream& in,
+                const std::filesystem::path& filePath,
+                uint32_t expectedMagicNumber,
+                uint8_t expectedFormatVersion) {
   uint32_t magicNumber{0};
   in.read(reinterpret_cast<char*>(&magicNumber), sizeof magicNumber);
 
-  if (magicNumber != LGNP_MAGIC_NUMBER) {
+  if (magicNumber != expectedMagicNumber) {
     throw std::runtime_error("Failed to parse " + filePath.u8string() +
                              ": wrong magic number");
   }
@@ -76,11 +70,13 @@ std::vector<GroupNodePosition> LoadGroupNodePositions(
   uint8_t formatVersion{0};
   in.read(reinterpret_cast<char*>(&formatVersion), sizeof formatVersion);
 
-  if (formatVersion != LGNP_FORMAT_VERSION) {
+  if (formatVersion != expectedFormatVersion) {
     throw std::runtime_error("Failed to parse " + filePath.u8string() +
                              ": unrecognised format version");
   }
+}
 
+std::vector<GroupNodePosition> readNodePositions(std::istream& in) {
   std::vector<GroupNodePosition> nodePositions;
   while (in.good()) {
     const auto stringLength = readStringLength(in);
@@ -105,8 +101,9 @@ std::vector<GroupNodePosition> LoadGroupNodePositions(
   return nodePositions;
 }
 
-void SaveGroupNodePositions(const std ::filesystem::path& filePath,
-                            const std::vector<GroupNodePosition>& positions) {
+std::ofstream openForWriting(const std::filesystem::path& filePath,
+                             uint32_t magicNumber,
+                             uint8_t formatVersion) {
   // Don't care about endianness because the files don't need to be portable.
 
   std::ofstream out(
@@ -117,11 +114,15 @@ void SaveGroupNodePositions(const std ::filesystem::path& filePath,
                              " could not be opened for writing");
   }
 
-  out.write(reinterpret_cast<const char*>(&LGNP_MAGIC_NUMBER),
-            sizeof LGNP_MAGIC_NUMBER);
-  out.write(reinterpret_cast<const char*>(&LGNP_FORMAT_VERSION),
-            sizeof LGNP_FORMAT_VERSION);
+  out.write(reinterpret_cast<const char*>(&magicNumber), sizeof magicNumber);
+  out.write(reinterpret_cast<const char*>(&formatVersion),
+            sizeof formatVersion);
 
+  return out;
+}
+
+void writeNodePositions(std::ostream& out,
+                        const std::vector<GroupNodePosition>& positions) {
   for (const auto& nodePosition : positions) {
     writeStringLength(out, nodePosition.groupName.size());
 
@@ -134,4 +135,79 @@ void SaveGroupNodePositions(const std ::filesystem::path& filePath,
               sizeof nodePosition.y);
   }
 }
+
+std::vector<GroupNodePosition> LoadGroupNodePositions(
+    const std ::filesystem::path& filePath) {
+  if (!std::filesystem::exists(filePath)) {
+    return {};
+  }
+
+  std::ifstream in(filePath, std::ios_base::in | std::ios_base::binary);
+  if (!in.is_open()) {
+    throw std::runtime_error(filePath.u8string() +
+                             " could not be opened for parsing");
+  }
+
+  readHeader(in, filePath, LGNP_MAGIC_NUMBER, LGNP_FORMAT_VERSION);
+
+  return readNodePositions(in);
+}
+
+void SaveGroupNodePositions(const std ::filesystem::path& filePath,
+                            const std::vector<GroupNodePosition>& positions) {
+  auto out = openForWriting(filePath, LGNP_MAGIC_NUMBER, LGNP_FORMAT_VERSION);
+
+  writeNodePositions(out, positions);
+}
+
+std::optional<GroupLayoutCache> LoadGroupLayoutCache(
+    const std::filesystem::path& filePath) {
+  if (!std::filesystem::exists(filePath)) {
+    return std::nullopt;
+  }
+
+  std::ifstream in(filePath, std::ios_base::in | std::ios_base::binary);
+  if (!in.is_open()) {
+    throw std::runtime_error(filePath.u8string() +
+                             " could not be opened for parsing");
+  }
+
+  readHeader(in, filePath, LGLC_MAGIC_NUMBER, LGLC_FORMAT_VERSION);
+
+  GroupLayoutCache cache;
+  in.read(reinterpret_cast<char*>(&cache.graphHash), sizeof cache.graphHash);
+
+  if (!in.good()) {
+    throw std::runtime_error("Failed to parse " + filePath.u8string() +
+                             ": missing graph hash");
+  }
+
+  cache.positions = readNodePositions(in);
+
+  return cache;
+}
+
+void SaveGroupLayoutCache(const std::filesystem::path& filePath,
+                          const GroupLayoutCache& cache) {
+  // Write to a temporary file in the same folder and then replace the cache
+  // with it, so that a failed or interrupted write can't leave a truncated
+  // cache behind.
+  auto tempPath = filePath;
+  tempPath += ".tmp";
+
+  auto out = openForWriting(tempPath, LGLC_MAGIC_NUMBER, LGLC_FORMAT_VERSION);
+
+  out.write(reinterpret_cast<const char*>(&cache.graphHash),
+            sizeof cache.graphHash);
+
+  writeNodePositions(out, cache.positions);
+
+  out.close();
+  if (out.fail()) {
+    std::filesystem::remove(tempPath);
+    throw std::runtime_error(tempPath.u8string() + " could not be written");
+  }
+
+  std::filesystem::rename(tempPath, filePath);
+}
 }
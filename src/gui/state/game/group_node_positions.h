@@ -26,7 +26,9 @@
 #ifndef LOOT_GUI_STATE_GAME_GROUP_NODE_POSITIONS
 #define LOOT_GUI_STATE_GAME_GROUP_NODE_POSITIONS
 
+#include <cstdint>
 #include <filesystem>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -42,6 +44,19 @@ std::vector<GroupNodePosition> LoadGroupNodePositions(
 
 void SaveGroupNodePositions(const std ::filesystem::path& filePath,
                             const std::vector<GroupNodePosition>& positions);
+
+// A calculated layout for a groups graph, keyed by a hash of the graph that
+// was laid out.
+struct GroupLayoutCache {
+  uint64_t graphHash{0};
+  std::vector<GroupNodePosition> positions;
+};
+
+std::optional<GroupLayoutCache> LoadGroupLayoutCache(
+    const std::filesystem::path& filePath);
+
+void SaveGroupLayoutCache(const std::filesystem::path& filePath,
+                          const GroupLayoutCache& cache);
 }
 
 #endif
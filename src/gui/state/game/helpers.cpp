@@ -30,8 +30,10 @@
 
 #include <boost/algorithm/string.hpp>
 #include <boost/locale.hpp>
+#include <cstring>
 #include <fstream>
 #include <regex>
+#include <unordered_set>
 
 #include "gui/state/logging.h"
 
@@ -43,6 +45,10 @@
 #define _UNICODE
 #endif
 #include "shlobj.h"
+#include "winioctl.h"
+#elif defined(__linux__)
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
 #endif
 
 namespace {
@@ -80,6 +86,19 @@ std::filesystem::path GetUserDocumentsPath(
   return gameLocalPath.parent_path().parent_path().parent_path() / "Documents";
 #endif
 }
+
+bool IsPluginCandidateFilename(const std::string& filename) {
+  if (loot::HasPluginFileExtension(filename)) {
+    return true;
+  }
+
+  static const auto GHOST_EXTENSION_LENGTH =
+      std::strlen(loot::GHOST_EXTENSION);
+
+  return boost::iends_with(filename, loot::GHOST_EXTENSION) &&
+         loot::HasPluginFileExtension(
+             filename.substr(0, filename.size() - GHOST_EXTENSION_LENGTH));
+}
 }
 
 namespace loot {
@@ -293,6 +312,177 @@ bool HasPluginFileExtension(const std::string& filename) {
          boost::iends_with(filename, ".esl");
 }
 
+bool operator==(const FileFingerprint& lhs, const FileFingerprint& rhs) {
+  return lhs.size == rhs.size && lhs.lastWriteTime == rhs.lastWriteTime;
+}
+
+bool operator!=(const FileFingerprint& lhs, const FileFingerprint& rhs) {
+  return !(lhs == rhs);
+}
+
+std::optional<FileFingerprint> GetFileFingerprint(
+    const std::filesystem::path& filePath) {
+  std::error_code sizeError;
+  std::error_code timeError;
+  const auto size = std::filesystem::file_size(filePath, sizeError);
+  const auto lastWriteTime =
+      std::filesystem::last_write_time(filePath, timeError);
+
+  if (sizeError || timeError) {
+    return std::nullopt;
+  }
+
+  return FileFingerprint{size, lastWriteTime};
+}
+
+FileFingerprints GetFileFingerprints(
+    const std::vector<std::filesystem::path>& filePaths) {
+  FileFingerprints fingerprints;
+
+  for (const auto& filePath : filePaths) {
+    fingerprints.emplace(filePath, GetFileFingerprint(filePath));
+  }
+
+  return fingerprints;
+}
+
+std::vector<std::filesystem::path> ScanForPluginCandidatePaths(
+    const std::vector<std::filesystem::path>& dataPaths) {
+  const auto logger = getLogger();
+
+  std::vector<std::filesystem::path> candidatePaths;
+  std::unordered_set<std::string> foundFilenames;
+
+  for (const auto& dataPath : dataPaths) {
+    if (!std::filesystem::exists(dataPath)) {
+      continue;
+    }
+
+    if (isTraceLoggingEnabled(logger)) {
+      logger->trace("Scanning for plugins in {}", dataPath.u8string());
+    }
+
+    for (std::filesystem::directory_iterator it(dataPath);
+         it != std::filesystem::directory_iterator();
+         ++it) {
+      // Check the extension first so that most non-plugin files are skipped
+      // without checking their type, which may involve a stat call if the
+      // directory entry didn't record it.
+      const auto filename = it->path().filename().u8string();
+      std::error_code errorCode;
+      if (!IsPluginCandidateFilename(filename) ||
+          !it->is_regular_file(errorCode)) {
+        continue;
+      }
+
+      if (foundFilenames.insert(boost::locale::fold_case(filename)).second) {
+        candidatePaths.push_back(it->path());
+      }
+    }
+  }
+
+  return candidatePaths;
+}
+
+std::optional<bool> IsOnRotationalDrive(const std::filesystem::path& path) {
+#ifdef _WIN32
+  std::wstring volumePath(MAX_PATH + 1, L'\0');
+  if (!GetVolumePathNameW(path.c_str(),
+                          volumePath.data(),
+                          static_cast<DWORD>(volumePath.size()))) {
+    return std::nullopt;
+  }
+
+  std::wstring volumeName(MAX_PATH + 1, L'\0');
+  if (!GetVolumeNameForVolumeMountPointW(
+          volumePath.c_str(),
+          volumeName.data(),
+          static_cast<DWORD>(volumeName.size()))) {
+    return std::nullopt;
+  }
+
+  // The volume name ends in a backslash that must be removed to open the
+  // volume itself, rather than its root directory.
+  volumeName.resize(wcslen(volumeName.c_str()));
+  if (!volumeName.empty() && volumeName.back() == L'\\') {
+    volumeName.pop_back();
+  }
+
+  const auto handle = CreateFileW(volumeName.c_str(),
+                                  0,
+                                  FILE_SHARE_READ | FILE_SHARE_WRITE,
+                                  NULL,
+                                  OPEN_EXISTING,
+                                  0,
+                                  NULL);
+  if (handle == INVALID_HANDLE_VALUE) {
+    return std::nullopt;
+  }
+
+  STORAGE_PROPERTY_QUERY query{};
+  query.PropertyId = StorageDeviceSeekPenaltyProperty;
+  query.QueryType = PropertyStandardQuery;
+
+  DEVICE_SEEK_PENALTY_DESCRIPTOR descriptor{};
+  DWORD bytesReturned = 0;
+  const auto succeeded = DeviceIoControl(handle,
+                                         IOCTL_STORAGE_QUERY_PROPERTY,
+                                         &query,
+                                         sizeof(query),
+                                         &descriptor,
+                                         sizeof(descriptor),
+                                         &bytesReturned,
+                                         NULL);
+  CloseHandle(handle);
+
+  if (!succeeded || bytesReturned < sizeof(descriptor)) {
+    return std::nullopt;
+  }
+
+  return descriptor.IncursSeekPenalty != FALSE;
+#elif defined(__linux__)
+  struct stat status;
+  if (stat(path.c_str(), &status) != 0) {
+    return std::nullopt;
+  }
+
+  // Partitions don't have their own queue attributes, so also check the
+  // attributes of the partition's parent device.
+  const auto devicePath =
+      std::filesystem::path("/sys/dev/block") /
+      (std::to_string(major(status.st_dev)) + ":" +
+       std::to_string(minor(status.st_dev)));
+  for (const auto& attributePath :
+       {devicePath / "queue" / "rotational",
+        devicePath / ".." / "queue" / "rotational"}) {
+    std::ifstream in(attributePath);
+    char value = 0;
+    if (in >> value) {
+      return value == '1';
+    }
+  }
+
+  return std::nullopt;
+#else
+  return std::nullopt;
+#endif
+}
+
+size_t GetPluginValidationConcurrency(std::optional<bool> isOnRotationalDrive,
+                                      size_t maxConcurrency) {
+  // Reading a couple of files at once gives a hard disk drive the chance to
+  // reorder its reads, but reading more just causes extra seeking.
+  static constexpr size_t ROTATIONAL_DRIVE_CONCURRENCY = 2;
+
+  maxConcurrency = std::max<size_t>(maxConcurrency, 1);
+
+  if (isOnRotationalDrive.value_or(false)) {
+    return std::min(ROTATIONAL_DRIVE_CONCURRENCY, maxConcurrency);
+  }
+
+  return maxConcurrency;
+}
+
 std::filesystem::path ResolveGameFilePath(
     const std::vector<std::filesystem::path>& externalDataPaths,
     const std::filesystem::path& dataPath,
@@ -32,7 +32,10 @@
 #include <loot/metadata/tag.h>
 #include <loot/vertex.h>
 
+#include <cstdint>
 #include <filesystem>
+#include <map>
+#include <optional>
 #include <tuple>
 #include <vector>
 
@@ -66,6 +69,46 @@ std::vector<std::string> GetTagConflicts(const std::vector<Tag>& tags1,
 
 bool HasPluginFileExtension(const std::string& filename);
 
+// The size and modification time of a file, used to cheaply detect if the file
+// has changed without reading it.
+struct FileFingerprint {
+  std::uintmax_t size{0};
+  std::filesystem::file_time_type lastWriteTime;
+};
+
+bool operator==(const FileFingerprint& lhs, const FileFingerprint& rhs);
+
+bool operator!=(const FileFingerprint& lhs, const FileFingerprint& rhs);
+
+// Returns std::nullopt if the file doesn't exist or can't be read.
+std::optional<FileFingerprint> GetFileFingerprint(
+    const std::filesystem::path& filePath);
+
+// Files that don't exist or can't be read are given a nullopt fingerprint.
+typedef std::map<std::filesystem::path, std::optional<FileFingerprint>>
+    FileFingerprints;
+
+FileFingerprints GetFileFingerprints(
+    const std::vector<std::filesystem::path>& filePaths);
+
+// Get the paths of the files in the given data folders that could be plugins,
+// going by their file extensions (ignoring any .ghost extension), without
+// opening any files. The folders are scanned in the given order, and a file is
+// skipped if a file with the same case-insensitive filename has already been
+// found.
+std::vector<std::filesystem::path> ScanForPluginCandidatePaths(
+    const std::vector<std::filesystem::path>& dataPaths);
+
+// Returns true if the given path is on a drive that incurs a seek penalty
+// (i.e. a hard disk drive), or nullopt if that can't be determined.
+std::optional<bool> IsOnRotationalDrive(const std::filesystem::path& path);
+
+// Get how many plugin files should be validated at once. Validation is
+// dominated by the time taken to open files, and hard disk drives get slower
+// if made to seek back and forth between many files.
+size_t GetPluginValidationConcurrency(std::optional<bool> isOnRotationalDrive,
+                                      size_t maxConcurrency);
+
 std::filesystem::path ResolveGameFilePath(
     const std::vector<std::filesystem::path>& externalDataPaths,
     const std::filesystem::path& dataPath,
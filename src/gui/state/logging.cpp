@@ -28,7 +28,9 @@
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/stdout_sinks.h>
 
+#include <atomic>
 #include <boost/algorithm/string/replace.hpp>
+#include <mutex>
 #include <optional>
 
 #include "gui/helpers.h"
@@ -117,7 +119,36 @@ std::vector<std::pair<std::string, std::string>> getStringsToCensor() {
 #endif
 }
 
-std::shared_ptr<spdlog::logger> getLogger() {
+namespace {
+std::mutex loggerMutex;
+// Loggers are kept alive once they've been published so that the pointers
+// returned by getLogger() never dangle.
+std::vector<std::shared_ptr<spdlog::logger>> publishedLoggers;
+std::atomic<spdlog::logger*> currentLogger{nullptr};
+
+// The logger mutex must be locked when calling this.
+spdlog::logger* publishLogger(const std::shared_ptr<spdlog::logger>& logger) {
+  publishedLoggers.push_back(logger);
+  currentLogger.store(logger.get(), std::memory_order_release);
+
+  return logger.get();
+}
+}
+
+spdlog::logger* getLogger() {
+  const auto current = currentLogger.load(std::memory_order_acquire);
+  if (current != nullptr) {
+    return current;
+  }
+
+  std::lock_guard<std::mutex> guard(loggerMutex);
+
+  // Another thread may have published a logger while this one was waiting.
+  const auto published = currentLogger.load(std::memory_order_acquire);
+  if (published != nullptr) {
+    return published;
+  }
+
   auto logger = spdlog::get(LOGGER_NAME);
 
   if (!logger) {
@@ -133,10 +164,12 @@ std::shared_ptr<spdlog::logger> getLogger() {
     }
   }
 
-  return logger;
+  return publishLogger(logger);
 }
 
 void setLogPath(const std::filesystem::path& outputFile) {
+  std::lock_guard<std::mutex> guard(loggerMutex);
+
   spdlog::set_pattern("[%T.%f] [%l]: %v");
 
   spdlog::drop(LOGGER_NAME);
@@ -155,6 +188,8 @@ void setLogPath(const std::filesystem::path& outputFile) {
     throw std::runtime_error("Error: Could not initialise logging.");
   }
   logger->flush_on(spdlog::level::trace);
+
+  publishLogger(logger);
 }
 
 void enableDebugLogging(bool enable) {
@@ -41,7 +41,24 @@
 #include <filesystem>
 
 namespace loot {
-std::shared_ptr<spdlog::logger> getLogger();
+#ifdef LOOT_DISABLE_TRACE_LOGGING
+inline constexpr bool TRACE_LOGGING_ENABLED = false;
+#else
+inline constexpr bool TRACE_LOGGING_ENABLED = true;
+#endif
+
+// Returns null if the logger could not be created. The returned logger is
+// never destroyed, so it's safe to hold on to even if the log path changes.
+// Once the logger has been created, this is just an atomic load.
+spdlog::logger* getLogger();
+
+// Check this before calling logger->trace() so that the log message's
+// arguments are only evaluated if trace logging is enabled at runtime, and so
+// that the call is compiled out if LOOT_DISABLE_TRACE_LOGGING is defined.
+inline bool isTraceLoggingEnabled(const spdlog::logger* logger) {
+  return TRACE_LOGGING_ENABLED && logger != nullptr &&
+         logger->should_log(spdlog::level::trace);
+}
 
 void setLogPath(const std::filesystem::path& outputFile);
 
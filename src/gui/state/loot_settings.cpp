@@ -777,6 +777,8 @@ void LootSettings::load(const std::filesystem::path& file) {
       settings["enableLootUpdateCheck"].value_or(enableLootUpdateCheck_);
   useNoSortingChangesDialog_ = settings["useNoSortingChangesDialog"].value_or(
       useNoSortingChangesDialog_);
+  gameDataCacheBudgetMiB_ = settings["gameDataCacheBudgetMiB"].value_or(
+      gameDataCacheBudgetMiB_);
   game_ = settings["game"].value_or(game_);
   language_ = settings["language"].value_or(language_);
   theme_ = settings["theme"].value_or(theme_);
@@ -885,6 +887,7 @@ void LootSettings::save(const std::filesystem::path& file) {
       {"updateMasterlist", updateMasterlistBeforeSort_},
       {"enableLootUpdateCheck", enableLootUpdateCheck_},
       {"useNoSortingChangesDialog", useNoSortingChangesDialog_},
+      {"gameDataCacheBudgetMiB", static_cast<int64_t>(gameDataCacheBudgetMiB_)},
       {"game", game_},
       {"language", language_},
       {"theme", theme_},
@@ -987,6 +990,12 @@ bool LootSettings::isNoSortingChangesDialogEnabled() const {
   return useNoSortingChangesDialog_;
 }
 
+size_t LootSettings::getGameDataCacheBudgetMiB() const {
+  lock_guard<recursive_mutex> guard(mutex_);
+
+  return gameDataCacheBudgetMiB_;
+}
+
 std::string LootSettings::getGame() const {
   lock_guard<recursive_mutex> guard(mutex_);
 
@@ -78,6 +78,9 @@ public:
   bool isMasterlistUpdateBeforeSortEnabled() const;
   bool isLootUpdateCheckEnabled() const;
   bool isNoSortingChangesDialogEnabled() const;
+  // The memory budget in MiB for keeping the data of recently used games
+  // loaded so that switching back to them is fast.
+  size_t getGameDataCacheBudgetMiB() const;
   std::string getGame() const;
   std::string getLastGame() const;
   std::string getLastVersion() const;
@@ -113,6 +116,7 @@ private:
   bool updateMasterlistBeforeSort_{true};
   bool enableLootUpdateCheck_{true};
   bool useNoSortingChangesDialog_{true};
+  size_t gameDataCacheBudgetMiB_{1024};
   std::string game_{"auto"};
   std::string lastGame_{"auto"};
   std::string lastVersion_;
@@ -44,6 +44,7 @@
 #include <boost/locale.hpp>
 
 #include "gui/helpers.h"
+#include "gui/message_strings.h"
 #include "gui/state/game/detection.h"
 #include "gui/state/game/detection/heroic.h"
 #include "gui/state/game/detection/registry.h"
@@ -103,6 +104,7 @@ LootState::LootState(const std::filesystem::path& lootAppPath,
   // Do some preliminary locale / UTF-8 support setup.
   boost::locale::generator gen;
   std::locale::global(gen("en.UTF-8"));
+  LoadMessageStrings();
 
   // Check if the LOOT local app data folder exists, and create it if not.
   createLootDataPath();
@@ -160,7 +162,7 @@ void LootState::initCurrentGame() {
   auto logger = getLogger();
 
   try {
-    GetCurrentGame().Init();
+    InitialiseCurrentGameData();
     if (logger) {
       logger->debug("Game named {} has been initialised",
                     GetCurrentGame().GetSettings().Name());
@@ -226,6 +228,8 @@ void LootState::loadSettings(const std::string& cmdLineGame, bool autoSort) {
   // Apply debug logging settings.
   enableDebugLogging(settings_.isDebugLoggingEnabled());
 
+  SetGameDataCacheBudget(settings_.getGameDataCacheBudgetMiB() * 1024 * 1024);
+
   // Now that settings have been loaded, set the locale again to handle
   // translations.
   if (settings_.getLanguage() != MessageContent::DEFAULT_LANGUAGE) {
@@ -243,6 +247,7 @@ void LootState::loadSettings(const std::string& cmdLineGame, bool autoSort) {
     gen.add_messages_path(l10nPath);
     gen.add_messages_domain("loot");
     std::locale::global(gen(settings_.getLanguage() + ".UTF-8"));
+    LoadMessageStrings();
   }
 }
 
@@ -419,6 +424,17 @@ bool LootState::IsInstalled(const GameSettings& gameSettings) const {
 
 void LootState::InitialiseGameData(gui::Game& game) { game.Init(); }
 
+void LootState::ReuseGameData(gui::Game& game) {
+  // Messages will be regenerated when the game's data is loaded.
+  game.ClearMessages();
+}
+
+void LootState::UnloadGameData(gui::Game& game) { game.Unload(); }
+
+size_t LootState::EstimateGameDataSize(const gui::Game& game) const {
+  return game.EstimateMemoryUsage();
+}
+
 std::optional<std::string> LootState::getPreferredGameFolderName(
     const std::string& cliGameValue) const {
   auto preferredGame = cliGameValue;
@@ -68,6 +68,12 @@ private:
 
   void InitialiseGameData(gui::Game& game) override;
 
+  void ReuseGameData(gui::Game& game) override;
+
+  void UnloadGameData(gui::Game& game) override;
+
+  size_t EstimateGameDataSize(const gui::Game& game) const override;
+
   std::optional<std::string> getPreferredGameFolderName(
       const std::string& cliGameValue) const;
 
@@ -0,0 +1,133 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/state/write_behind_saver.h"
+
+#include "gui/state/logging.h"
+
+namespace loot {
+WriteBehindSaver::WriteBehindSaver(
+    std::chrono::milliseconds delay,
+    std::function<void()> save,
+    std::function<void(const std::exception&)> onError) :
+    delay_(delay), save_(std::move(save)), onError_(std::move(onError)) {
+  thread_ = std::thread(&WriteBehindSaver::Run, this);
+}
+
+WriteBehindSaver::~WriteBehindSaver() {
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    isStopping_ = true;
+  }
+  condition_.notify_all();
+  thread_.join();
+
+  try {
+    Flush();
+  } catch (const std::exception& e) {
+    const auto logger = getLogger();
+    if (logger) {
+      logger->error("Failed to perform a pending save: {}", e.what());
+    }
+  }
+}
+
+void WriteBehindSaver::Schedule() {
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    deadline_ = std::chrono::steady_clock::now() + delay_;
+  }
+  condition_.notify_all();
+}
+
+void WriteBehindSaver::Flush() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  condition_.wait(lock, [this]() { return !isSaving_; });
+
+  if (deadline_.has_value() || lastSaveFailed_) {
+    Save(lock);
+  }
+}
+
+bool WriteBehindSaver::HasPendingSave() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return deadline_.has_value() || isSaving_ || lastSaveFailed_;
+}
+
+void WriteBehindSaver::Run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (!isStopping_) {
+    if (!deadline_.has_value() || isSaving_) {
+      condition_.wait(lock);
+      continue;
+    }
+
+    // Copy the deadline, as it may be changed while waiting.
+    const auto deadline = deadline_.value();
+    if (std::chrono::steady_clock::now() < deadline) {
+      condition_.wait_until(lock, deadline);
+      continue;
+    }
+
+    try {
+      Save(lock);
+    } catch (const std::exception& e) {
+      const auto logger = getLogger();
+      if (logger) {
+        logger->error("Failed to save in the background: {}", e.what());
+      }
+
+      if (onError_) {
+        lock.unlock();
+        onError_(e);
+        lock.lock();
+      }
+    }
+  }
+}
+
+void WriteBehindSaver::Save(std::unique_lock<std::mutex>& lock) {
+  deadline_ = std::nullopt;
+  lastSaveFailed_ = false;
+  isSaving_ = true;
+  lock.unlock();
+
+  std::exception_ptr error;
+  try {
+    save_();
+  } catch (...) {
+    error = std::current_exception();
+  }
+
+  lock.lock();
+  isSaving_ = false;
+  lastSaveFailed_ = error != nullptr;
+  condition_.notify_all();
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+}
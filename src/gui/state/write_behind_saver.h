@@ -0,0 +1,86 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_STATE_WRITE_BEHIND_SAVER
+#define LOOT_GUI_STATE_WRITE_BEHIND_SAVER
+
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace loot {
+// Saves data on a background thread once no save has been requested for a
+// given delay, so that a burst of edits results in a single save. Each save
+// must write out all of the data, as requests are not tracked individually.
+class WriteBehindSaver {
+public:
+  // save is called from the saver's thread, or from the thread that calls
+  // Flush(). onError is called from the saver's thread if a background save
+  // fails, and may be empty.
+  WriteBehindSaver(std::chrono::milliseconds delay,
+                   std::function<void()> save,
+                   std::function<void(const std::exception&)> onError);
+  // Performs any pending save, logging any error instead of throwing it.
+  ~WriteBehindSaver();
+
+  WriteBehindSaver(const WriteBehindSaver&) = delete;
+  WriteBehindSaver(WriteBehindSaver&&) = delete;
+
+  WriteBehindSaver& operator=(const WriteBehindSaver&) = delete;
+  WriteBehindSaver& operator=(WriteBehindSaver&&) = delete;
+
+  // Requests a save, restarting the delay if a save is already pending.
+  void Schedule();
+
+  // Waits for any background save to finish, then performs any pending save
+  // on the calling thread. A save that previously failed is retried. Throws
+  // if the save fails.
+  void Flush();
+
+  bool HasPendingSave() const;
+
+private:
+  void Run();
+  void Save(std::unique_lock<std::mutex>& lock);
+
+  std::chrono::milliseconds delay_;
+  std::function<void()> save_;
+  std::function<void(const std::exception&)> onError_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable condition_;
+  std::optional<std::chrono::steady_clock::time_point> deadline_;
+  bool isSaving_{false};
+  bool lastSaveFailed_{false};
+  bool isStopping_{false};
+  std::thread thread_;
+};
+}
+
+#endif
@@ -0,0 +1,88 @@
+/*  LOOT
+
+A load order optimisation tool for Oblivion, Skyrim, Fallout 3 and
+Fallout: New Vegas.
+
+Copyright (C) 2014-2016    WrinklyNinja
+
+This file is part of LOOT.
+
+LOOT is free software: you can redistribute
+it and/or modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+LOOT is distributed in the hope that it will
+be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with LOOT.  If not, see
+<https://www.gnu.org/licenses/>.
+*/
+#ifndef LOOT_TESTS_GUI_BENCHMARKS_GAME_BENCHMARKS
+#define LOOT_TESTS_GUI_BENCHMARKS_GAME_BENCHMARKS
+
+#include <benchmark/benchmark.h>
+
+#include "gui/plugin_item.h"
+#include "gui/state/game/game.h"
+#include "tests/gui/benchmarks/large_load_order_fixture.h"
+
+namespace loot::test {
+void LoadOrderSizes(benchmark::internal::Benchmark* benchmark) {
+  benchmark->Arg(1000)->Arg(5000)->Arg(10000)->Unit(benchmark::kMillisecond);
+}
+
+// There is no public function that only finds the installed plugin paths, so
+// this measures finding them and loading their headers, as is done on the
+// first load of a game's data.
+void BM_LoadAllInstalledPluginHeaders(benchmark::State& state) {
+  const auto& fixture =
+      LargeLoadOrderFixture::get(static_cast<size_t>(state.range(0)));
+  gui::Game game(fixture.getGameSettings(), fixture.getLootDataPath(), "");
+  game.Init();
+
+  for (auto _ : state) {
+    game.LoadAllInstalledPlugins(true);
+  }
+}
+BENCHMARK(BM_LoadAllInstalledPluginHeaders)->Apply(LoadOrderSizes);
+
+void BM_GetPluginItems(benchmark::State& state) {
+  const auto& fixture =
+      LargeLoadOrderFixture::get(static_cast<size_t>(state.range(0)));
+  const auto game = fixture.createLoadedGame();
+  const auto loadOrder = game->GetLoadOrder();
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(GetPluginItems(loadOrder, *game, "en"));
+  }
+}
+BENCHMARK(BM_GetPluginItems)->Apply(LoadOrderSizes);
+
+void BM_CheckInstallValidity(benchmark::State& state) {
+  const auto& fixture =
+      LargeLoadOrderFixture::get(static_cast<size_t>(state.range(0)));
+  const auto game = fixture.createLoadedGame();
+
+  std::vector<std::pair<const PluginInterface*, PluginMetadata>> plugins;
+  for (const auto plugin : game->GetPlugins()) {
+    auto metadata = game->GetMasterlistMetadata(plugin->GetName(), true);
+    if (metadata.has_value()) {
+      plugins.emplace_back(plugin, std::move(metadata.value()));
+    }
+  }
+
+  for (auto _ : state) {
+    for (const auto& [plugin, metadata] : plugins) {
+      benchmark::DoNotOptimize(
+          game->CheckInstallValidity(*plugin, metadata, "en"));
+    }
+  }
+}
+BENCHMARK(BM_CheckInstallValidity)->Apply(LoadOrderSizes);
+}
+
+#endif
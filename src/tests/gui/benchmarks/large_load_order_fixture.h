@@ -0,0 +1,214 @@
+/*  LOOT
+
+A load order optimisation tool for Oblivion, Skyrim, Fallout 3 and
+Fallout: New Vegas.
+
+Copyright (C) 2014-2016    WrinklyNinja
+
+This file is part of LOOT.
+
+LOOT is free software: you can redistribute
+it and/or modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+LOOT is distributed in the hope that it will
+be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with LOOT.  If not, see
+<https://www.gnu.org/licenses/>.
+*/
+#ifndef LOOT_TESTS_GUI_BENCHMARKS_LARGE_LOAD_ORDER_FIXTURE
+#define LOOT_TESTS_GUI_BENCHMARKS_LARGE_LOAD_ORDER_FIXTURE
+
+#include <spdlog/fmt/fmt.h>
+
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gui/plugin_item.h"
+#include "gui/state/game/game.h"
+#include "gui/state/game/game_settings.h"
+#include "tests/gui/test_helpers.h"
+
+namespace loot::test {
+// Creates a Skyrim Special Edition install with the given number of plugins
+// by cloning the testing-plugins Blank.esm and Blank.esp files, along with a
+// masterlist that gives the plugins groups, conditional messages, Bash Tag
+// suggestions, requirements and incompatibilities. The install is deleted
+// when the fixture is destroyed.
+class LargeLoadOrderFixture {
+public:
+  // Masters make up this fraction of the generated plugins.
+  static constexpr size_t MASTERS_DIVISOR = 10;
+  // Skyrim SE can't have more than 254 active full plugins.
+  static constexpr size_t ACTIVE_PLUGINS_COUNT = 250;
+
+  explicit LargeLoadOrderFixture(size_t pluginCount) :
+      rootPath(getTempPath()),
+      dataPath(rootPath / "games" / "game" / "Data"),
+      localPath(rootPath / "local" / "game"),
+      lootDataPath(rootPath / "local" / "LOOT"),
+      gameSettings(GameSettings(GameId::tes5se, "Skyrim Special Edition")
+                       .SetMinimumHeaderVersion(0.0f)
+                       .SetGamePath(dataPath.parent_path())
+                       .SetGameLocalPath(localPath)) {
+    std::filesystem::create_directories(dataPath);
+    std::filesystem::create_directories(localPath);
+    std::filesystem::create_directories(lootDataPath);
+
+    touch(dataPath.parent_path() / "SkyrimSE.exe");
+
+    const std::filesystem::path sourcePluginsPath = "./Skyrim/Data";
+    std::filesystem::copy_file(sourcePluginsPath / "Blank.esm",
+                               dataPath / "Skyrim.esm");
+
+    pluginNames.push_back("Skyrim.esm");
+    for (size_t i = 0; i < pluginCount; i += 1) {
+      const auto isMaster = i < pluginCount / MASTERS_DIVISOR;
+      const auto pluginName =
+          isMaster ? fmt::format("Benchmark Master {:05}.esm", i)
+                   : fmt::format("Benchmark Plugin {:05}.esp", i);
+
+      std::filesystem::copy_file(
+          sourcePluginsPath / (isMaster ? "Blank.esm" : "Blank.esp"),
+          dataPath / pluginName);
+
+      pluginNames.push_back(pluginName);
+    }
+
+    writePluginsFile();
+    writeMasterlist();
+  }
+
+  LargeLoadOrderFixture(const LargeLoadOrderFixture&) = delete;
+  LargeLoadOrderFixture(LargeLoadOrderFixture&&) = delete;
+
+  ~LargeLoadOrderFixture() { std::filesystem::remove_all(rootPath); }
+
+  LargeLoadOrderFixture& operator=(const LargeLoadOrderFixture&) = delete;
+  LargeLoadOrderFixture& operator=(LargeLoadOrderFixture&&) = delete;
+
+  // Fixtures are expensive to create, so share one per plugin count between
+  // all benchmarks.
+  static LargeLoadOrderFixture& get(size_t pluginCount) {
+    static std::map<size_t, std::unique_ptr<LargeLoadOrderFixture>> fixtures;
+
+    auto& fixture = fixtures[pluginCount];
+    if (!fixture) {
+      fixture = std::make_unique<LargeLoadOrderFixture>(pluginCount);
+    }
+
+    return *fixture;
+  }
+
+  // Returns a game with its plugin headers and metadata loaded.
+  std::unique_ptr<gui::Game> createLoadedGame() const {
+    auto game = std::make_unique<gui::Game>(gameSettings, lootDataPath, "");
+    game->Init();
+    game->LoadAllInstalledPlugins(true);
+    game->LoadMetadata();
+    game->LoadCreationClubPluginNames();
+
+    return game;
+  }
+
+  // The plugin items for the fixture's load order, which are cached.
+  const std::vector<PluginItem>& getPluginItems() {
+    if (pluginItems.empty()) {
+      const auto game = createLoadedGame();
+      pluginItems = GetPluginItems(game->GetLoadOrder(), *game, "en");
+    }
+
+    return pluginItems;
+  }
+
+  const GameSettings& getGameSettings() const { return gameSettings; }
+
+  const std::filesystem::path& getLootDataPath() const { return lootDataPath; }
+
+private:
+  void writePluginsFile() const {
+    std::ofstream out(localPath / "Plugins.txt");
+    for (size_t i = 0; i < pluginNames.size(); i += 1) {
+      if (i < ACTIVE_PLUGINS_COUNT) {
+        out << '*';
+      }
+
+      out << pluginNames.at(i) << std::endl;
+    }
+  }
+
+  void writeMasterlist() const {
+    const auto masterlistPath = GetMasterlistPath(lootDataPath, gameSettings);
+    std::filesystem::create_directories(masterlistPath.parent_path());
+
+    std::ofstream out(masterlistPath);
+    out << "bash_tags:\n"
+        << "  - Delev\n"
+        << "  - Relev\n"
+        << "groups:\n"
+        << "  - name: early\n"
+        << "  - name: default\n"
+        << "    after: [ early ]\n"
+        << "  - name: late\n"
+        << "    after: [ default ]\n"
+        << "plugins:\n";
+
+    static constexpr std::array<const char*, 3> GROUPS = {
+        "early", "default", "late"};
+
+    // Skip the game's master plugin.
+    for (size_t i = 1; i < pluginNames.size(); i += 1) {
+      const auto& name = pluginNames.at(i);
+      const auto& nextName = pluginNames.at((i + 1) % pluginNames.size());
+
+      out << "  - name: '" << name << "'\n"
+          << "    group: " << GROUPS.at(i % GROUPS.size()) << '\n';
+
+      if (i % 3 == 0) {
+        out << "    msg:\n"
+            << "      - type: warn\n"
+            << "        content: 'Benchmark warning for " << name << ".'\n"
+            << "        condition: 'file(\"" << nextName << "\")'\n"
+            << "      - type: say\n"
+            << "        content: 'Benchmark note.'\n";
+      }
+
+      if (i % 4 == 0) {
+        out << "    tag:\n"
+            << "      - name: Relev\n"
+            << "        condition: 'active(\"" << nextName << "\")'\n"
+            << "      - -Delev\n";
+      }
+
+      if (i % 5 == 0) {
+        out << "    req: [ 'Benchmark Missing " << i << ".esp' ]\n";
+      }
+
+      if (i % 7 == 0) {
+        out << "    inc: [ '" << nextName << "' ]\n";
+      }
+    }
+  }
+
+  const std::filesystem::path rootPath;
+  const std::filesystem::path dataPath;
+  const std::filesystem::path localPath;
+  const std::filesystem::path lootDataPath;
+  const GameSettings gameSettings;
+
+  std::vector<std::string> pluginNames;
+  std::vector<PluginItem> pluginItems;
+};
+}
+
+#endif
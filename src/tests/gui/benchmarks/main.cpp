@@ -0,0 +1,88 @@
+/*  LOOT
+
+A load order optimisation tool for Oblivion, Skyrim, Fallout 3 and
+Fallout: New Vegas.
+
+Copyright (C) 2014-2016    WrinklyNinja
+
+This file is part of LOOT.
+
+LOOT is free software: you can redistribute
+it and/or modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+LOOT is distributed in the hope that it will
+be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with LOOT.  If not, see
+<https://www.gnu.org/licenses/>.
+*/
+#ifdef _MSC_VER
+// Qt typedef's a uint type in the global namespace that spdlog shadows, just
+// disable the warning.
+#pragma warning(disable : 4459)
+#include <spdlog/sinks/null_sink.h>
+#include <spdlog/spdlog.h>
+#pragma warning(default : 4459)
+#else
+#include <spdlog/sinks/null_sink.h>
+#include <spdlog/spdlog.h>
+#endif
+
+#include <benchmark/benchmark.h>
+
+#include <QtWidgets/QApplication>
+#include <algorithm>
+#include <boost/locale.hpp>
+#include <string>
+#include <vector>
+
+#include "tests/gui/benchmarks/game_benchmarks.h"
+#include "tests/gui/benchmarks/plugin_list_benchmarks.h"
+
+int main(int argc, char **argv) {
+  // Set the logger to use a null sink.
+  spdlog::create<spdlog::sinks::null_sink_st>("loot_logger");
+
+  // Metadata evaluation uses boost::locale::to_lower().
+  boost::locale::generator gen;
+  std::locale::global(gen("en.UTF-8"));
+
+  // Card sizing needs widgets, but they never need to be shown.
+  if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM")) {
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+  }
+
+  int qtArgc = argc;
+  QApplication app(qtArgc, argv);
+
+  // Always write JSON results so that they can be compared between releases,
+  // unless an output file has been given.
+  std::vector<char *> args(argv, argv + argc);
+  std::string outArg = "--benchmark_out=loot_gui_benchmarks.json";
+  std::string outFormatArg = "--benchmark_out_format=json";
+
+  const auto hasOutArg =
+      std::any_of(args.begin(), args.end(), [](const char *arg) {
+        return std::string(arg).rfind("--benchmark_out=", 0) == 0;
+      });
+  if (!hasOutArg) {
+    args.push_back(outArg.data());
+    args.push_back(outFormatArg.data());
+  }
+
+  int benchmarkArgc = static_cast<int>(args.size());
+  ::benchmark::Initialize(&benchmarkArgc, args.data());
+  if (::benchmark::ReportUnrecognizedArguments(benchmarkArgc, args.data())) {
+    return 1;
+  }
+
+  ::benchmark::RunSpecifiedBenchmarks();
+  ::benchmark::Shutdown();
+
+  return 0;
+}
@@ -0,0 +1,121 @@
+/*  LOOT
+
+A load order optimisation tool for Oblivion, Skyrim, Fallout 3 and
+Fallout: New Vegas.
+
+Copyright (C) 2014-2016    WrinklyNinja
+
+This file is part of LOOT.
+
+LOOT is free software: you can redistribute
+it and/or modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+LOOT is distributed in the hope that it will
+be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with LOOT.  If not, see
+<https://www.gnu.org/licenses/>.
+*/
+#ifndef LOOT_TESTS_GUI_BENCHMARKS_PLUGIN_LIST_BENCHMARKS
+#define LOOT_TESTS_GUI_BENCHMARKS_PLUGIN_LIST_BENCHMARKS
+
+#include <benchmark/benchmark.h>
+
+#include <QtWidgets/QWidget>
+
+#include "gui/plugin_table.h"
+#include "gui/qt/card_delegate.h"
+#include "gui/qt/counters.h"
+#include "gui/qt/plugin_item_filter_model.h"
+#include "gui/qt/plugin_item_model.h"
+#include "gui/qt/search_engine.h"
+#include "tests/gui/benchmarks/game_benchmarks.h"
+#include "tests/gui/benchmarks/large_load_order_fixture.h"
+
+namespace loot::test {
+std::vector<PluginItem> getBenchmarkPluginItems(const benchmark::State& state) {
+  return LargeLoadOrderFixture::get(static_cast<size_t>(state.range(0)))
+      .getPluginItems();
+}
+
+void BM_FilterPlugins(benchmark::State& state) {
+  PluginItemModel model(nullptr);
+  model.setPluginItems(getBenchmarkPluginItems(state));
+
+  PluginItemFilterModel filterModel;
+  filterModel.setSourceModel(&model);
+
+  for (auto _ : state) {
+    PluginFiltersState filters;
+    filters.hideInactivePlugins = true;
+    filters.hideMessagelessPlugins = true;
+    filters.groupName = "late";
+    filters.content = ContentMatcher(QString("warning"));
+
+    filterModel.setFiltersState(std::move(filters));
+    benchmark::DoNotOptimize(filterModel.rowCount());
+
+    filterModel.setFiltersState(PluginFiltersState());
+    benchmark::DoNotOptimize(filterModel.rowCount());
+  }
+}
+BENCHMARK(BM_FilterPlugins)->Apply(LoadOrderSizes);
+
+void BM_SearchPlugins(benchmark::State& state) {
+  PluginItemModel model(nullptr);
+  model.setPluginItems(getBenchmarkPluginItems(state));
+
+  std::vector<int> rows;
+  for (int row = 1; row < model.rowCount(); row += 1) {
+    rows.push_back(row);
+  }
+
+  const auto matcher = ContentMatcher(QString("benchmark warning"));
+  const auto isCancelled = []() { return false; };
+
+  for (auto _ : state) {
+    const auto index = model.getSearchIndex(rows);
+    benchmark::DoNotOptimize(findSearchMatches(matcher, index, isCancelled));
+  }
+}
+BENCHMARK(BM_SearchPlugins)->Apply(LoadOrderSizes);
+
+void BM_CardSizingCacheUpdate(benchmark::State& state) {
+  PluginItemModel model(nullptr);
+  model.setPluginItems(getBenchmarkPluginItems(state));
+
+  QWidget parent;
+
+  for (auto _ : state) {
+    CardSizingCache cache(&parent);
+    cache.update(&model);
+    benchmark::DoNotOptimize(cache.getLargestMinWidth());
+  }
+}
+BENCHMARK(BM_CardSizingCacheUpdate)->Apply(LoadOrderSizes);
+
+void BM_GeneralInformationCounters(benchmark::State& state) {
+  const auto plugins = getBenchmarkPluginItems(state);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(GeneralInformationCounters({}, plugins));
+  }
+}
+BENCHMARK(BM_GeneralInformationCounters)->Apply(LoadOrderSizes);
+
+void BM_GeneralInformationCountersFromTable(benchmark::State& state) {
+  const auto table = PluginTable(getBenchmarkPluginItems(state));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(GeneralInformationCounters({}, table));
+  }
+}
+BENCHMARK(BM_GeneralInformationCountersFromTable)->Apply(LoadOrderSizes);
+}
+
+#endif
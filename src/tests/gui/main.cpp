@@ -39,8 +39,28 @@
 
 #include "tests/gui/backup_test.h"
 #include "tests/gui/helpers_test.h"
+#include "tests/gui/message_strings_test.h"
+#include "tests/gui/parallel_test.h"
+#include "tests/gui/plugin_item_test.h"
+#include "tests/gui/plugin_table_test.h"
+#include "tests/gui/qt/card_delegate_test.h"
+#include "tests/gui/qt/content_matcher_test.h"
+#include "tests/gui/qt/counters_test.h"
+#include "tests/gui/qt/data_change_coalescer_test.h"
+#include "tests/gui/qt/diagnostics_test.h"
+#include "tests/gui/qt/groups_editor/layout_test.h"
+#include "tests/gui/qt/groups_editor/plugin_groups_index_test.h"
 #include "tests/gui/qt/helpers_test.h"
+#include "tests/gui/qt/icon_factory_test.h"
+#include "tests/gui/qt/plugin_item_filter_model_test.h"
+#include "tests/gui/qt/plugin_item_model_test.h"
+#include "tests/gui/qt/plugin_name_list_model_test.h"
+#include "tests/gui/qt/search_engine_test.h"
+#include "tests/gui/qt/session_snapshot_test.h"
+#include "tests/gui/qt/sidebar_plugin_name_delegate_test.h"
+#include "tests/gui/qt/tasks/prefetched_query_test.h"
 #include "tests/gui/qt/tasks/tasks_test.h"
+#include "tests/gui/qt/tasks/update_masterlist_task_test.h"
 #include "tests/gui/sourced_message_test.h"
 #include "tests/gui/state/game/detection/common_test.h"
 #include "tests/gui/state/game/detection/detail_test.h"
@@ -59,6 +79,7 @@
 #include "tests/gui/state/loot_paths_test.h"
 #include "tests/gui/state/loot_settings_test.h"
 #include "tests/gui/state/unapplied_change_counter_test.h"
+#include "tests/gui/state/write_behind_saver_test.h"
 
 int main(int argc, char **argv) {
   // Set the logger to use a null sink.
@@ -0,0 +1,95 @@
+/*  LOOT
+
+A load order optimisation tool for Oblivion, Skyrim, Fallout 3 and
+Fallout: New Vegas.
+
+Copyright (C) 2014-2016    WrinklyNinja
+
+This file is part of LOOT.
+
+LOOT is free software: you can redistribute
+it and/or modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+LOOT is distributed in the hope that it will
+be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with LOOT.  If not, see
+<https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef LOOT_TESTS_GUI_MESSAGE_STRINGS_TEST
+#define LOOT_TESTS_GUI_MESSAGE_STRINGS_TEST
+
+#include <gtest/gtest.h>
+
+#include "gui/message_strings.h"
+
+namespace loot {
+namespace test {
+TEST(MessageFormat, formatShouldReplacePlaceholdersWithArguments) {
+  const MessageFormat format("{0} found {1} and {2}.");
+
+  EXPECT_EQ("TES5Edit found 1 ITM record and 2 deleted references.",
+            format.format(std::string("TES5Edit"),
+                          "1 ITM record",
+                          "2 deleted references"));
+}
+
+TEST(MessageFormat, formatShouldSupportReorderedAndRepeatedPlaceholders) {
+  const MessageFormat format("{1}, {0}, {1}");
+
+  EXPECT_EQ("b, a, b", format.format("a", "b"));
+}
+
+TEST(MessageFormat, formatShouldConvertNonStringArgumentsLikeFmt) {
+  const MessageFormat format("{0} of {1}");
+
+  EXPECT_EQ(fmt::format("{0} of {1}", 0.94f, size_t{3}),
+            format.format(0.94f, size_t{3}));
+}
+
+TEST(MessageFormat, formatShouldUnescapeDoubledBraces) {
+  const MessageFormat format("{{{0}}}");
+
+  EXPECT_EQ("{a}", format.format("a"));
+}
+
+TEST(MessageFormat, formatShouldFallBackToFmtForUnsupportedPlaceholders) {
+  const MessageFormat format("[{0:>3}]");
+
+  EXPECT_EQ("[  1]", format.format(1));
+}
+
+TEST(MessageFormat, formatShouldThrowIfAPlaceholderHasNoArgument) {
+  const MessageFormat format("{0} {1}");
+
+  EXPECT_THROW(format.format("a"), std::invalid_argument);
+}
+
+TEST(MessageFormat, strShouldReturnTheUnparsedFormatString) {
+  const MessageFormat format("{0} found {1}.");
+
+  EXPECT_EQ("{0} found {1}.", format.str());
+}
+
+TEST(GetMessageStrings, shouldReturnTheSameStringsUntilTheyAreReloaded) {
+  const auto& strings = GetMessageStrings();
+
+  EXPECT_EQ(&strings, &GetMessageStrings());
+  EXPECT_EQ("Location 2", strings.numberedLocation.format(2));
+
+  LoadMessageStrings();
+
+  EXPECT_NE(&strings, &GetMessageStrings());
+  EXPECT_EQ("Location", strings.location);
+}
+}
+}
+
+#endif
@@ -0,0 +1,173 @@
+/*  LOOT
+
+A load order optimisation tool for Oblivion, Skyrim, Fallout 3 and
+Fallout: New Vegas.
+
+Copyright (C) 2014-2016    WrinklyNinja
+
+This file is part of LOOT.
+
+LOOT is free software: you can redistribute
+it and/or modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+LOOT is distributed in the hope that it will
+be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with LOOT.  If not, see
+<https://www.gnu.org/licenses/>.
+*/
+
+#ifndef LOOT_TESTS_GUI_PARALLEL_TEST
+#define LOOT_TESTS_GUI_PARALLEL_TEST
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+#include "gui/parallel.h"
+
+namespace loot {
+namespace test {
+TEST(ThreadPool, shouldRunAllSubmittedTasks) {
+  std::atomic<int> counter{0};
+  {
+    ThreadPool pool(3);
+    for (int i = 0; i < 100; ++i) {
+      pool.submit([&counter]() { ++counter; });
+    }
+  }
+
+  EXPECT_EQ(100, counter);
+}
+
+TEST(ParallelMap, shouldReturnAnEmptyVectorIfGivenNoInputs) {
+  const std::vector<int> inputs;
+
+  const auto outputs = ParallelMap(inputs, [](int i) { return i * 2; });
+
+  EXPECT_TRUE(outputs.empty());
+}
+
+TEST(ParallelMap, shouldPreserveTheOrderOfInputs) {
+  std::vector<int> inputs(10000);
+  std::iota(inputs.begin(), inputs.end(), 0);
+
+  const auto outputs =
+      ParallelMap(inputs, [](int i) { return std::to_string(i); });
+
+  ASSERT_EQ(inputs.size(), outputs.size());
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    EXPECT_EQ(std::to_string(inputs[i]), outputs[i]);
+  }
+}
+
+TEST(ParallelMap, shouldConstructOutputsThatAreNotDefaultConstructible) {
+  struct Output {
+    explicit Output(int value) : value(value) {}
+
+    int value;
+  };
+
+  const std::vector<int> inputs{1, 2, 3};
+
+  const auto outputs = ParallelMap(inputs, [](int i) { return Output(i); });
+
+  ASSERT_EQ(3, outputs.size());
+  EXPECT_EQ(1, outputs[0].value);
+  EXPECT_EQ(2, outputs[1].value);
+  EXPECT_EQ(3, outputs[2].value);
+}
+
+TEST(ParallelMap, shouldMapInputsToBools) {
+  std::vector<int> inputs(1000);
+  std::iota(inputs.begin(), inputs.end(), 0);
+
+  const auto outputs = ParallelMap(inputs, [](int i) { return i % 3 == 0; });
+
+  ASSERT_EQ(inputs.size(), outputs.size());
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    EXPECT_EQ(inputs[i] % 3 == 0, outputs[i]);
+  }
+}
+
+TEST(ParallelMap, shouldDestroyConstructedOutputsIfMappingFails) {
+  ThreadPool pool(0);
+  const std::vector<int> inputs{1, 2, 3};
+  const auto counter = std::make_shared<int>(0);
+
+  const auto mapper = [&counter](int i) {
+    if (i == 2) {
+      throw std::runtime_error("failed");
+    }
+    return counter;
+  };
+
+  EXPECT_THROW(ParallelMap(inputs, mapper, pool), std::runtime_error);
+  EXPECT_EQ(1, counter.use_count());
+}
+
+TEST(ParallelMap, shouldWorkWithAPoolThatHasNoThreads) {
+  ThreadPool pool(0);
+  const std::vector<int> inputs{1, 2, 3};
+
+  const auto outputs = ParallelMap(
+      inputs, [](int i) { return i * 2; }, pool);
+
+  EXPECT_EQ(std::vector<int>({2, 4, 6}), outputs);
+}
+
+TEST(ParallelMap, shouldThrowTheErrorForTheLowestIndexThatFailed) {
+  ThreadPool pool(4);
+  std::vector<int> inputs(1000);
+  std::iota(inputs.begin(), inputs.end(), 0);
+
+  const auto mapper = [](int i) {
+    if (i % 100 == 37) {
+      throw std::runtime_error("failed for " + std::to_string(i));
+    }
+    return i;
+  };
+
+  for (int attempt = 0; attempt < 10; ++attempt) {
+    try {
+      ParallelMap(inputs, mapper, pool);
+      FAIL() << "ParallelMap did not throw";
+    } catch (const std::runtime_error& e) {
+      EXPECT_STREQ("failed for 37", e.what());
+    }
+  }
+}
+
+TEST(ParallelMap, shouldUseNoMoreThanTheMaximumNumberOfWorkers) {
+  ThreadPool pool(4);
+  std::vector<int> inputs(1000);
+  std::iota(inputs.begin(), inputs.end(), 0);
+
+  std::atomic<int> activeWorkers{0};
+  std::atomic<int> maxActiveWorkers{0};
+  const auto mapper = [&](int i) {
+    const auto active = ++activeWorkers;
+    auto previousMax = maxActiveWorkers.load();
+    while (active > previousMax &&
+           !maxActiveWorkers.compare_exchange_weak(previousMax, active)) {
+    }
+
+    std::this_thread::yield();
+    --activeWorkers;
+    return i;
+  };
+
+  const auto outputs = ParallelMap(inputs, mapper, pool, 2);
+
+  EXPECT_EQ(inputs, outputs);
+  EXPECT_GE(2, maxActiveWorkers);
+}
+}
+}
+
+#endif
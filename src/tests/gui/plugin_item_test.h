@@ -0,0 +1,229 @@
+/*  LOOT
+
+A load order optimisation tool for Oblivion, Skyrim, Fallout 3 and
+Fallout: New Vegas.
+
+Copyright (C) 2014-2016    WrinklyNinja
+
+This file is part of LOOT.
+
+LOOT is free software: you can redistribute
+it and/or modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+LOOT is distributed in the hope that it will
+be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with LOOT.  If not, see
+<https://www.gnu.org/licenses/>.
+*/
+#ifndef LOOT_TESTS_GUI_PLUGIN_ITEM_TEST
+#define LOOT_TESTS_GUI_PLUGIN_ITEM_TEST
+
+#include <gtest/gtest.h>
+
+#include "gui/plugin_item.h"
+
+namespace loot::test {
+PluginItemInputs createPluginItemInputs() {
+  PluginItem item;
+  item.name = "Blank.esp";
+  item.crc = 0x12345678;
+  item.version = "1.0";
+  item.isActive = true;
+  item.isMaster = true;
+  item.currentTags = {"Relev"};
+
+  return PluginItemInputs(item);
+}
+
+TEST(PluginItemInputs, constructorShouldCopyInputFieldsFromPluginItem) {
+  PluginItem item;
+  item.name = "Blank.esp";
+  item.crc = 0x12345678;
+  item.version = "1.0";
+  item.isActive = true;
+  item.isEmpty = true;
+  item.isMaster = true;
+  item.isLightPlugin = true;
+  item.isOverridePlugin = true;
+  item.loadsArchive = true;
+  item.currentTags = {"Relev"};
+
+  const auto inputs = PluginItemInputs(item);
+
+  EXPECT_EQ(item.name, inputs.name);
+  EXPECT_EQ(item.crc, inputs.crc);
+  EXPECT_EQ(item.version, inputs.version);
+  EXPECT_TRUE(inputs.isActive);
+  EXPECT_TRUE(inputs.isEmpty);
+  EXPECT_TRUE(inputs.isMaster);
+  EXPECT_TRUE(inputs.isLightPlugin);
+  EXPECT_TRUE(inputs.isOverridePlugin);
+  EXPECT_TRUE(inputs.loadsArchive);
+  EXPECT_EQ(item.currentTags, inputs.currentTags);
+}
+
+TEST(CanReusePluginItem, shouldReturnTrueIfInputsAreEqual) {
+  const auto inputs = createPluginItemInputs();
+
+  EXPECT_TRUE(CanReusePluginItem(inputs, inputs));
+}
+
+TEST(CanReusePluginItem,
+     shouldReturnFalseIfThePreviousItemWasBuiltFromAHeadersOnlyLoad) {
+  auto previous = createPluginItemInputs();
+  previous.crc = std::nullopt;
+
+  EXPECT_FALSE(CanReusePluginItem(previous, createPluginItemInputs()));
+  EXPECT_FALSE(CanReusePluginItem(previous, previous));
+}
+
+TEST(CanReusePluginItem, shouldReturnFalseIfAKnownCrcHasChanged) {
+  auto current = createPluginItemInputs();
+  current.crc = 0x87654321;
+
+  EXPECT_FALSE(CanReusePluginItem(createPluginItemInputs(), current));
+}
+
+TEST(CanReusePluginItem, shouldReturnFalseIfAnyOtherInputHasChanged) {
+  const auto previous = createPluginItemInputs();
+
+  auto current = previous;
+  current.name = "Other.esp";
+  EXPECT_FALSE(CanReusePluginItem(previous, current));
+
+  current = previous;
+  current.version = "2.0";
+  EXPECT_FALSE(CanReusePluginItem(previous, current));
+
+  current = previous;
+  current.isActive = false;
+  EXPECT_FALSE(CanReusePluginItem(previous, current));
+
+  current = previous;
+  current.isEmpty = true;
+  EXPECT_FALSE(CanReusePluginItem(previous, current));
+
+  current = previous;
+  current.isMaster = false;
+  EXPECT_FALSE(CanReusePluginItem(previous, current));
+
+  current = previous;
+  current.isLightPlugin = true;
+  EXPECT_FALSE(CanReusePluginItem(previous, current));
+
+  current = previous;
+  current.isOverridePlugin = true;
+  EXPECT_FALSE(CanReusePluginItem(previous, current));
+
+  current = previous;
+  current.loadsArchive = true;
+  EXPECT_FALSE(CanReusePluginItem(previous, current));
+
+  current = previous;
+  current.currentTags = {"Delev"};
+  EXPECT_FALSE(CanReusePluginItem(previous, current));
+}
+
+TEST(CanReusePluginItems, shouldReturnTrueIfInputsAreEqualInAnyOrder) {
+  auto other = createPluginItemInputs();
+  other.name = "Other.esp";
+
+  EXPECT_TRUE(CanReusePluginItems({createPluginItemInputs(), other},
+                                  {other, createPluginItemInputs()}));
+}
+
+TEST(CanReusePluginItems, shouldReturnFalseIfTheSetOfPluginsHasChanged) {
+  auto other = createPluginItemInputs();
+  other.name = "Other.esp";
+
+  EXPECT_FALSE(CanReusePluginItems({createPluginItemInputs()},
+                                   {createPluginItemInputs(), other}));
+  EXPECT_FALSE(CanReusePluginItems({createPluginItemInputs()}, {other}));
+}
+
+TEST(CanReusePluginItems, shouldReturnFalseIfAnyPluginVersionHasChanged) {
+  auto other = createPluginItemInputs();
+  other.name = "Other.esp";
+
+  auto changedOther = other;
+  changedOther.version = "2.0";
+
+  EXPECT_FALSE(CanReusePluginItems({createPluginItemInputs(), other},
+                                   {createPluginItemInputs(), changedOther}));
+}
+
+TEST(CanReusePluginItems, shouldReturnFalseIfAnyKnownPluginCrcHasChanged) {
+  auto other = createPluginItemInputs();
+  other.name = "Other.esp";
+
+  auto changedOther = other;
+  changedOther.crc = 0x87654321;
+
+  EXPECT_FALSE(CanReusePluginItems({createPluginItemInputs(), other},
+                                   {createPluginItemInputs(), changedOther}));
+}
+
+TEST(CanReusePluginItems,
+     shouldReturnFalseIfAnyItemWasBuiltFromAHeadersOnlyLoad) {
+  auto other = createPluginItemInputs();
+  other.name = "Other.esp";
+
+  auto headersOnlyOther = other;
+  headersOnlyOther.crc = std::nullopt;
+
+  EXPECT_FALSE(CanReusePluginItems({createPluginItemInputs(), headersOnlyOther},
+                                   {createPluginItemInputs(), other}));
+}
+
+TEST(CanReusePluginItems, shouldReturnFalseIfAnyActiveStateHasChanged) {
+  auto other = createPluginItemInputs();
+  other.name = "Other.esp";
+
+  auto changedOther = other;
+  changedOther.isActive = false;
+
+  EXPECT_FALSE(CanReusePluginItems({createPluginItemInputs(), other},
+                                   {createPluginItemInputs(), changedOther}));
+}
+
+TEST(PluginItem, equalityOperatorsShouldCompareFieldValues) {
+  PluginItem item;
+  item.name = "Blank.esp";
+  item.loadOrderIndex = 1;
+  item.crc = 0x12345678;
+  item.messages = {
+      SourcedMessage{MessageType::say, MessageSource::messageMetadata, "1"}};
+
+  auto other = item;
+  EXPECT_TRUE(item == other);
+  EXPECT_FALSE(item != other);
+
+  other.loadOrderIndex = 2;
+  EXPECT_FALSE(item == other);
+  EXPECT_TRUE(item != other);
+
+  other = item;
+  other.group = "late";
+  EXPECT_FALSE(item == other);
+
+  other = item;
+  other.hasUserMetadata = true;
+  EXPECT_FALSE(item == other);
+
+  other = item;
+  other.removeTags = {"Delev"};
+  EXPECT_FALSE(item == other);
+
+  other = item;
+  other.messages.at(0).text = "2";
+  EXPECT_FALSE(item == other);
+}
+}
+
+#endif
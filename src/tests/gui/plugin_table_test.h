@@ -0,0 +1,150 @@
+/*  LOOT
+
+A load order optimisation tool for Oblivion, Skyrim, Fallout 3 and
+Fallout: New Vegas.
+
+Copyright (C) 2014-2016    WrinklyNinja
+
+This file is part of LOOT.
+
+LOOT is free software: you can redistribute
+it and/or modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+LOOT is distributed in the hope that it will
+be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with LOOT.  If not, see
+<https://www.gnu.org/licenses/>.
+*/
+#ifndef LOOT_TESTS_GUI_PLUGIN_TABLE_TEST
+#define LOOT_TESTS_GUI_PLUGIN_TABLE_TEST
+
+#include <gtest/gtest.h>
+
+#include "gui/plugin_table.h"
+
+namespace loot::test {
+std::vector<PluginItem> createPluginTableItems() {
+  PluginItem first;
+  first.name = "Blank.esm";
+  first.isActive = true;
+  first.isMaster = true;
+  first.group = "early";
+  first.messages = {
+      SourcedMessage{MessageType::warn, MessageSource::messageMetadata, "1"},
+      SourcedMessage{MessageType::error, MessageSource::messageMetadata, "2"}};
+
+  PluginItem second;
+  second.name = "Blank.esp";
+  second.isDirty = true;
+  second.isEmpty = true;
+  second.isCreationClubPlugin = true;
+
+  PluginItem third;
+  third.name = "Blank.esl";
+  third.isActive = true;
+  third.isLightPlugin = true;
+  third.isOverridePlugin = true;
+  third.hasUserMetadata = true;
+  third.group = "early";
+  third.messages = {
+      SourcedMessage{MessageType::say, MessageSource::messageMetadata, "3"}};
+
+  return {first, second, third};
+}
+
+TEST(PluginTable, defaultConstructorShouldCreateAnEmptyTable) {
+  PluginTable table;
+
+  EXPECT_EQ(0, table.size());
+  EXPECT_EQ(0, table.getFlags(PluginFlag::active).size());
+  EXPECT_EQ(0, table.getTotalMessageCount());
+}
+
+TEST(PluginTable, constructorShouldSetOneBitPerPluginForEachFlag) {
+  PluginTable table(createPluginTableItems());
+
+  EXPECT_EQ(3, table.size());
+  EXPECT_EQ(PluginBitset(std::string("101")),
+            table.getFlags(PluginFlag::active));
+  EXPECT_EQ(PluginBitset(std::string("010")),
+            table.getFlags(PluginFlag::dirty));
+  EXPECT_EQ(PluginBitset(std::string("010")),
+            table.getFlags(PluginFlag::empty));
+  EXPECT_EQ(PluginBitset(std::string("001")),
+            table.getFlags(PluginFlag::master));
+  EXPECT_EQ(PluginBitset(std::string("100")),
+            table.getFlags(PluginFlag::lightPlugin));
+  EXPECT_EQ(PluginBitset(std::string("100")),
+            table.getFlags(PluginFlag::overridePlugin));
+  EXPECT_EQ(PluginBitset(std::string("010")),
+            table.getFlags(PluginFlag::creationClubPlugin));
+  EXPECT_EQ(PluginBitset(std::string("100")),
+            table.getFlags(PluginFlag::hasUserMetadata));
+}
+
+TEST(PluginTable, getGroupMembersShouldIncludeUngroupedPluginsInDefaultGroup) {
+  PluginTable table(createPluginTableItems());
+
+  EXPECT_EQ(PluginBitset(std::string("101")), table.getGroupMembers("early"));
+  EXPECT_EQ(PluginBitset(std::string("010")),
+            table.getGroupMembers(Group::DEFAULT_NAME));
+}
+
+TEST(PluginTable, getGroupMembersShouldReturnNoMembersForAnUnusedGroup) {
+  PluginTable table(createPluginTableItems());
+
+  EXPECT_TRUE(table.getGroupMembers("late").none());
+  EXPECT_EQ(3, table.getGroupMembers("late").size());
+}
+
+TEST(PluginTable, shouldCountMessagesByPluginAndByType) {
+  PluginTable table(createPluginTableItems());
+
+  EXPECT_EQ(2, table.getMessageCount(0));
+  EXPECT_EQ(0, table.getMessageCount(1));
+  EXPECT_EQ(1, table.getMessageCount(2));
+
+  EXPECT_EQ(3, table.getTotalMessageCount());
+  EXPECT_EQ(1, table.getTotalWarningCount());
+  EXPECT_EQ(1, table.getTotalErrorCount());
+}
+
+TEST(PluginTable, setPluginShouldReplaceOnlyTheGivenPluginsData) {
+  auto items = createPluginTableItems();
+  PluginTable table(items);
+
+  auto& second = items.at(1);
+  second.isActive = true;
+  second.isDirty = false;
+  second.group = "late";
+  second.messages = {
+      SourcedMessage{MessageType::warn, MessageSource::messageMetadata, "4"},
+      SourcedMessage{MessageType::warn, MessageSource::messageMetadata, "5"}};
+  table.setPlugin(1, second);
+
+  EXPECT_EQ(3, table.size());
+  EXPECT_EQ(PluginBitset(std::string("111")),
+            table.getFlags(PluginFlag::active));
+  EXPECT_TRUE(table.getFlags(PluginFlag::dirty).none());
+  EXPECT_TRUE(table.hasFlag(PluginFlag::empty, 1));
+
+  EXPECT_EQ(PluginBitset(std::string("010")), table.getGroupMembers("late"));
+  EXPECT_TRUE(table.getGroupMembers(Group::DEFAULT_NAME).none());
+  EXPECT_TRUE(table.isInGroup(1, "late"));
+  EXPECT_TRUE(table.isInGroup(2, "early"));
+
+  EXPECT_EQ(2, table.getMessageCount(1));
+  EXPECT_EQ(5, table.getTotalMessageCount());
+  EXPECT_EQ(3, table.getTotalWarningCount());
+  EXPECT_EQ(1, table.getTotalErrorCount());
+}
+
+}
+
+#endif
@@ -0,0 +1,315 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_CARD_DELEGATE_TEST
+#define LOOT_TESTS_GUI_QT_CARD_DELEGATE_TEST
+
+#include <gtest/gtest.h>
+
+#include <QtCore/QCoreApplication>
+
+#include "gui/qt/card_delegate.h"
+#include "gui/qt/plugin_item_model.h"
+
+namespace loot {
+namespace test {
+class CardSizingCacheTest : public ::testing::Test {
+protected:
+  CardSizingCacheTest() : model_(nullptr), cache_(nullptr) {}
+
+  ~CardSizingCacheTest() {
+    // The cache has no parent widget, so run any purge that it has scheduled
+    // while it still exists.
+    QCoreApplication::processEvents();
+  }
+
+  static std::vector<PluginItem> createItems(
+      const std::vector<std::string>& names) {
+    std::vector<PluginItem> items;
+    for (const auto& name : names) {
+      PluginItem item;
+      item.name = name;
+      // Give each plugin a different cache key.
+      item.currentTags = {name};
+      items.push_back(item);
+    }
+
+    return items;
+  }
+
+  // Update the cache in response to model changes in the same way as the
+  // main window does.
+  void connectCacheToModel() {
+    QObject::connect(&model_,
+                     &PluginItemModel::rowsInserted,
+                     [this](const QModelIndex&, int first, int last) {
+                       cache_.insertRows(first, last);
+                       cache_.update(&model_, first, last);
+                     });
+    QObject::connect(&model_,
+                     &PluginItemModel::rowsRemoved,
+                     [this](const QModelIndex&, int first, int last) {
+                       cache_.removeRows(first, last);
+                     });
+    QObject::connect(
+        &model_,
+        &PluginItemModel::rowsMoved,
+        [this](const QModelIndex&, int start, int end, const QModelIndex&,
+               int row) { cache_.moveRows(start, end, row); });
+    QObject::connect(&model_, &PluginItemModel::layoutChanged, [this]() {
+      cache_.update(&model_);
+    });
+    QObject::connect(
+        &model_,
+        &PluginItemModel::dataChanged,
+        [this](const QModelIndex& topLeft, const QModelIndex& bottomRight) {
+          cache_.update(topLeft, bottomRight);
+        });
+  }
+
+  void expectKeysToMatchRows() {
+    const auto& items = model_.getPluginItems();
+    for (size_t i = 0; i < items.size(); i += 1) {
+      const auto key = cache_.getCachedKey(static_cast<int>(i) + 1);
+
+      ASSERT_NE(nullptr, key);
+      EXPECT_EQ(QString::fromStdString(items.at(i).name), std::get<0>(*key));
+    }
+  }
+
+  PluginItemModel model_;
+  CardSizingCache cache_;
+};
+
+TEST_F(CardSizingCacheTest, updateShouldCacheAKeyForEveryRow) {
+  model_.setPluginItems(createItems({"A.esp", "B.esp", "C.esp"}));
+
+  cache_.update(&model_);
+
+  ASSERT_NE(nullptr, cache_.getCachedKey(0));
+  EXPECT_TRUE(std::get<5>(*cache_.getCachedKey(0)));
+  expectKeysToMatchRows();
+  EXPECT_EQ(nullptr, cache_.getCachedKey(4));
+}
+
+TEST_F(CardSizingCacheTest, updateShouldNotCreateAnyCards) {
+  model_.setPluginItems(createItems({"A.esp", "B.esp"}));
+
+  cache_.update(&model_);
+
+  EXPECT_FALSE(cache_.hasCard(*cache_.getCachedKey(1)));
+  EXPECT_EQ(0, cache_.getStatistics().entryCount);
+  EXPECT_EQ(0, cache_.getLargestMinWidth());
+}
+
+TEST_F(CardSizingCacheTest, insertRowsShouldShiftTheKeysOfLaterRows) {
+  model_.setPluginItems(createItems({"A.esp", "D.esp"}));
+  cache_.update(&model_);
+
+  cache_.insertRows(2, 3);
+
+  EXPECT_EQ(nullptr, cache_.getCachedKey(2));
+  EXPECT_EQ(nullptr, cache_.getCachedKey(3));
+  ASSERT_NE(nullptr, cache_.getCachedKey(4));
+  EXPECT_EQ(QString("D.esp"), std::get<0>(*cache_.getCachedKey(4)));
+}
+
+TEST_F(CardSizingCacheTest, insertRowsShouldDoNothingIfTheRowsAreAtTheEnd) {
+  model_.setPluginItems(createItems({"A.esp"}));
+  cache_.update(&model_);
+
+  cache_.insertRows(2, 3);
+
+  EXPECT_EQ(nullptr, cache_.getCachedKey(2));
+  EXPECT_EQ(nullptr, cache_.getCachedKey(3));
+}
+
+TEST_F(CardSizingCacheTest, removeRowsShouldShiftTheKeysOfLaterRows) {
+  model_.setPluginItems(createItems({"A.esp", "B.esp", "C.esp", "D.esp"}));
+  cache_.update(&model_);
+
+  cache_.removeRows(2, 3);
+
+  ASSERT_NE(nullptr, cache_.getCachedKey(2));
+  EXPECT_EQ(QString("D.esp"), std::get<0>(*cache_.getCachedKey(2)));
+  EXPECT_EQ(nullptr, cache_.getCachedKey(3));
+}
+
+TEST_F(CardSizingCacheTest, removeRowsShouldIgnoreRowsThatHaveNoKeys) {
+  model_.setPluginItems(createItems({"A.esp"}));
+  cache_.update(&model_);
+
+  cache_.removeRows(1, 5);
+
+  EXPECT_NE(nullptr, cache_.getCachedKey(0));
+  EXPECT_EQ(nullptr, cache_.getCachedKey(1));
+}
+
+TEST_F(CardSizingCacheTest, moveRowsShouldMoveKeysDown) {
+  model_.setPluginItems(createItems({"A.esp", "B.esp", "C.esp", "D.esp"}));
+  cache_.update(&model_);
+
+  // Move A and B to before row 5, i.e. to the end.
+  cache_.moveRows(1, 2, 5);
+
+  EXPECT_EQ(QString("C.esp"), std::get<0>(*cache_.getCachedKey(1)));
+  EXPECT_EQ(QString("D.esp"), std::get<0>(*cache_.getCachedKey(2)));
+  EXPECT_EQ(QString("A.esp"), std::get<0>(*cache_.getCachedKey(3)));
+  EXPECT_EQ(QString("B.esp"), std::get<0>(*cache_.getCachedKey(4)));
+}
+
+TEST_F(CardSizingCacheTest, moveRowsShouldMoveKeysUp) {
+  model_.setPluginItems(createItems({"A.esp", "B.esp", "C.esp", "D.esp"}));
+  cache_.update(&model_);
+
+  cache_.moveRows(4, 4, 1);
+
+  EXPECT_EQ(QString("D.esp"), std::get<0>(*cache_.getCachedKey(1)));
+  EXPECT_EQ(QString("A.esp"), std::get<0>(*cache_.getCachedKey(2)));
+  EXPECT_EQ(QString("B.esp"), std::get<0>(*cache_.getCachedKey(3)));
+  EXPECT_EQ(QString("C.esp"), std::get<0>(*cache_.getCachedKey(4)));
+}
+
+TEST_F(CardSizingCacheTest, moveRowsShouldDoNothingIfTheRowsDoNotMove) {
+  model_.setPluginItems(createItems({"A.esp", "B.esp", "C.esp"}));
+  cache_.update(&model_);
+
+  cache_.moveRows(2, 2, 3);
+  cache_.moveRows(2, 2, 2);
+
+  expectKeysToMatchRows();
+}
+
+TEST_F(CardSizingCacheTest,
+       keysShouldStayAlignedWithRowsWhenPluginItemsAreApplied) {
+  model_.setPluginItems(createItems({"A.esp", "B.esp", "C.esp", "D.esp"}));
+  cache_.update(&model_);
+  connectCacheToModel();
+
+  model_.applyPluginItems(createItems({"D.esp", "E.esp", "A.esp", "C.esp"}));
+
+  expectKeysToMatchRows();
+  EXPECT_EQ(nullptr, cache_.getCachedKey(5));
+}
+
+TEST_F(CardSizingCacheTest,
+       keysShouldStayAlignedWithRowsWhenTheLayoutChanges) {
+  std::vector<std::string> names;
+  for (int i = 0; i < 100; i += 1) {
+    names.push_back("Plugin" + std::to_string(i) + ".esp");
+  }
+
+  model_.setPluginItems(createItems(names));
+  cache_.update(&model_);
+  connectCacheToModel();
+
+  // Reversing the plugins moves too many rows to move them individually.
+  model_.applyPluginItems(
+      createItems(std::vector<std::string>(names.rbegin(), names.rend())));
+
+  expectKeysToMatchRows();
+}
+
+SizeHintCacheKey createSizeHintCacheKey(const QString& tags) {
+  return SizeHintCacheKey(tags, "", "", {}, {}, false);
+}
+
+TEST(SizeHintCache, findShouldReturnNulloptIfNoSizeHasBeenInserted) {
+  SizeHintCache cache;
+
+  EXPECT_FALSE(cache.find(createSizeHintCacheKey("A"), 500, 300).has_value());
+  EXPECT_EQ(0, cache.size());
+}
+
+TEST(SizeHintCache, findShouldReturnAnInsertedSizeForTheSameWidths) {
+  SizeHintCache cache;
+  const auto key = createSizeHintCacheKey("A");
+
+  cache.insert(key, 500, 300, QSize(500, 100));
+
+  EXPECT_EQ(QSize(500, 100), cache.find(key, 500, 300));
+  EXPECT_FALSE(cache.find(createSizeHintCacheKey("B"), 500, 300).has_value());
+  EXPECT_EQ(1, cache.size());
+}
+
+TEST(SizeHintCache, findShouldReturnNulloptIfTheRectWidthHasChanged) {
+  SizeHintCache cache;
+  const auto key = createSizeHintCacheKey("A");
+
+  cache.insert(key, 500, 300, QSize(500, 100));
+
+  EXPECT_FALSE(cache.find(key, 600, 300).has_value());
+}
+
+TEST(SizeHintCache,
+     findShouldReturnTheSizeIfTheLargestMinWidthChangesButIsNotWrappedTo) {
+  SizeHintCache cache;
+  const auto key = createSizeHintCacheKey("A");
+
+  cache.insert(key, 500, 300, QSize(500, 100));
+
+  EXPECT_EQ(QSize(500, 100), cache.find(key, 500, 400));
+  EXPECT_EQ(QSize(500, 100), cache.find(key, 500, 500));
+}
+
+TEST(SizeHintCache,
+     findShouldReturnNulloptIfTheLargestMinWidthChangesAndIsWrappedTo) {
+  SizeHintCache cache;
+  const auto key = createSizeHintCacheKey("A");
+
+  cache.insert(key, 200, 300, QSize(300, 100));
+
+  EXPECT_FALSE(cache.find(key, 200, 400).has_value());
+  EXPECT_FALSE(cache.find(key, 200, 100).has_value());
+}
+
+TEST(SizeHintCache,
+     largestMinWidthChangesShouldOnlyInvalidateTheSizesThatTheyAffect) {
+  SizeHintCache cache;
+  const auto wideKey = createSizeHintCacheKey("A");
+  const auto narrowKey = createSizeHintCacheKey("B");
+
+  cache.insert(wideKey, 500, 300, QSize(500, 100));
+  cache.insert(narrowKey, 200, 300, QSize(300, 200));
+
+  EXPECT_TRUE(cache.find(wideKey, 500, 400).has_value());
+  EXPECT_FALSE(cache.find(narrowKey, 200, 400).has_value());
+}
+
+TEST(SizeHintCache, insertShouldReplaceAStaleSize) {
+  SizeHintCache cache;
+  const auto key = createSizeHintCacheKey("A");
+
+  cache.insert(key, 200, 300, QSize(300, 200));
+  cache.insert(key, 200, 400, QSize(400, 150));
+
+  EXPECT_FALSE(cache.find(key, 200, 300).has_value());
+  EXPECT_EQ(QSize(400, 150), cache.find(key, 200, 400));
+  EXPECT_EQ(1, cache.size());
+}
+}
+}
+
+#endif
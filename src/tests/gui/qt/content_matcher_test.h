@@ -0,0 +1,108 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_CONTENT_MATCHER_TEST
+#define LOOT_TESTS_GUI_QT_CONTENT_MATCHER_TEST
+
+#include <gtest/gtest.h>
+
+#include "gui/qt/content_matcher.h"
+
+namespace loot {
+namespace test {
+TEST(ContentMatcher, textShouldMatchCaseInsensitively) {
+  const auto matcher = ContentMatcher(QString("BLANK"));
+
+  EXPECT_TRUE(matcher.matches("Blank.esp"));
+  EXPECT_FALSE(matcher.matches("Other.esp"));
+}
+
+TEST(ContentMatcher, emptyTextShouldBeEmptyAndValid) {
+  const auto matcher = ContentMatcher(QString());
+
+  EXPECT_TRUE(matcher.isEmpty());
+  EXPECT_TRUE(matcher.isValid());
+}
+
+TEST(ContentMatcher, invalidRegexShouldNotBeValidAndShouldHaveAnErrorString) {
+  const auto matcher = ContentMatcher(QRegularExpression("("));
+
+  EXPECT_FALSE(matcher.isValid());
+  EXPECT_FALSE(matcher.errorString().isEmpty());
+}
+
+TEST(ContentMatcher, fieldsShouldMatchIfAnyFieldMatches) {
+  const auto matcher = ContentMatcher(QRegularExpression("^v1\\.0$"));
+
+  EXPECT_TRUE(matcher.matches(QStringList({"Blank.esp", "v1.0", "Delev"})));
+  EXPECT_FALSE(matcher.matches(QStringList({"Blank.esp", "Delev"})));
+}
+
+TEST(ContentMatcher, regexShouldNotMatchAcrossFields) {
+  const auto whitespaceMatcher = ContentMatcher(QRegularExpression("esp\\sv1"));
+  const auto negatedClassMatcher =
+      ContentMatcher(QRegularExpression("Blank[^x]+Delev"));
+  const auto fields = QStringList({"Blank.esp", "v1.0", "Delev"});
+
+  EXPECT_FALSE(whitespaceMatcher.matches(fields));
+  EXPECT_FALSE(negatedClassMatcher.matches(fields));
+}
+
+TEST(ContentMatcher, regexAnchorsShouldMatchAtEachLineInAField) {
+  const auto matcher = ContentMatcher(QRegularExpression("^Do not clean\\.$"));
+  const auto fields = QStringList({"Blank.esp", "Note:\nDo not clean."});
+
+  EXPECT_TRUE(matcher.matches(fields));
+}
+
+TEST(ContentMatcher, regexShouldNotMatchOnceTheTimeBudgetIsExceeded) {
+  auto matcher =
+      ContentMatcher(QRegularExpression("Blank"), std::chrono::nanoseconds(0));
+
+  EXPECT_TRUE(matcher.hasExceededTimeBudget());
+  EXPECT_FALSE(matcher.matches("Blank.esp"));
+}
+
+TEST(ContentMatcher, resetTimeBudgetShouldResetTimeSpentMatching) {
+  auto matcher = ContentMatcher(QRegularExpression("Blank"),
+                                std::chrono::milliseconds(100));
+
+  EXPECT_TRUE(matcher.matches("Blank.esp"));
+
+  matcher.resetTimeBudget();
+
+  EXPECT_FALSE(matcher.hasExceededTimeBudget());
+}
+
+TEST(ContentMatcher, textShouldIgnoreTheTimeBudget) {
+  const auto matcher = ContentMatcher(QString("Blank"));
+
+  EXPECT_TRUE(matcher.matches("Blank.esp"));
+  EXPECT_FALSE(matcher.hasExceededTimeBudget());
+}
+}
+}
+
+#endif
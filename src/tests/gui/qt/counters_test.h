@@ -0,0 +1,127 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_COUNTERS_TEST
+#define LOOT_TESTS_GUI_QT_COUNTERS_TEST
+
+#include <gtest/gtest.h>
+
+#include "gui/qt/counters.h"
+
+namespace loot {
+namespace test {
+class HiddenMessageCounterTest : public ::testing::Test {
+protected:
+  HiddenMessageCounterTest() {
+    filters_.hideNotes = true;
+
+    PluginItem first;
+    first.name = "First.esp";
+    first.messages = {note(), warning()};
+
+    PluginItem second;
+    second.name = "Second.esp";
+    second.messages = {note(), note()};
+
+    PluginItem third;
+    third.name = "Third.esp";
+    third.messages = {warning()};
+
+    plugins_ = {first, second, third};
+  }
+
+  static SourcedMessage note() {
+    return SourcedMessage{
+        MessageType::say, MessageSource::messageMetadata, "note"};
+  }
+
+  static SourcedMessage warning() {
+    return SourcedMessage{
+        MessageType::warn, MessageSource::messageMetadata, "warning"};
+  }
+
+  CardContentFiltersState filters_;
+  std::vector<PluginItem> plugins_;
+  HiddenMessageCounter counter_;
+};
+
+TEST_F(HiddenMessageCounterTest, totalShouldBeZeroByDefault) {
+  EXPECT_EQ(0, counter_.getTotal());
+}
+
+TEST_F(HiddenMessageCounterTest, resetShouldCountEveryPluginsHiddenMessages) {
+  counter_.reset(plugins_, filters_);
+
+  EXPECT_EQ(3, counter_.getTotal());
+}
+
+TEST_F(HiddenMessageCounterTest,
+       resetShouldCountAllMessagesIfAllPluginMessagesAreHidden) {
+  filters_.hideAllPluginMessages = true;
+  counter_.reset(plugins_, filters_);
+
+  EXPECT_EQ(5, counter_.getTotal());
+}
+
+TEST_F(HiddenMessageCounterTest,
+       updateShouldRecountOnlyThePluginsInTheGivenRange) {
+  counter_.reset(plugins_, filters_);
+
+  plugins_.at(0).messages = {warning()};
+  plugins_.at(1).messages = {note()};
+  plugins_.at(2).messages = {note(), note()};
+  counter_.update(plugins_, 1, 1);
+
+  EXPECT_EQ(2, counter_.getTotal());
+
+  counter_.update(plugins_, 0, 2);
+
+  EXPECT_EQ(3, counter_.getTotal());
+}
+
+TEST_F(HiddenMessageCounterTest,
+       updateShouldUseTheFiltersGivenWhenTheCounterWasLastReset) {
+  counter_.reset(plugins_, filters_);
+
+  plugins_.at(2).messages = {note(), warning()};
+  counter_.update(plugins_, 2, 2);
+
+  EXPECT_EQ(4, counter_.getTotal());
+}
+
+TEST_F(HiddenMessageCounterTest,
+       updateShouldRecountEveryPluginIfTheNumberOfPluginsHasChanged) {
+  counter_.reset(plugins_, filters_);
+
+  plugins_.at(0).messages = {};
+  plugins_.push_back(plugins_.at(1));
+  counter_.update(plugins_, 3, 3);
+
+  EXPECT_EQ(4, counter_.getTotal());
+}
+}
+}
+
+#endif
@@ -0,0 +1,236 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_DATA_CHANGE_COALESCER_TEST
+#define LOOT_TESTS_GUI_QT_DATA_CHANGE_COALESCER_TEST
+
+#include <gtest/gtest.h>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QStringListModel>
+
+#include "gui/qt/data_change_coalescer.h"
+
+namespace loot {
+namespace test {
+class DataChangeCoalescerTest : public ::testing::Test {
+protected:
+  DataChangeCoalescerTest() :
+      model(new QStringListModel({"a", "b", "c", "d", "e"})) {}
+
+  ~DataChangeCoalescerTest() { delete model; }
+
+  void collectBatches(DataChangeCoalescer& coalescer) {
+    QObject::connect(&coalescer,
+                     &DataChangeCoalescer::changed,
+                     [this](const DataChanges& changes) {
+                       batches.push_back(changes);
+                     });
+  }
+
+  void setRow(int row, const QString& value) {
+    model->setData(model->index(row), value);
+  }
+
+  QStringListModel* model;
+  std::vector<DataChanges> batches;
+};
+
+TEST_F(DataChangeCoalescerTest,
+       shouldEmitChangesOnceControlReturnsToTheEventLoop) {
+  DataChangeCoalescer coalescer(model, {});
+  collectBatches(coalescer);
+
+  setRow(1, "f");
+  setRow(3, "g");
+
+  EXPECT_TRUE(coalescer.hasPendingChanges());
+  EXPECT_TRUE(batches.empty());
+
+  QCoreApplication::processEvents();
+
+  EXPECT_FALSE(coalescer.hasPendingChanges());
+  ASSERT_EQ(1, batches.size());
+  EXPECT_FALSE(batches[0].hasRowsChanged);
+  ASSERT_EQ(2, batches[0].rowRanges.size());
+  EXPECT_EQ(1, batches[0].rowRanges[0].first);
+  EXPECT_EQ(1, batches[0].rowRanges[0].last);
+  EXPECT_EQ(3, batches[0].rowRanges[1].first);
+  EXPECT_EQ(3, batches[0].rowRanges[1].last);
+  EXPECT_FALSE(batches[0].hasAllRoles);
+  EXPECT_TRUE(batches[0].hasRole(Qt::DisplayRole));
+  EXPECT_TRUE(batches[0].hasRole(Qt::EditRole));
+  EXPECT_FALSE(batches[0].hasRole(Qt::ToolTipRole));
+}
+
+TEST_F(DataChangeCoalescerTest,
+       shouldNotCollectChangesForWhichEveryRoleIsIgnored) {
+  DataChangeCoalescer coalescer(model, {Qt::DisplayRole, Qt::EditRole});
+  collectBatches(coalescer);
+
+  setRow(1, "f");
+  QCoreApplication::processEvents();
+
+  EXPECT_FALSE(coalescer.hasPendingChanges());
+  EXPECT_TRUE(batches.empty());
+}
+
+TEST_F(DataChangeCoalescerTest,
+       shouldCollectChangesThatDoNotSpecifyRolesAsChangingAllRoles) {
+  DataChangeCoalescer coalescer(model, {Qt::DisplayRole});
+  collectBatches(coalescer);
+
+  emit model->dataChanged(model->index(2), model->index(2));
+  coalescer.flush();
+
+  ASSERT_EQ(1, batches.size());
+  EXPECT_TRUE(batches[0].hasAllRoles);
+  EXPECT_TRUE(batches[0].hasRole(Qt::ToolTipRole));
+}
+
+TEST_F(DataChangeCoalescerTest, flushShouldEmitPendingChangesImmediately) {
+  DataChangeCoalescer coalescer(model, {});
+  collectBatches(coalescer);
+
+  coalescer.flush();
+  EXPECT_TRUE(batches.empty());
+
+  setRow(2, "f");
+  coalescer.flush();
+
+  ASSERT_EQ(1, batches.size());
+  ASSERT_EQ(1, batches[0].rowRanges.size());
+  EXPECT_EQ(2, batches[0].rowRanges[0].first);
+  EXPECT_EQ(2, batches[0].rowRanges[0].last);
+
+  // The scheduled flush has nothing left to emit.
+  QCoreApplication::processEvents();
+  EXPECT_EQ(1, batches.size());
+}
+
+TEST_F(DataChangeCoalescerTest,
+       shouldWidenPendingChangesToAllRowsWhenRowsAreInserted) {
+  DataChangeCoalescer coalescer(model, {});
+  collectBatches(coalescer);
+
+  setRow(2, "f");
+  model->insertRows(0, 2);
+  coalescer.flush();
+
+  ASSERT_EQ(1, batches.size());
+  EXPECT_TRUE(batches[0].hasRowsChanged);
+  ASSERT_EQ(1, batches[0].rowRanges.size());
+  EXPECT_EQ(0, batches[0].rowRanges[0].first);
+  EXPECT_EQ(6, batches[0].rowRanges[0].last);
+}
+
+TEST_F(DataChangeCoalescerTest,
+       shouldEmitChangesWhenRowsAreRemovedEvenIfNoDataChanged) {
+  DataChangeCoalescer coalescer(model, {});
+  collectBatches(coalescer);
+
+  model->removeRows(1, 2);
+  QCoreApplication::processEvents();
+
+  ASSERT_EQ(1, batches.size());
+  EXPECT_TRUE(batches[0].hasRowsChanged);
+  EXPECT_FALSE(batches[0].hasAllRoles);
+  EXPECT_TRUE(batches[0].roles.isEmpty());
+  ASSERT_EQ(1, batches[0].rowRanges.size());
+  EXPECT_EQ(0, batches[0].rowRanges[0].first);
+  EXPECT_EQ(2, batches[0].rowRanges[0].last);
+}
+
+TEST_F(DataChangeCoalescerTest,
+       shouldCollectChangesMadeWhileHandlingABatchIntoANewBatch) {
+  DataChangeCoalescer coalescer(model, {});
+  QObject::connect(&coalescer,
+                   &DataChangeCoalescer::changed,
+                   [this](const DataChanges& changes) {
+                     batches.push_back(changes);
+                     if (batches.size() == 1) {
+                       setRow(4, "g");
+                     }
+                   });
+
+  setRow(0, "f");
+  QCoreApplication::processEvents();
+  QCoreApplication::processEvents();
+
+  ASSERT_EQ(2, batches.size());
+  ASSERT_EQ(1, batches[0].rowRanges.size());
+  EXPECT_EQ(0, batches[0].rowRanges[0].first);
+  EXPECT_EQ(0, batches[0].rowRanges[0].last);
+  ASSERT_EQ(1, batches[1].rowRanges.size());
+  EXPECT_EQ(4, batches[1].rowRanges[0].first);
+  EXPECT_EQ(4, batches[1].rowRanges[0].last);
+}
+
+TEST_F(DataChangeCoalescerTest,
+       shouldMergeChangedRowsThatOverlapOrTouchIntoOneRange) {
+  DataChangeCoalescer coalescer(model, {});
+  collectBatches(coalescer);
+
+  setRow(4, "f");
+  setRow(0, "g");
+  emit model->dataChanged(model->index(2), model->index(3));
+  setRow(3, "h");
+  coalescer.flush();
+
+  ASSERT_EQ(1, batches.size());
+  ASSERT_EQ(2, batches[0].rowRanges.size());
+  EXPECT_EQ(0, batches[0].rowRanges[0].first);
+  EXPECT_EQ(0, batches[0].rowRanges[0].last);
+  EXPECT_EQ(2, batches[0].rowRanges[1].first);
+  EXPECT_EQ(4, batches[0].rowRanges[1].last);
+
+  setRow(1, "i");
+  coalescer.flush();
+
+  ASSERT_EQ(2, batches.size());
+  ASSERT_EQ(1, batches[1].rowRanges.size());
+  EXPECT_EQ(1, batches[1].rowRanges[0].first);
+  EXPECT_EQ(1, batches[1].rowRanges[0].last);
+}
+
+TEST(DataChanges, addRowsShouldMergeAllTheRangesThatTheRowsOverlapOrTouch) {
+  DataChanges changes;
+  changes.addRows(10, 12);
+  changes.addRows(2, 3);
+  changes.addRows(6, 6);
+  changes.addRows(20, 25);
+
+  changes.addRows(4, 11);
+
+  ASSERT_EQ(2, changes.rowRanges.size());
+  EXPECT_EQ(2, changes.rowRanges[0].first);
+  EXPECT_EQ(12, changes.rowRanges[0].last);
+  EXPECT_EQ(20, changes.rowRanges[1].first);
+  EXPECT_EQ(25, changes.rowRanges[1].last);
+}
+}
+}
+
+#endif
@@ -0,0 +1,116 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_DIAGNOSTICS_TEST
+#define LOOT_TESTS_GUI_QT_DIAGNOSTICS_TEST
+
+#include <gtest/gtest.h>
+
+#include <QtCore/QJsonArray>
+
+#include "gui/qt/diagnostics.h"
+
+namespace loot {
+namespace test {
+TEST(RecordTaskDuration, shouldOnlyKeepTheMostRecentDurationsForEachTask) {
+  const std::string taskName = "RecordTaskDurationTestTask";
+  for (size_t i = 0; i < RECENT_TASK_DURATIONS_LIMIT + 2; i += 1) {
+    RecordTaskDuration(taskName, std::chrono::milliseconds(i));
+  }
+
+  const auto durations = GetRecentTaskDurations().at(taskName);
+
+  ASSERT_EQ(RECENT_TASK_DURATIONS_LIMIT, durations.size());
+  EXPECT_EQ(std::chrono::milliseconds(2), durations.front());
+  EXPECT_EQ(std::chrono::milliseconds(RECENT_TASK_DURATIONS_LIMIT + 1),
+            durations.back());
+}
+
+TEST(RecordTaskDuration, shouldCountCompletedTasks) {
+  const auto before = GetWorkerThreadActivity();
+
+  RecordTaskDuration("CountCompletedTasksTestTask",
+                     std::chrono::milliseconds(5));
+
+  const auto after = GetWorkerThreadActivity();
+
+  EXPECT_EQ(before.completedTasks + 1, after.completedTasks);
+  EXPECT_EQ(before.totalTaskDuration + std::chrono::milliseconds(5),
+            after.totalTaskDuration);
+}
+
+TEST(RecordWorkerThreadFinished, shouldDecrementTheRunningThreadCount) {
+  const auto before = GetWorkerThreadActivity();
+
+  RecordWorkerThreadStarted();
+  EXPECT_EQ(before.runningThreads + 1,
+            GetWorkerThreadActivity().runningThreads);
+  EXPECT_EQ(before.startedThreads + 1,
+            GetWorkerThreadActivity().startedThreads);
+
+  RecordWorkerThreadFinished();
+  EXPECT_EQ(before.runningThreads, GetWorkerThreadActivity().runningThreads);
+}
+
+TEST(ToJson, shouldCalculateTheHitRateOfCacheStatistics) {
+  CacheStatistics statistics;
+  statistics.entryCount = 2;
+  statistics.hitCount = 3;
+  statistics.missCount = 1;
+
+  const auto json = ToJson(statistics);
+
+  EXPECT_EQ(2, json.value("entryCount").toInteger());
+  EXPECT_EQ(3, json.value("hitCount").toInteger());
+  EXPECT_EQ(1, json.value("missCount").toInteger());
+  EXPECT_DOUBLE_EQ(0.75, json.value("hitRate").toDouble());
+}
+
+TEST(ToJson, shouldGiveAHitRateOfZeroIfTheCacheHasNotBeenUsed) {
+  const auto json = ToJson(CacheStatistics());
+
+  EXPECT_DOUBLE_EQ(0.0, json.value("hitRate").toDouble());
+}
+
+TEST(ToJson, shouldSummariseTaskDurations) {
+  using std::chrono::milliseconds;
+  const std::map<std::string, std::vector<milliseconds>> durations{
+      {"SortPluginsQuery", {milliseconds(10), milliseconds(20)}},
+      {"Empty", {}}};
+
+  const auto json = ToJson(durations);
+
+  ASSERT_EQ(1, json.size());
+
+  const auto sortJson = json.value("SortPluginsQuery").toObject();
+  EXPECT_EQ(QJsonArray({10, 20}),
+            sortJson.value("recentDurationsMs").toArray());
+  EXPECT_EQ(20, sortJson.value("lastDurationMs").toInteger());
+  EXPECT_DOUBLE_EQ(15.0, sortJson.value("meanDurationMs").toDouble());
+}
+}
+}
+
+#endif
@@ -0,0 +1,154 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_GROUPS_EDITOR_LAYOUT_TEST
+#define LOOT_TESTS_GUI_QT_GROUPS_EDITOR_LAYOUT_TEST
+
+#include <gtest/gtest.h>
+
+#include <QtCore/QRectF>
+
+#include "gui/qt/groups_editor/layout.h"
+
+namespace loot {
+namespace test {
+// A chain of groups a -> b -> c.
+GroupGraph getChainGraph() {
+  return {GroupGraphNode{"a", 50, 20, {1}},
+          GroupGraphNode{"b", 50, 20, {2}},
+          GroupGraphNode{"c", 50, 20, {}}};
+}
+
+QRectF getNodeRect(const GroupGraphNode& node, const QPointF& position) {
+  return QRectF(position.x() - node.width / 2,
+                position.y() - node.height / 2,
+                node.width,
+                node.height);
+}
+
+TEST(hashGroupGraph, shouldNotDependOnTheOrderOfNodes) {
+  const GroupGraph reordered{GroupGraphNode{"c", 50, 20, {}},
+                             GroupGraphNode{"a", 50, 20, {2}},
+                             GroupGraphNode{"b", 50, 20, {0}}};
+
+  EXPECT_EQ(hashGroupGraph(getChainGraph()), hashGroupGraph(reordered));
+}
+
+TEST(hashGroupGraph, shouldChangeIfANodeIsRenamed) {
+  auto graph = getChainGraph();
+  graph.at(1).name = "d";
+
+  EXPECT_NE(hashGroupGraph(getChainGraph()), hashGroupGraph(graph));
+}
+
+TEST(hashGroupGraph, shouldChangeIfANodeIsResized) {
+  auto graph = getChainGraph();
+  graph.at(1).width = 60;
+
+  EXPECT_NE(hashGroupGraph(getChainGraph()), hashGroupGraph(graph));
+}
+
+TEST(hashGroupGraph, shouldChangeIfAnEdgeIsAdded) {
+  auto graph = getChainGraph();
+  graph.at(0).outNodes.push_back(2);
+
+  EXPECT_NE(hashGroupGraph(getChainGraph()), hashGroupGraph(graph));
+}
+
+TEST(hashGroupGraph, shouldNotLetAdjacentNamesRunTogether) {
+  const GroupGraph graph1{GroupGraphNode{"ab", 50, 20, {}},
+                          GroupGraphNode{"c", 50, 20, {}}};
+  const GroupGraph graph2{GroupGraphNode{"a", 50, 20, {}},
+                          GroupGraphNode{"bc", 50, 20, {}}};
+
+  EXPECT_NE(hashGroupGraph(graph1), hashGroupGraph(graph2));
+}
+
+TEST(placeNewNodes, shouldNotMoveNodesThatAlreadyHavePositions) {
+  const std::map<std::string, QPointF> positions{{"a", QPointF(0, 0)},
+                                                 {"b", QPointF(100, 0)}};
+
+  const auto result = placeNewNodes(getChainGraph(), positions);
+
+  EXPECT_EQ(QPointF(0, 0), result.at("a"));
+  EXPECT_EQ(QPointF(100, 0), result.at("b"));
+}
+
+TEST(placeNewNodes, shouldGiveEveryNodeAPosition) {
+  const auto graph = getChainGraph();
+
+  const auto result = placeNewNodes(graph, {});
+
+  ASSERT_EQ(graph.size(), result.size());
+  for (const auto& node : graph) {
+    EXPECT_EQ(1, result.count(node.name));
+  }
+}
+
+TEST(placeNewNodes,
+     shouldPlaceANewNodeOneLayerAwayFromItsNeighbourUsingTheExistingSpacing) {
+  const std::map<std::string, QPointF> positions{{"a", QPointF(0, 0)},
+                                                 {"b", QPointF(100, 0)}};
+
+  const auto result = placeNewNodes(getChainGraph(), positions);
+
+  EXPECT_EQ(QPointF(200, 0), result.at("c"));
+}
+
+TEST(placeNewNodes, shouldNotPlaceANewNodeOverlappingAPositionedNode) {
+  auto graph = getChainGraph();
+  graph.push_back(GroupGraphNode{"d", 50, 20, {}});
+  graph.at(0).outNodes.push_back(3);
+
+  const std::map<std::string, QPointF> positions{{"a", QPointF(0, 0)},
+                                                 {"b", QPointF(100, 0)},
+                                                 {"c", QPointF(200, 0)}};
+
+  const auto result = placeNewNodes(graph, positions);
+
+  const auto newRect = getNodeRect(graph.at(3), result.at("d"));
+  for (size_t i = 0; i < 3; i += 1) {
+    const auto& node = graph.at(i);
+    EXPECT_FALSE(newRect.intersects(getNodeRect(node, result.at(node.name))));
+  }
+}
+
+TEST(placeNewNodes, shouldPlaceADisconnectedNodeBelowThePositionedNodes) {
+  auto graph = getChainGraph();
+  graph.push_back(GroupGraphNode{"d", 50, 20, {}});
+
+  const std::map<std::string, QPointF> positions{{"a", QPointF(0, 0)},
+                                                 {"b", QPointF(100, 10)},
+                                                 {"c", QPointF(200, 0)}};
+
+  const auto result = placeNewNodes(graph, positions);
+
+  EXPECT_EQ(0.0, result.at("d").x());
+  EXPECT_LE(10 + NODE_SPACING, result.at("d").y());
+}
+}
+}
+
+#endif
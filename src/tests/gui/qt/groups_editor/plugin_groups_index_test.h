@@ -0,0 +1,141 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_GROUPS_EDITOR_PLUGIN_GROUPS_INDEX_TEST
+#define LOOT_TESTS_GUI_QT_GROUPS_EDITOR_PLUGIN_GROUPS_INDEX_TEST
+
+#include <gtest/gtest.h>
+
+#include "gui/qt/groups_editor/plugin_groups_index.h"
+
+namespace loot {
+namespace test {
+class PluginGroupsIndexTest : public ::testing::Test {
+protected:
+  PluginGroupsIndexTest() :
+      index_({createItem("A.esm", std::nullopt),
+              createItem("B.esp", "group1"),
+              createItem("C.esp", std::nullopt),
+              createItem("D.esp", "group1")}) {}
+
+  static PluginItem createItem(const std::string& name,
+                               const std::optional<std::string>& group) {
+    PluginItem item;
+    item.name = name;
+    item.group = group;
+    return item;
+  }
+
+  typedef std::vector<std::string> Names;
+
+  PluginGroupsIndex index_;
+};
+
+TEST_F(PluginGroupsIndexTest, shouldBeEmptyIfThereAreNoPlugins) {
+  EXPECT_TRUE(PluginGroupsIndex().empty());
+  EXPECT_TRUE(PluginGroupsIndex(std::vector<PluginItem>()).empty());
+  EXPECT_FALSE(index_.empty());
+}
+
+TEST_F(PluginGroupsIndexTest, getPluginIndexShouldBeCaseInsensitive) {
+  EXPECT_EQ(std::optional<size_t>(1), index_.getPluginIndex("b.ESP"));
+  EXPECT_EQ("B.esp", index_.getPluginName(1));
+  EXPECT_FALSE(index_.getPluginIndex("E.esp").has_value());
+}
+
+TEST_F(PluginGroupsIndexTest,
+       getGroupPluginNamesShouldListAGroupsPluginsInLoadOrder) {
+  EXPECT_EQ(Names({"A.esm", "C.esp"}),
+            index_.getGroupPluginNames(Group::DEFAULT_NAME));
+  EXPECT_EQ(Names({"B.esp", "D.esp"}), index_.getGroupPluginNames("group1"));
+  EXPECT_EQ(Names(), index_.getGroupPluginNames("group2"));
+}
+
+TEST_F(PluginGroupsIndexTest,
+       setPluginGroupShouldMoveThePluginBetweenTheGroupsIndexes) {
+  index_.setPluginGroup(2, "group1");
+
+  EXPECT_EQ("group1", index_.getPluginGroup(2));
+  EXPECT_EQ(Names({"A.esm"}), index_.getGroupPluginNames(Group::DEFAULT_NAME));
+  EXPECT_EQ(Names({"B.esp", "C.esp", "D.esp"}),
+            index_.getGroupPluginNames("group1"));
+  EXPECT_EQ(1, index_.getNewPluginGroups().size());
+  EXPECT_EQ("group1", index_.getNewPluginGroups().at("C.esp"));
+}
+
+TEST_F(PluginGroupsIndexTest,
+       setPluginGroupShouldRemoveAGroupFromTheIndexWhenItBecomesEmpty) {
+  index_.setPluginGroup(0, "group1");
+  index_.setPluginGroup(2, "group1");
+
+  EXPECT_EQ(Names(), index_.getGroupPluginNames(Group::DEFAULT_NAME));
+  EXPECT_FALSE(index_.containsMoreThanOnePlugin(Group::DEFAULT_NAME));
+  EXPECT_TRUE(index_.containsMoreThanOnePlugin("group1"));
+}
+
+TEST_F(PluginGroupsIndexTest,
+       setPluginGroupShouldForgetTheNewGroupIfThePluginIsMovedBack) {
+  index_.setPluginGroup(1, "group2");
+  index_.setPluginGroup(1, "group1");
+
+  EXPECT_EQ("group1", index_.getPluginGroup(1));
+  EXPECT_TRUE(index_.getNewPluginGroups().empty());
+  EXPECT_EQ(Names({"B.esp", "D.esp"}), index_.getGroupPluginNames("group1"));
+  EXPECT_EQ(Names(), index_.getGroupPluginNames("group2"));
+}
+
+TEST_F(PluginGroupsIndexTest,
+       containsMoreThanOnePluginShouldReflectTheCurrentGroups) {
+  EXPECT_TRUE(index_.containsMoreThanOnePlugin("group1"));
+
+  index_.setPluginGroup(3, "group2");
+
+  EXPECT_FALSE(index_.containsMoreThanOnePlugin("group1"));
+  EXPECT_FALSE(index_.containsMoreThanOnePlugin("group2"));
+}
+
+TEST_F(PluginGroupsIndexTest,
+       renameGroupShouldMoveAllTheGroupsPluginsIncludingMovedPlugins) {
+  index_.setPluginGroup(0, "group1");
+
+  index_.renameGroup("group1", "group2");
+
+  EXPECT_EQ(Names(), index_.getGroupPluginNames("group1"));
+  EXPECT_EQ(Names({"A.esm", "B.esp", "D.esp"}),
+            index_.getGroupPluginNames("group2"));
+  EXPECT_EQ(3, index_.getNewPluginGroups().size());
+  EXPECT_EQ("group2", index_.getNewPluginGroups().at("A.esm"));
+}
+
+TEST_F(PluginGroupsIndexTest, renameGroupShouldDoNothingForAnEmptyGroup) {
+  index_.renameGroup("group2", "group3");
+
+  EXPECT_EQ(Names(), index_.getGroupPluginNames("group3"));
+  EXPECT_TRUE(index_.getNewPluginGroups().empty());
+}
+}
+}
+
+#endif
@@ -69,6 +69,10 @@ class UpdateFileWithDataTest : public QtHelpersFixture {};
 
 class UpdateFileTest : public QtHelpersFixture {};
 
+class GetHttpCacheValidatorsTest : public QtHelpersFixture {};
+
+class UpdateFileWithResponseTest : public QtHelpersFixture {};
+
 TEST(calculateGitBlobHash, shouldCalculateTheSameHashAsGitDoesForABlob) {
   auto data = QByteArray("some text to hash");
   auto hash = calculateGitBlobHash(data);
@@ -316,6 +320,81 @@ TEST_F(UpdateFileTest, shouldWriteMetadataFileEvenIfHashIsUnchanged) {
   EXPECT_EQ(expectedDate, revision.date);
 }
 
+TEST_F(GetHttpCacheValidatorsTest, shouldReturnNoValidatorsIfFileDoesNotExist) {
+  const auto validators = getHttpCacheValidators(rootPath_ / "missing");
+
+  EXPECT_TRUE(validators.empty());
+}
+
+TEST_F(GetHttpCacheValidatorsTest, shouldReturnRecordedValidators) {
+  std::ofstream out(fileMetadataPath_, std::ios_base::app);
+  out << std::endl << "etag = \"\\\"abc\\\"\"" << std::endl;
+  out << "last_modified = \"Sat, 22 Jan 2022 00:00:00 GMT\"";
+  out.close();
+
+  const auto validators = getHttpCacheValidators(filePath_);
+
+  EXPECT_EQ("\"abc\"", validators.etag);
+  EXPECT_EQ("Sat, 22 Jan 2022 00:00:00 GMT", validators.lastModified);
+}
+
+TEST_F(GetHttpCacheValidatorsTest,
+       shouldReturnNoValidatorsIfFileHasBeenModified) {
+  std::ofstream metadataOut(fileMetadataPath_, std::ios_base::app);
+  metadataOut << std::endl << "etag = \"abc\"";
+  metadataOut.close();
+
+  std::ofstream out(filePath_);
+  out << "";
+  out.close();
+
+  const auto validators = getHttpCacheValidators(filePath_);
+
+  EXPECT_TRUE(validators.empty());
+}
+
+TEST_F(UpdateFileWithResponseTest,
+       shouldWriteDataAndValidatorsIfResponseIsNotANotModifiedResponse) {
+  HttpFileResponse response;
+  response.data = QByteArray("new data");
+  response.validators.etag = "\"abc\"";
+
+  const auto result = updateFileWithResponse(filePath_, response);
+
+  EXPECT_TRUE(result);
+
+  const auto revision = getFileRevision(filePath_);
+  EXPECT_EQ(calculateGitBlobHash(response.data), revision.id);
+  EXPECT_EQ("\"abc\"", revision.httpValidators.etag);
+}
+
+TEST_F(UpdateFileWithResponseTest,
+       shouldOnlyUpdateMetadataIfResponseIsANotModifiedResponse) {
+  std::ofstream metadataOut(fileMetadataPath_, std::ios_base::app);
+  metadataOut << std::endl << "etag = \"abc\"";
+  metadataOut.close();
+
+  const auto originalHash = calculateGitBlobHash(filePath_);
+
+  HttpFileResponse response;
+  response.isNotModified = true;
+  response.validators.lastModified = "Sat, 22 Jan 2022 00:00:00 GMT";
+
+  const auto result = updateFileWithResponse(filePath_, response);
+
+  EXPECT_FALSE(result);
+
+  const auto revision = getFileRevision(filePath_);
+  const auto expectedDate =
+      QDate::currentDate().toString(Qt::ISODate).toStdString();
+
+  EXPECT_EQ(originalHash, revision.id);
+  EXPECT_EQ(expectedDate, revision.date);
+  EXPECT_EQ("abc", revision.httpValidators.etag);
+  EXPECT_EQ("Sat, 22 Jan 2022 00:00:00 GMT",
+            revision.httpValidators.lastModified);
+}
+
 TEST(isValidUrl, shouldBeFalseForALocalWindowsPath) {
   auto result = isValidUrl("C:\\Users\\user\\file");
 
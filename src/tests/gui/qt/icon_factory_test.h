@@ -0,0 +1,68 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_ICON_FACTORY_TEST
+#define LOOT_TESTS_GUI_QT_ICON_FACTORY_TEST
+
+#include <gtest/gtest.h>
+
+#include "gui/qt/icon_factory.h"
+
+namespace loot {
+namespace test {
+TEST(recolorImage, shouldSetTheColorOfEveryPixelAndKeepTheirAlphaValues) {
+  QImage image(2, 1, QImage::Format_ARGB32);
+  image.setPixel(0, 0, qRgba(10, 20, 30, 255));
+  image.setPixel(1, 0, qRgba(10, 20, 30, 0));
+
+  const auto recolored = recolorImage(image, QColor(200, 100, 50));
+
+  EXPECT_EQ(QImage::Format_ARGB32_Premultiplied, recolored.format());
+  EXPECT_EQ(QColor(200, 100, 50, 255), recolored.pixelColor(0, 0));
+  EXPECT_EQ(0, recolored.pixelColor(1, 0).alpha());
+}
+
+TEST(recolorImage, shouldPremultiplyTheColorByEachPixelsAlphaValue) {
+  QImage image(1, 1, QImage::Format_ARGB32);
+  image.setPixel(0, 0, qRgba(10, 20, 30, 128));
+
+  const auto recolored = recolorImage(image, QColor(200, 100, 50));
+
+  const auto pixel = reinterpret_cast<const QRgb*>(recolored.constScanLine(0));
+  EXPECT_EQ(qPremultiply(qRgba(200, 100, 50, 128)), pixel[0]);
+}
+
+TEST(recolorImage, shouldIgnoreTheColorsAlphaValue) {
+  QImage image(1, 1, QImage::Format_ARGB32);
+  image.setPixel(0, 0, qRgba(10, 20, 30, 255));
+
+  const auto recolored = recolorImage(image, QColor(200, 100, 50, 0));
+
+  EXPECT_EQ(QColor(200, 100, 50, 255), recolored.pixelColor(0, 0));
+}
+}
+}
+
+#endif
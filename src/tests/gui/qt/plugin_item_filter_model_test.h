@@ -0,0 +1,186 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_PLUGIN_ITEM_FILTER_MODEL_TEST
+#define LOOT_TESTS_GUI_QT_PLUGIN_ITEM_FILTER_MODEL_TEST
+
+#include <gtest/gtest.h>
+
+#include <QtCore/QRegularExpression>
+
+#include "gui/qt/plugin_item_filter_model.h"
+#include "gui/qt/plugin_item_model.h"
+
+namespace loot {
+namespace test {
+class PluginItemFilterModelTest : public ::testing::Test {
+protected:
+  PluginItemFilterModelTest() : model_(nullptr) {
+    PluginItem blankEsm;
+    blankEsm.name = "Blank.esm";
+    blankEsm.version = "1.0";
+
+    PluginItem blankEsp;
+    blankEsp.name = "Blank.esp";
+    blankEsp.version = "1.0";
+
+    PluginItem other;
+    other.name = "Other.esp";
+
+    model_.setPluginItems({blankEsm, blankEsp, other});
+    filterModel_.setSourceModel(&model_);
+  }
+
+  void setContentFilter(const ContentMatcher& matcher) {
+    PluginFiltersState filters;
+    filters.content = matcher;
+
+    filterModel_.setFiltersState(std::move(filters));
+  }
+
+  // The general information row is never filtered out.
+  int getPluginRowCount() const { return filterModel_.rowCount() - 1; }
+
+  static void exhaustTimeBudget(const ContentMatcher& matcher) {
+    while (!matcher.hasExceededTimeBudget()) {
+      matcher.matches(QString("Blank.esp"));
+    }
+  }
+
+  PluginItemModel model_;
+  PluginItemFilterModel filterModel_;
+};
+
+TEST_F(PluginItemFilterModelTest, contentFilterShouldHideRowsThatDoNotMatch) {
+  setContentFilter(ContentMatcher(QString("blank")));
+
+  EXPECT_EQ(2, getPluginRowCount());
+}
+
+TEST_F(PluginItemFilterModelTest, contentFilterShouldNotMatchAcrossFields) {
+  setContentFilter(ContentMatcher(QRegularExpression("esp\\s1\\.0")));
+
+  EXPECT_EQ(0, getPluginRowCount());
+}
+
+TEST_F(PluginItemFilterModelTest,
+       setFiltersStateShouldGiveTheContentFilterANewTimeBudget) {
+  const auto matcher = ContentMatcher(QRegularExpression("Blank"),
+                                      std::chrono::milliseconds(1));
+  setContentFilter(matcher);
+
+  ASSERT_EQ(2, getPluginRowCount());
+
+  // Simulate a first pass that used up the whole budget.
+  exhaustTimeBudget(matcher);
+  setContentFilter(matcher);
+
+  EXPECT_EQ(2, getPluginRowCount());
+  EXPECT_FALSE(filterModel_.hasContentFilterTimedOut());
+}
+
+TEST_F(PluginItemFilterModelTest,
+       sourceDataChangesShouldGiveTheContentFilterANewTimeBudget) {
+  const auto matcher = ContentMatcher(QRegularExpression("Blank"),
+                                      std::chrono::milliseconds(1));
+  setContentFilter(matcher);
+
+  ASSERT_EQ(2, getPluginRowCount());
+
+  exhaustTimeBudget(matcher);
+
+  const auto index = model_.index(2, 0);
+  const auto item = index.data(RawDataRole);
+  ASSERT_TRUE(model_.setData(index, item, RawDataRole));
+
+  EXPECT_EQ(2, getPluginRowCount());
+  EXPECT_FALSE(filterModel_.hasContentFilterTimedOut());
+}
+
+TEST_F(PluginItemFilterModelTest,
+       flagFiltersShouldBeReevaluatedForRowsWhoseDataHasChanged) {
+  PluginFiltersState filters;
+  filters.hideInactivePlugins = true;
+  filterModel_.setFiltersState(std::move(filters));
+
+  ASSERT_EQ(0, getPluginRowCount());
+
+  const auto index = model_.index(2, 0);
+  auto item = index.data(RawDataRole).value<PluginItem>();
+  item.isActive = true;
+  ASSERT_TRUE(model_.setData(index, QVariant::fromValue(item), RawDataRole));
+
+  EXPECT_EQ(1, getPluginRowCount());
+  EXPECT_EQ(1, model_.getPluginTable()->getFlags(PluginFlag::active).count());
+}
+
+TEST_F(PluginItemFilterModelTest,
+       groupFilterShouldBeReevaluatedForRowsWhoseDataHasChanged) {
+  PluginFiltersState filters;
+  filters.groupName = "late";
+  filterModel_.setFiltersState(std::move(filters));
+
+  ASSERT_EQ(0, getPluginRowCount());
+
+  auto items = model_.getPluginItems();
+  items.at(1).group = "late";
+  model_.applyPluginItems(std::move(items));
+
+  EXPECT_EQ(1, getPluginRowCount());
+}
+
+TEST_F(PluginItemFilterModelTest,
+       overlapFilterShouldHideRowsForPluginsThatDoNotOverlap) {
+  PluginFiltersState filters;
+  filters.overlapPluginName = "Blank.esm";
+  filterModel_.setFiltersState(std::move(filters),
+                               {"Blank.esm", "Other.esp"});
+
+  EXPECT_EQ(2, getPluginRowCount());
+}
+
+TEST_F(PluginItemFilterModelTest,
+       sourceRowInsertionsShouldGiveTheContentFilterANewTimeBudget) {
+  const auto matcher = ContentMatcher(QRegularExpression("Blank"),
+                                      std::chrono::milliseconds(1));
+  setContentFilter(matcher);
+
+  ASSERT_EQ(2, getPluginRowCount());
+
+  exhaustTimeBudget(matcher);
+
+  auto items = model_.getPluginItems();
+  PluginItem blankMasterDependent;
+  blankMasterDependent.name = "Blank - Master Dependent.esp";
+  items.push_back(blankMasterDependent);
+  model_.applyPluginItems(std::move(items));
+
+  EXPECT_EQ(3, getPluginRowCount());
+  EXPECT_FALSE(filterModel_.hasContentFilterTimedOut());
+}
+}
+}
+
+#endif
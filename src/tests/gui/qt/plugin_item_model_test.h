@@ -0,0 +1,375 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_PLUGIN_ITEM_MODEL_TEST
+#define LOOT_TESTS_GUI_QT_PLUGIN_ITEM_MODEL_TEST
+
+#include <gtest/gtest.h>
+
+#include <QtTest/QSignalSpy>
+
+#include "gui/qt/plugin_item_model.h"
+
+namespace loot {
+namespace test {
+TEST(FindLongestIncreasingSubsequence, shouldReturnAnEmptyVectorForNoValues) {
+  EXPECT_TRUE(FindLongestIncreasingSubsequence({}).empty());
+}
+
+TEST(FindLongestIncreasingSubsequence,
+     shouldMarkAllValuesIfTheyAreAlreadyIncreasing) {
+  const auto result = FindLongestIncreasingSubsequence({0, 1, 4, 7});
+
+  EXPECT_EQ(std::vector<bool>({true, true, true, true}), result);
+}
+
+TEST(FindLongestIncreasingSubsequence,
+     shouldMarkOnlyOneValueIfTheValuesAreDecreasing) {
+  const auto result = FindLongestIncreasingSubsequence({3, 2, 1, 0});
+
+  EXPECT_EQ(1, std::count(result.begin(), result.end(), true));
+}
+
+TEST(FindLongestIncreasingSubsequence,
+     shouldNotMarkAValueThatHasBeenMovedToTheStart) {
+  const auto result = FindLongestIncreasingSubsequence({1, 2, 3, 0});
+
+  EXPECT_EQ(std::vector<bool>({true, true, true, false}), result);
+}
+
+TEST(FindLongestIncreasingSubsequence,
+     shouldNotMarkAValueThatHasBeenMovedToTheEnd) {
+  const auto result = FindLongestIncreasingSubsequence({3, 0, 1, 2});
+
+  EXPECT_EQ(std::vector<bool>({false, true, true, true}), result);
+}
+
+TEST(FindLongestIncreasingSubsequence,
+     shouldMarkAStrictlyIncreasingSubsequenceOfTheLongestLength) {
+  const std::vector<size_t> values{3, 1, 4, 0, 5, 2, 6};
+  const auto result = FindLongestIncreasingSubsequence(values);
+
+  std::optional<size_t> previousValue;
+  size_t length = 0;
+  for (size_t i = 0; i < values.size(); i += 1) {
+    if (result.at(i)) {
+      if (previousValue.has_value()) {
+        EXPECT_LT(previousValue.value(), values.at(i));
+      }
+      previousValue = values.at(i);
+      length += 1;
+    }
+  }
+
+  EXPECT_EQ(4, length);
+}
+
+class PluginItemModelTest : public ::testing::Test {
+protected:
+  PluginItemModelTest() :
+      model_(nullptr),
+      rowsInsertedSpy_(&model_, &PluginItemModel::rowsInserted),
+      rowsRemovedSpy_(&model_, &PluginItemModel::rowsRemoved),
+      rowsMovedSpy_(&model_, &PluginItemModel::rowsMoved),
+      layoutChangedSpy_(&model_, &PluginItemModel::layoutChanged),
+      dataChangedSpy_(&model_, &PluginItemModel::dataChanged) {}
+
+  static std::vector<PluginItem> createItems(
+      const std::vector<std::string>& names) {
+    std::vector<PluginItem> items;
+    for (const auto& name : names) {
+      PluginItem item;
+      item.name = name;
+      items.push_back(item);
+    }
+
+    return items;
+  }
+
+  void setNames(const std::vector<std::string>& names) {
+    model_.setPluginItems(createItems(names));
+
+    clearSpies();
+  }
+
+  void applyNames(const std::vector<std::string>& names) {
+    model_.applyPluginItems(createItems(names));
+  }
+
+  void clearSpies() {
+    rowsInsertedSpy_.clear();
+    rowsRemovedSpy_.clear();
+    rowsMovedSpy_.clear();
+    layoutChangedSpy_.clear();
+    dataChangedSpy_.clear();
+  }
+
+  // The search index must be kept in the same order as the items.
+  void expectSearchIndexToMatchItems() {
+    const auto& items = model_.getPluginItems();
+    for (size_t i = 0; i < items.size(); i += 1) {
+      const auto index =
+          model_.index(static_cast<int>(i) + 1, PluginItemModel::CARDS_COLUMN);
+      const auto fields = index.data(ContentSearchRole).toStringList();
+
+      ASSERT_FALSE(fields.isEmpty());
+      EXPECT_EQ(QString::fromStdString(items.at(i).name), fields.at(0));
+    }
+  }
+
+  static std::vector<std::string> createNames(size_t count) {
+    std::vector<std::string> names;
+    for (size_t i = 0; i < count; i += 1) {
+      names.push_back("Plugin" + std::to_string(i) + ".esp");
+    }
+
+    return names;
+  }
+
+  PluginItemModel model_;
+  QSignalSpy rowsInsertedSpy_;
+  QSignalSpy rowsRemovedSpy_;
+  QSignalSpy rowsMovedSpy_;
+  QSignalSpy layoutChangedSpy_;
+  QSignalSpy dataChangedSpy_;
+};
+
+TEST_F(PluginItemModelTest,
+       applyPluginItemsShouldNotEmitAnySignalsIfTheItemsAreUnchanged) {
+  setNames({"A.esp", "B.esp", "C.esp"});
+
+  applyNames({"A.esp", "B.esp", "C.esp"});
+
+  EXPECT_EQ(0, rowsInsertedSpy_.count());
+  EXPECT_EQ(0, rowsRemovedSpy_.count());
+  EXPECT_EQ(0, rowsMovedSpy_.count());
+  EXPECT_EQ(0, layoutChangedSpy_.count());
+  EXPECT_EQ(0, dataChangedSpy_.count());
+}
+
+TEST_F(PluginItemModelTest,
+       applyPluginItemsShouldRemoveEachRunOfContiguousRowsTogether) {
+  setNames({"A.esp", "B.esp", "C.esp", "D.esp", "E.esp"});
+
+  applyNames({"A.esp", "D.esp"});
+
+  ASSERT_EQ(2, rowsRemovedSpy_.count());
+  // Runs are removed from the last to the first.
+  EXPECT_EQ(5, rowsRemovedSpy_.at(0).at(1).toInt());
+  EXPECT_EQ(5, rowsRemovedSpy_.at(0).at(2).toInt());
+  EXPECT_EQ(2, rowsRemovedSpy_.at(1).at(1).toInt());
+  EXPECT_EQ(3, rowsRemovedSpy_.at(1).at(2).toInt());
+
+  EXPECT_EQ(0, rowsInsertedSpy_.count());
+  EXPECT_EQ(0, rowsMovedSpy_.count());
+  EXPECT_EQ(std::vector<std::string>({"A.esp", "D.esp"}),
+            model_.getPluginNames());
+  expectSearchIndexToMatchItems();
+}
+
+TEST_F(PluginItemModelTest,
+       applyPluginItemsShouldInsertEachRunOfContiguousRowsTogether) {
+  setNames({"A.esp", "D.esp"});
+
+  applyNames({"A.esp", "B.esp", "C.esp", "D.esp", "E.esp"});
+
+  ASSERT_EQ(2, rowsInsertedSpy_.count());
+  EXPECT_EQ(2, rowsInsertedSpy_.at(0).at(1).toInt());
+  EXPECT_EQ(3, rowsInsertedSpy_.at(0).at(2).toInt());
+  EXPECT_EQ(5, rowsInsertedSpy_.at(1).at(1).toInt());
+  EXPECT_EQ(5, rowsInsertedSpy_.at(1).at(2).toInt());
+
+  EXPECT_EQ(0, rowsRemovedSpy_.count());
+  EXPECT_EQ(0, rowsMovedSpy_.count());
+  EXPECT_EQ(
+      std::vector<std::string>({"A.esp", "B.esp", "C.esp", "D.esp", "E.esp"}),
+      model_.getPluginNames());
+  expectSearchIndexToMatchItems();
+}
+
+TEST_F(PluginItemModelTest,
+       applyPluginItemsShouldMoveOnlyTheRowsThatAreOutOfOrder) {
+  setNames({"A.esp", "B.esp", "C.esp", "D.esp"});
+
+  applyNames({"B.esp", "C.esp", "D.esp", "A.esp"});
+
+  ASSERT_EQ(1, rowsMovedSpy_.count());
+  const auto& arguments = rowsMovedSpy_.at(0);
+  EXPECT_EQ(1, arguments.at(1).toInt());
+  EXPECT_EQ(1, arguments.at(2).toInt());
+  // The destination is counted before the move.
+  EXPECT_EQ(5, arguments.at(4).toInt());
+
+  EXPECT_EQ(0, layoutChangedSpy_.count());
+  EXPECT_EQ(0, dataChangedSpy_.count());
+  EXPECT_EQ(std::vector<std::string>({"B.esp", "C.esp", "D.esp", "A.esp"}),
+            model_.getPluginNames());
+  expectSearchIndexToMatchItems();
+}
+
+TEST_F(PluginItemModelTest, applyPluginItemsShouldMoveARowUpToItsNewPosition) {
+  setNames({"A.esp", "B.esp", "C.esp", "D.esp"});
+
+  applyNames({"A.esp", "D.esp", "B.esp", "C.esp"});
+
+  ASSERT_EQ(1, rowsMovedSpy_.count());
+  const auto& arguments = rowsMovedSpy_.at(0);
+  EXPECT_EQ(4, arguments.at(1).toInt());
+  EXPECT_EQ(4, arguments.at(2).toInt());
+  EXPECT_EQ(2, arguments.at(4).toInt());
+
+  EXPECT_EQ(std::vector<std::string>({"A.esp", "D.esp", "B.esp", "C.esp"}),
+            model_.getPluginNames());
+  expectSearchIndexToMatchItems();
+}
+
+TEST_F(PluginItemModelTest,
+       applyPluginItemsShouldRemoveMoveAndInsertRowsInOneCall) {
+  setNames({"A.esp", "B.esp", "C.esp", "D.esp", "E.esp"});
+
+  applyNames({"E.esp", "F.esp", "A.esp", "C.esp"});
+
+  EXPECT_EQ(2, rowsRemovedSpy_.count());
+  EXPECT_EQ(1, rowsInsertedSpy_.count());
+  EXPECT_EQ(1, rowsMovedSpy_.count());
+  EXPECT_EQ(std::vector<std::string>({"E.esp", "F.esp", "A.esp", "C.esp"}),
+            model_.getPluginNames());
+  expectSearchIndexToMatchItems();
+}
+
+TEST_F(PluginItemModelTest,
+       applyPluginItemsShouldEmitDataChangedForARunOfChangedRows) {
+  setNames({"A.esp", "B.esp", "C.esp", "D.esp"});
+
+  auto items = createItems({"A.esp", "B.esp", "C.esp", "D.esp"});
+  items.at(1).version = "1.0";
+  items.at(2).version = "2.0";
+  model_.applyPluginItems(std::move(items));
+
+  ASSERT_EQ(1, dataChangedSpy_.count());
+  const auto topLeft = dataChangedSpy_.at(0).at(0).value<QModelIndex>();
+  const auto bottomRight = dataChangedSpy_.at(0).at(1).value<QModelIndex>();
+  EXPECT_EQ(2, topLeft.row());
+  EXPECT_EQ(3, bottomRight.row());
+
+  EXPECT_EQ("1.0", model_.getPluginItems().at(1).version);
+  EXPECT_EQ("2.0", model_.getPluginItems().at(2).version);
+}
+
+TEST_F(PluginItemModelTest,
+       applyPluginItemsShouldEmitDataChangedForEachRunOfChangedRows) {
+  const auto names = createNames(10);
+  setNames(names);
+
+  auto items = createItems(names);
+  items.at(1).version = "1.0";
+  items.at(2).version = "1.0";
+  items.at(8).version = "1.0";
+  model_.applyPluginItems(std::move(items));
+
+  ASSERT_EQ(2, dataChangedSpy_.count());
+
+  auto topLeft = dataChangedSpy_.at(0).at(0).value<QModelIndex>();
+  auto bottomRight = dataChangedSpy_.at(0).at(1).value<QModelIndex>();
+  EXPECT_EQ(2, topLeft.row());
+  EXPECT_EQ(3, bottomRight.row());
+
+  topLeft = dataChangedSpy_.at(1).at(0).value<QModelIndex>();
+  bottomRight = dataChangedSpy_.at(1).at(1).value<QModelIndex>();
+  EXPECT_EQ(9, topLeft.row());
+  EXPECT_EQ(9, bottomRight.row());
+}
+
+TEST_F(PluginItemModelTest,
+       applyPluginItemsShouldChangeTheLayoutIfTooManyRowsWouldBeMoved) {
+  const auto names = createNames(100);
+  setNames(names);
+
+  const QPersistentModelIndex generalInfoIndex =
+      model_.index(0, PluginItemModel::CARDS_COLUMN);
+  const QPersistentModelIndex firstPluginIndex =
+      model_.index(1, PluginItemModel::CARDS_COLUMN);
+
+  const std::vector<std::string> reversedNames(names.rbegin(), names.rend());
+  applyNames(reversedNames);
+
+  EXPECT_EQ(0, rowsMovedSpy_.count());
+  EXPECT_EQ(1, layoutChangedSpy_.count());
+  EXPECT_EQ(reversedNames, model_.getPluginNames());
+  expectSearchIndexToMatchItems();
+
+  EXPECT_EQ(0, generalInfoIndex.row());
+  EXPECT_EQ(100, firstPluginIndex.row());
+  EXPECT_EQ(PluginItemModel::CARDS_COLUMN, firstPluginIndex.column());
+}
+
+TEST_F(PluginItemModelTest,
+       applyPluginItemsShouldMoveRowsIndividuallyIfFewEnoughAreMoved) {
+  const auto names = createNames(100);
+  setNames(names);
+
+  // Move the last 10 plugins to the start.
+  std::vector<std::string> newNames(names.end() - 10, names.end());
+  newNames.insert(newNames.end(), names.begin(), names.end() - 10);
+  applyNames(newNames);
+
+  EXPECT_EQ(10, rowsMovedSpy_.count());
+  EXPECT_EQ(0, layoutChangedSpy_.count());
+  EXPECT_EQ(newNames, model_.getPluginNames());
+  expectSearchIndexToMatchItems();
+}
+
+TEST_F(PluginItemModelTest,
+       updateSearchResultsShouldOnlyChangeTheSearchResultsOfTheSearchedRows) {
+  setNames(createNames(5000));
+
+  model_.setSearchResults({1, 2, 3});
+  clearSpies();
+
+  model_.updateSearchResults({2, 4999}, {4999});
+
+  const auto isResult = [&](int row) {
+    return model_.index(row, PluginItemModel::CARDS_COLUMN)
+        .data(SearchResultRole)
+        .value<SearchResultData>()
+        .isResult;
+  };
+  EXPECT_TRUE(isResult(1));
+  EXPECT_FALSE(isResult(2));
+  EXPECT_TRUE(isResult(3));
+  EXPECT_TRUE(isResult(4999));
+  EXPECT_EQ(3, model_.countSearchResults());
+
+  // Only the rows whose search results changed are signalled.
+  ASSERT_EQ(2, dataChangedSpy_.count());
+  EXPECT_EQ(2, dataChangedSpy_.at(0).at(0).value<QModelIndex>().row());
+  EXPECT_EQ(2, dataChangedSpy_.at(0).at(1).value<QModelIndex>().row());
+  EXPECT_EQ(4999, dataChangedSpy_.at(1).at(0).value<QModelIndex>().row());
+  EXPECT_EQ(4999, dataChangedSpy_.at(1).at(1).value<QModelIndex>().row());
+}
+}
+}
+
+#endif
@@ -0,0 +1,314 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_PLUGIN_NAME_LIST_MODEL_TEST
+#define LOOT_TESTS_GUI_QT_PLUGIN_NAME_LIST_MODEL_TEST
+
+#include <gtest/gtest.h>
+
+#include <QtTest/QSignalSpy>
+
+#include "gui/qt/plugin_name_list_model.h"
+
+namespace loot {
+namespace test {
+class PluginNameListModelTest : public ::testing::Test {
+protected:
+  PluginNameListModelTest() :
+      model_(nullptr),
+      listModel_(nullptr, &model_),
+      rowsInsertedSpy_(&listModel_, &PluginNameListModel::rowsInserted),
+      rowsRemovedSpy_(&listModel_, &PluginNameListModel::rowsRemoved),
+      rowsMovedSpy_(&listModel_, &PluginNameListModel::rowsMoved),
+      layoutChangedSpy_(&listModel_, &PluginNameListModel::layoutChanged),
+      modelResetSpy_(&listModel_, &PluginNameListModel::modelReset),
+      dataChangedSpy_(&listModel_, &PluginNameListModel::dataChanged) {}
+
+  static PluginItem createItem(const std::string& name) {
+    PluginItem item;
+    item.name = name;
+    return item;
+  }
+
+  static std::vector<PluginItem> createItems(
+      const std::vector<std::string>& names) {
+    std::vector<PluginItem> items;
+    for (const auto& name : names) {
+      items.push_back(createItem(name));
+    }
+
+    return items;
+  }
+
+  static std::vector<std::string> createNames(size_t count) {
+    std::vector<std::string> names;
+    for (size_t i = 0; i < count; i += 1) {
+      names.push_back("Plugin" + std::to_string(i) + ".esp");
+    }
+
+    return names;
+  }
+
+  void setNames(const std::vector<std::string>& names) {
+    model_.setPluginItems(createItems(names));
+
+    clearSpies();
+  }
+
+  void applyNames(const std::vector<std::string>& names) {
+    model_.applyPluginItems(createItems(names));
+  }
+
+  void setSourceItem(int sourceRow, const PluginItem& item) {
+    model_.setData(model_.index(sourceRow, PluginItemModel::CARDS_COLUMN),
+                   QVariant::fromValue(item),
+                   RawDataRole);
+  }
+
+  void clearSpies() {
+    rowsInsertedSpy_.clear();
+    rowsRemovedSpy_.clear();
+    rowsMovedSpy_.clear();
+    layoutChangedSpy_.clear();
+    modelResetSpy_.clear();
+    dataChangedSpy_.clear();
+  }
+
+  std::vector<std::string> getListNames() const {
+    std::vector<std::string> names;
+    for (int row = 0; row < listModel_.rowCount(); row += 1) {
+      names.push_back(
+          listModel_.index(row).data(Qt::DisplayRole).toString().toStdString());
+    }
+
+    return names;
+  }
+
+  static std::pair<int, int> getRange(const QList<QVariant>& arguments) {
+    return std::make_pair(arguments.at(1).toInt(), arguments.at(2).toInt());
+  }
+
+  static std::pair<int, int> getDataChangedRange(
+      const QList<QVariant>& arguments) {
+    return std::make_pair(arguments.at(0).value<QModelIndex>().row(),
+                          arguments.at(1).value<QModelIndex>().row());
+  }
+
+  PluginItemModel model_;
+  PluginNameListModel listModel_;
+  QSignalSpy rowsInsertedSpy_;
+  QSignalSpy rowsRemovedSpy_;
+  QSignalSpy rowsMovedSpy_;
+  QSignalSpy layoutChangedSpy_;
+  QSignalSpy modelResetSpy_;
+  QSignalSpy dataChangedSpy_;
+};
+
+TEST_F(PluginNameListModelTest,
+       shouldListTheSourcePluginNamesWithoutTheGeneralInformationRow) {
+  model_.setPluginItems(createItems({"A.esp", "B.esp", "C.esp"}));
+
+  ASSERT_EQ(1, rowsInsertedSpy_.count());
+  EXPECT_EQ(std::make_pair(0, 2), getRange(rowsInsertedSpy_.at(0)));
+  EXPECT_EQ(0, modelResetSpy_.count());
+  EXPECT_EQ(3, listModel_.rowCount());
+  EXPECT_EQ(std::vector<std::string>({"A.esp", "B.esp", "C.esp"}),
+            getListNames());
+}
+
+TEST_F(PluginNameListModelTest,
+       setDataShouldEmitDataChangedForARowWhoseNameHasChanged) {
+  setNames({"A.esp", "B.esp", "C.esp"});
+
+  setSourceItem(2, createItem("D.esp"));
+
+  ASSERT_EQ(1, dataChangedSpy_.count());
+  EXPECT_EQ(std::make_pair(1, 1), getDataChangedRange(dataChangedSpy_.at(0)));
+  EXPECT_EQ(std::vector<std::string>({"A.esp", "D.esp", "C.esp"}),
+            getListNames());
+}
+
+TEST_F(PluginNameListModelTest,
+       setDataShouldNotEmitDataChangedIfTheNameHasNotChanged) {
+  setNames({"A.esp", "B.esp", "C.esp"});
+
+  auto item = createItem("B.esp");
+  item.version = "1.0";
+  setSourceItem(2, item);
+
+  EXPECT_EQ(0, dataChangedSpy_.count());
+}
+
+TEST_F(PluginNameListModelTest,
+       shouldIgnoreDataChangesForRolesOtherThanTheRawData) {
+  setNames({"A.esp", "B.esp"});
+
+  model_.blockSignals(true);
+  setSourceItem(1, createItem("C.esp"));
+  model_.blockSignals(false);
+
+  emit model_.dataChanged(model_.index(1, 0),
+                          model_.index(2, 0),
+                          {SearchResultRole});
+
+  EXPECT_EQ(0, dataChangedSpy_.count());
+  EXPECT_EQ(std::vector<std::string>({"A.esp", "B.esp"}), getListNames());
+}
+
+TEST_F(PluginNameListModelTest,
+       shouldSplitASourceDataChangeIntoRunsOfRowsWithChangedNames) {
+  setNames({"A.esp", "B.esp", "C.esp", "D.esp", "E.esp"});
+
+  // Change several rows' names and then report them as one change, like
+  // applying plugin items does.
+  model_.blockSignals(true);
+  setSourceItem(1, createItem("F.esp"));
+  setSourceItem(2, createItem("G.esp"));
+  setSourceItem(4, createItem("H.esp"));
+  model_.blockSignals(false);
+
+  emit model_.dataChanged(
+      model_.index(0, 0), model_.index(5, 0), {RawDataRole});
+
+  ASSERT_EQ(2, dataChangedSpy_.count());
+  EXPECT_EQ(std::make_pair(0, 1), getDataChangedRange(dataChangedSpy_.at(0)));
+  EXPECT_EQ(std::make_pair(3, 3), getDataChangedRange(dataChangedSpy_.at(1)));
+  EXPECT_EQ(
+      std::vector<std::string>({"F.esp", "G.esp", "C.esp", "H.esp", "E.esp"}),
+      getListNames());
+}
+
+TEST_F(PluginNameListModelTest,
+       shouldEmitADataChangeRunThatEndsAtTheLastSourceRow) {
+  setNames({"A.esp", "B.esp", "C.esp"});
+
+  model_.blockSignals(true);
+  setSourceItem(3, createItem("D.esp"));
+  model_.blockSignals(false);
+
+  emit model_.dataChanged(
+      model_.index(1, 0), model_.index(3, 0), {RawDataRole});
+
+  ASSERT_EQ(1, dataChangedSpy_.count());
+  EXPECT_EQ(std::make_pair(2, 2), getDataChangedRange(dataChangedSpy_.at(0)));
+}
+
+TEST_F(PluginNameListModelTest, shouldInsertEachRunOfInsertedSourceRows) {
+  setNames({"A.esp", "D.esp"});
+
+  applyNames({"A.esp", "B.esp", "C.esp", "D.esp", "E.esp"});
+
+  ASSERT_EQ(2, rowsInsertedSpy_.count());
+  EXPECT_EQ(std::make_pair(1, 2), getRange(rowsInsertedSpy_.at(0)));
+  EXPECT_EQ(std::make_pair(4, 4), getRange(rowsInsertedSpy_.at(1)));
+  EXPECT_EQ(
+      std::vector<std::string>({"A.esp", "B.esp", "C.esp", "D.esp", "E.esp"}),
+      getListNames());
+}
+
+TEST_F(PluginNameListModelTest, shouldRemoveEachRunOfRemovedSourceRows) {
+  setNames({"A.esp", "B.esp", "C.esp", "D.esp", "E.esp"});
+
+  applyNames({"A.esp", "D.esp"});
+
+  ASSERT_EQ(2, rowsRemovedSpy_.count());
+  EXPECT_EQ(std::make_pair(4, 4), getRange(rowsRemovedSpy_.at(0)));
+  EXPECT_EQ(std::make_pair(1, 2), getRange(rowsRemovedSpy_.at(1)));
+  EXPECT_EQ(std::vector<std::string>({"A.esp", "D.esp"}), getListNames());
+}
+
+TEST_F(PluginNameListModelTest, shouldMoveARowDownToItsNewPosition) {
+  setNames({"A.esp", "B.esp", "C.esp", "D.esp"});
+  const QPersistentModelIndex movedIndex = listModel_.index(0);
+  const QPersistentModelIndex otherIndex = listModel_.index(1);
+
+  applyNames({"B.esp", "C.esp", "D.esp", "A.esp"});
+
+  ASSERT_EQ(1, rowsMovedSpy_.count());
+  const auto& arguments = rowsMovedSpy_.at(0);
+  EXPECT_EQ(std::make_pair(0, 0), getRange(arguments));
+  // The destination is counted before the move.
+  EXPECT_EQ(4, arguments.at(4).toInt());
+
+  EXPECT_EQ(std::vector<std::string>({"B.esp", "C.esp", "D.esp", "A.esp"}),
+            getListNames());
+  EXPECT_EQ(3, movedIndex.row());
+  EXPECT_EQ(0, otherIndex.row());
+}
+
+TEST_F(PluginNameListModelTest, shouldMoveARowUpToItsNewPosition) {
+  setNames({"A.esp", "B.esp", "C.esp", "D.esp"});
+  const QPersistentModelIndex movedIndex = listModel_.index(3);
+
+  applyNames({"A.esp", "D.esp", "B.esp", "C.esp"});
+
+  ASSERT_EQ(1, rowsMovedSpy_.count());
+  const auto& arguments = rowsMovedSpy_.at(0);
+  EXPECT_EQ(std::make_pair(3, 3), getRange(arguments));
+  EXPECT_EQ(1, arguments.at(4).toInt());
+
+  EXPECT_EQ(std::vector<std::string>({"A.esp", "D.esp", "B.esp", "C.esp"}),
+            getListNames());
+  EXPECT_EQ(1, movedIndex.row());
+}
+
+TEST_F(PluginNameListModelTest,
+       shouldFollowSourceRowsThatAreRemovedMovedAndInsertedInOneCall) {
+  setNames({"A.esp", "B.esp", "C.esp", "D.esp", "E.esp"});
+
+  applyNames({"E.esp", "F.esp", "A.esp", "C.esp"});
+
+  EXPECT_EQ(2, rowsRemovedSpy_.count());
+  EXPECT_EQ(1, rowsInsertedSpy_.count());
+  EXPECT_EQ(1, rowsMovedSpy_.count());
+  EXPECT_EQ(0, modelResetSpy_.count());
+  EXPECT_EQ(std::vector<std::string>({"E.esp", "F.esp", "A.esp", "C.esp"}),
+            getListNames());
+}
+
+TEST_F(PluginNameListModelTest,
+       shouldRemapPersistentIndexesByNameWhenTheSourceLayoutChanges) {
+  const auto names = createNames(100);
+  setNames(names);
+
+  const QPersistentModelIndex firstIndex = listModel_.index(0);
+  const QPersistentModelIndex middleIndex = listModel_.index(40);
+
+  const std::vector<std::string> reversedNames(names.rbegin(), names.rend());
+  applyNames(reversedNames);
+
+  EXPECT_EQ(0, rowsMovedSpy_.count());
+  EXPECT_EQ(1, layoutChangedSpy_.count());
+  EXPECT_EQ(reversedNames, getListNames());
+
+  EXPECT_EQ(99, firstIndex.row());
+  EXPECT_EQ("Plugin0.esp", firstIndex.data().toString());
+  EXPECT_EQ(59, middleIndex.row());
+  EXPECT_EQ("Plugin40.esp", middleIndex.data().toString());
+}
+}
+}
+
+#endif
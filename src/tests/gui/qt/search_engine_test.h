@@ -0,0 +1,145 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_SEARCH_ENGINE_TEST
+#define LOOT_TESTS_GUI_QT_SEARCH_ENGINE_TEST
+
+#include <gtest/gtest.h>
+
+#include <QtCore/QRegularExpression>
+#include <QtTest/QSignalSpy>
+
+#include "gui/qt/search_engine.h"
+
+namespace loot {
+namespace test {
+class FindSearchMatchesTest : public ::testing::Test {
+protected:
+  FindSearchMatchesTest() :
+      index_({{1, {"Blank.esm"}}, {2, {"Blank.esp"}}, {4, {"Other.esp"}}}) {}
+
+  static bool notCancelled() { return false; }
+
+  SearchIndex index_;
+};
+
+TEST_F(FindSearchMatchesTest, shouldReturnRowsContainingTextCaseInsensitively) {
+  const auto matcher = ContentMatcher(QString("blank"));
+  const auto rows = findSearchMatches(matcher, index_, &notCancelled);
+
+  EXPECT_EQ(std::vector<int>({1, 2}), rows);
+}
+
+TEST_F(FindSearchMatchesTest, shouldReturnRowsMatchingARegex) {
+  const auto matcher = ContentMatcher(QRegularExpression(
+      "\\.ESP$", QRegularExpression::CaseInsensitiveOption));
+  const auto rows = findSearchMatches(matcher, index_, &notCancelled);
+
+  EXPECT_EQ(std::vector<int>({2, 4}), rows);
+}
+
+TEST_F(FindSearchMatchesTest, shouldReturnNoRowsForEmptyOrInvalidSearchText) {
+  const auto emptyMatcher = ContentMatcher(QString());
+  const auto invalidMatcher = ContentMatcher(QRegularExpression("("));
+
+  EXPECT_TRUE(findSearchMatches(emptyMatcher, index_, &notCancelled).empty());
+  EXPECT_TRUE(
+      findSearchMatches(invalidMatcher, index_, &notCancelled).empty());
+}
+
+TEST_F(FindSearchMatchesTest, shouldReturnNoRowsIfCancelled) {
+  const auto matcher = ContentMatcher(QString("blank"));
+  const auto rows = findSearchMatches(matcher, index_, []() { return true; });
+
+  EXPECT_TRUE(rows.empty());
+}
+
+TEST_F(FindSearchMatchesTest, shouldStopIfTheMatcherExceedsItsTimeBudget) {
+  const auto matcher = ContentMatcher(QRegularExpression("Blank"),
+                                      std::chrono::nanoseconds(0));
+  const auto rows = findSearchMatches(matcher, index_, &notCancelled);
+
+  EXPECT_TRUE(rows.empty());
+  EXPECT_TRUE(matcher.hasExceededTimeBudget());
+}
+
+class SearchEngineTest : public ::testing::Test {
+protected:
+  SearchEngineTest() : engine_(nullptr) {}
+
+  SearchIndex getIndex() const {
+    return {{1, {"Blank.esm"}}, {2, {"Blank.esp"}}};
+  }
+
+  SearchEngine engine_;
+};
+
+TEST_F(SearchEngineTest, searchShouldEmitFinishedWithTheMatchingRows) {
+  auto finishedSpy = QSignalSpy(&engine_, &SearchEngine::finished);
+
+  engine_.search(ContentMatcher(QString("esp")), getIndex());
+
+  ASSERT_TRUE(finishedSpy.wait());
+  EXPECT_EQ(std::vector<int>({2}),
+            finishedSpy.takeFirst().at(0).value<std::vector<int>>());
+}
+
+TEST_F(SearchEngineTest, searchShouldOnlyEmitFinishedForTheLatestSearch) {
+  auto finishedSpy = QSignalSpy(&engine_, &SearchEngine::finished);
+
+  engine_.search(ContentMatcher(QString("esm")), getIndex());
+  engine_.search(ContentMatcher(QString("esp")), getIndex());
+
+  ASSERT_TRUE(finishedSpy.wait());
+  EXPECT_FALSE(finishedSpy.wait(100));
+  ASSERT_EQ(1, finishedSpy.count());
+  EXPECT_EQ(std::vector<int>({2}),
+            finishedSpy.takeFirst().at(0).value<std::vector<int>>());
+}
+
+TEST_F(SearchEngineTest, searchShouldEmitTimedOutIfTheTimeBudgetIsExceeded) {
+  auto timedOutSpy = QSignalSpy(&engine_, &SearchEngine::timedOut);
+  auto finishedSpy = QSignalSpy(&engine_, &SearchEngine::finished);
+
+  engine_.search(
+      ContentMatcher(QRegularExpression("esp"), std::chrono::nanoseconds(0)),
+      getIndex());
+
+  ASSERT_TRUE(finishedSpy.wait());
+  EXPECT_EQ(1, timedOutSpy.count());
+}
+
+TEST_F(SearchEngineTest, cancelShouldDiscardTheResultsOfAPendingSearch) {
+  auto finishedSpy = QSignalSpy(&engine_, &SearchEngine::finished);
+
+  engine_.search(ContentMatcher(QString("esp")), getIndex());
+  engine_.cancel();
+
+  EXPECT_FALSE(finishedSpy.wait(100));
+}
+}
+}
+
+#endif
@@ -0,0 +1,282 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_SESSION_SNAPSHOT_TEST
+#define LOOT_TESTS_GUI_QT_SESSION_SNAPSHOT_TEST
+
+#include <gtest/gtest.h>
+
+#include "gui/qt/session_snapshot.h"
+#include "tests/gui/test_helpers.h"
+
+namespace loot {
+namespace test {
+class SessionSnapshotTest : public ::testing::Test {
+protected:
+  SessionSnapshotTest() :
+      rootPath_(getTempPath()), filePath_(rootPath_ / "snapshot.bin") {}
+
+  void SetUp() override { std::filesystem::create_directories(rootPath_); }
+
+  void TearDown() override { std::filesystem::remove_all(rootPath_); }
+
+  SessionSnapshot createSnapshot() {
+    SessionSnapshot snapshot;
+    snapshot.masterlistFingerprint = masterlistFingerprint_;
+    snapshot.loadOrderFileFingerprints = loadOrderFileFingerprints_;
+    snapshot.generalInformation.gameSupportsLightPlugins = true;
+    snapshot.generalInformation.masterlistRevision =
+        FileRevisionSummary("abcdef0", "2024-01-01");
+    snapshot.generalInformation.preludeRevision =
+        FileRevisionSummary("1234567", "2024-01-02");
+    snapshot.generalInformation.generalMessages = {
+        SourcedMessage{MessageType::warn,
+                       MessageSource::activePluginsCountCheck,
+                       "general"}};
+
+    PluginItem first;
+    first.name = "Blank.esm";
+    first.loadOrderIndex = 0;
+    first.crc = 0xDEADBEEF;
+    first.version = "1.0";
+    first.group = "early";
+    first.isActive = true;
+    first.isMaster = true;
+    first.isCreationClubPlugin = true;
+    first.currentTags = {"Relev"};
+    first.addTags = {"Delev", "Names"};
+    first.removeTags = {"Stats"};
+    first.messages = {SourcedMessage{
+        MessageType::error, MessageSource::missingMaster, "message"}};
+    first.locations = {Location("https://example.com", "Example")};
+
+    PluginItem second;
+    second.name = "Blank.esp";
+    second.cleaningUtility = "xEdit";
+    second.isDirty = true;
+    second.loadsArchive = true;
+
+    snapshot.plugins = {first, second};
+
+    return snapshot;
+  }
+
+  const std::filesystem::path rootPath_;
+  const std::filesystem::path filePath_;
+  const FileFingerprint masterlistFingerprint_{
+      12345,
+      std::filesystem::file_time_type(
+          std::filesystem::file_time_type::duration(67890))};
+  const FileFingerprints loadOrderFileFingerprints_{
+      {rootPath_ / "plugins.txt",
+       FileFingerprint{
+           100,
+           std::filesystem::file_time_type(
+               std::filesystem::file_time_type::duration(200))}},
+      {rootPath_ / "loadorder.txt", std::nullopt}};
+};
+
+TEST_F(SessionSnapshotTest,
+       calculatePluginNamesChecksumShouldDependOnPluginNamesAndOrder) {
+  PluginItem first;
+  first.name = "a.esp";
+  PluginItem second;
+  second.name = "b.esp";
+  PluginItem joined;
+  joined.name = "a.espb.esp";
+
+  const auto checksum = CalculatePluginNamesChecksum({first, second});
+
+  EXPECT_EQ(checksum, CalculatePluginNamesChecksum({first, second}));
+  EXPECT_NE(checksum, CalculatePluginNamesChecksum({second, first}));
+  EXPECT_NE(checksum, CalculatePluginNamesChecksum({joined}));
+}
+
+TEST_F(SessionSnapshotTest, loadShouldReturnNulloptIfFileDoesNotExist) {
+  const auto snapshot = LoadSessionSnapshot(
+      filePath_, masterlistFingerprint_, loadOrderFileFingerprints_);
+
+  EXPECT_FALSE(snapshot.has_value());
+}
+
+TEST_F(SessionSnapshotTest, loadShouldThrowIfFileIsTooShort) {
+  touch(filePath_);
+
+  EXPECT_THROW(LoadSessionSnapshot(filePath_,
+                                   masterlistFingerprint_,
+                                   loadOrderFileFingerprints_),
+               std::runtime_error);
+}
+
+TEST_F(SessionSnapshotTest, loadShouldThrowIfFileMagicNumberIsUnexpected) {
+  std::ofstream out(filePath_, std::ios::binary);
+  out << "\xDE\xAD\xBE\xEF";
+  out.close();
+
+  EXPECT_THROW(LoadSessionSnapshot(filePath_,
+                                   masterlistFingerprint_,
+                                   loadOrderFileFingerprints_),
+               std::runtime_error);
+}
+
+TEST_F(SessionSnapshotTest,
+       loadShouldReturnNulloptIfFileFormatVersionIsUnrecognised) {
+  std::ofstream out(filePath_, std::ios::binary);
+  out << "LGSS";
+  out.put('\x0');
+  out.close();
+
+  const auto snapshot = LoadSessionSnapshot(
+      filePath_, masterlistFingerprint_, loadOrderFileFingerprints_);
+
+  EXPECT_FALSE(snapshot.has_value());
+}
+
+TEST_F(SessionSnapshotTest,
+       loadShouldReturnNulloptIfMasterlistFingerprintSizeDiffers) {
+  SaveSessionSnapshot(filePath_, createSnapshot());
+
+  auto otherFingerprint = masterlistFingerprint_;
+  otherFingerprint.size += 1;
+
+  const auto snapshot = LoadSessionSnapshot(
+      filePath_, otherFingerprint, loadOrderFileFingerprints_);
+
+  EXPECT_FALSE(snapshot.has_value());
+}
+
+TEST_F(SessionSnapshotTest,
+       loadShouldReturnNulloptIfMasterlistFingerprintTimeDiffers) {
+  SaveSessionSnapshot(filePath_, createSnapshot());
+
+  auto otherFingerprint = masterlistFingerprint_;
+  otherFingerprint.lastWriteTime += std::chrono::seconds(1);
+
+  const auto snapshot = LoadSessionSnapshot(
+      filePath_, otherFingerprint, loadOrderFileFingerprints_);
+
+  EXPECT_FALSE(snapshot.has_value());
+}
+
+TEST_F(SessionSnapshotTest,
+       loadShouldReturnNulloptIfALoadOrderFileFingerprintDiffers) {
+  SaveSessionSnapshot(filePath_, createSnapshot());
+
+  auto otherFingerprints = loadOrderFileFingerprints_;
+  otherFingerprints.at(rootPath_ / "plugins.txt").value().lastWriteTime +=
+      std::chrono::seconds(1);
+
+  const auto snapshot = LoadSessionSnapshot(
+      filePath_, masterlistFingerprint_, otherFingerprints);
+
+  EXPECT_FALSE(snapshot.has_value());
+}
+
+TEST_F(SessionSnapshotTest,
+       loadShouldReturnNulloptIfALoadOrderFileHasBeenCreated) {
+  SaveSessionSnapshot(filePath_, createSnapshot());
+
+  auto otherFingerprints = loadOrderFileFingerprints_;
+  otherFingerprints.at(rootPath_ / "loadorder.txt") =
+      otherFingerprints.at(rootPath_ / "plugins.txt");
+
+  const auto snapshot = LoadSessionSnapshot(
+      filePath_, masterlistFingerprint_, otherFingerprints);
+
+  EXPECT_FALSE(snapshot.has_value());
+}
+
+TEST_F(SessionSnapshotTest, loadShouldThrowIfFileIsTruncated) {
+  SaveSessionSnapshot(filePath_, createSnapshot());
+
+  const auto size = std::filesystem::file_size(filePath_);
+  std::filesystem::resize_file(filePath_, size - 1);
+
+  EXPECT_THROW(LoadSessionSnapshot(filePath_,
+                                   masterlistFingerprint_,
+                                   loadOrderFileFingerprints_),
+               std::runtime_error);
+}
+
+TEST_F(SessionSnapshotTest, saveAndLoadShouldRoundTripSnapshotData) {
+  const auto expected = createSnapshot();
+
+  SaveSessionSnapshot(filePath_, expected);
+
+  const auto snapshot = LoadSessionSnapshot(
+      filePath_, masterlistFingerprint_, loadOrderFileFingerprints_);
+
+  ASSERT_TRUE(snapshot.has_value());
+  EXPECT_EQ(masterlistFingerprint_, snapshot.value().masterlistFingerprint);
+  EXPECT_EQ(loadOrderFileFingerprints_,
+            snapshot.value().loadOrderFileFingerprints);
+
+  const auto& info = snapshot.value().generalInformation;
+  EXPECT_TRUE(info.gameSupportsLightPlugins);
+  EXPECT_EQ("abcdef0", info.masterlistRevision.id);
+  EXPECT_EQ("2024-01-01", info.masterlistRevision.date);
+  EXPECT_EQ("1234567", info.preludeRevision.id);
+  EXPECT_EQ("2024-01-02", info.preludeRevision.date);
+  EXPECT_EQ(expected.generalInformation.generalMessages,
+            info.generalMessages);
+
+  const auto& plugins = snapshot.value().plugins;
+  ASSERT_EQ(2, plugins.size());
+
+  const auto& first = plugins.at(0);
+  EXPECT_EQ("Blank.esm", first.name);
+  EXPECT_EQ(std::optional<short>(0), first.loadOrderIndex);
+  EXPECT_EQ(std::optional<uint32_t>(0xDEADBEEF), first.crc);
+  EXPECT_EQ(std::optional<std::string>("1.0"), first.version);
+  EXPECT_EQ(std::optional<std::string>("early"), first.group);
+  EXPECT_FALSE(first.cleaningUtility.has_value());
+  EXPECT_TRUE(first.isActive);
+  EXPECT_FALSE(first.isDirty);
+  EXPECT_TRUE(first.isMaster);
+  EXPECT_TRUE(first.isCreationClubPlugin);
+  EXPECT_EQ(std::vector<std::string>({"Relev"}), first.currentTags);
+  EXPECT_EQ(std::vector<std::string>({"Delev", "Names"}), first.addTags);
+  EXPECT_EQ(std::vector<std::string>({"Stats"}), first.removeTags);
+  EXPECT_EQ(expected.plugins.at(0).messages, first.messages);
+  ASSERT_EQ(1, first.locations.size());
+  EXPECT_EQ("https://example.com", first.locations.at(0).GetURL());
+  EXPECT_EQ("Example", first.locations.at(0).GetName());
+
+  const auto& second = plugins.at(1);
+  EXPECT_EQ("Blank.esp", second.name);
+  EXPECT_FALSE(second.loadOrderIndex.has_value());
+  EXPECT_FALSE(second.crc.has_value());
+  EXPECT_FALSE(second.version.has_value());
+  EXPECT_EQ(std::optional<std::string>("xEdit"), second.cleaningUtility);
+  EXPECT_FALSE(second.isActive);
+  EXPECT_TRUE(second.isDirty);
+  EXPECT_TRUE(second.loadsArchive);
+  EXPECT_TRUE(second.messages.empty());
+  EXPECT_TRUE(second.locations.empty());
+}
+}
+}
+
+#endif
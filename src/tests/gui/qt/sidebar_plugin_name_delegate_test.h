@@ -0,0 +1,106 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_SIDEBAR_PLUGIN_NAME_DELEGATE_TEST
+#define LOOT_TESTS_GUI_QT_SIDEBAR_PLUGIN_NAME_DELEGATE_TEST
+
+#include <gtest/gtest.h>
+
+#include "gui/qt/sidebar_plugin_name_delegate.h"
+
+namespace loot {
+namespace test {
+class SidebarTextCacheTest : public ::testing::Test {
+protected:
+  static SidebarRowText createText(const QString& name, const QString& group) {
+    SidebarRowText text;
+    text.name = name;
+    text.group = group;
+    return text;
+  }
+
+  SidebarTextCache cache_;
+};
+
+TEST_F(SidebarTextCacheTest, findShouldReturnNullIfThePluginHasNoEntry) {
+  EXPECT_EQ(nullptr, cache_.find(createText("A.esp", ""), 100));
+}
+
+TEST_F(SidebarTextCacheTest,
+       findShouldReturnTheEntryForAPluginWithTheSameTextAndWidth) {
+  cache_.insert(createText("A.esp", "group"),
+                100,
+                QStaticText("A.esp"),
+                QStaticText("group"));
+
+  const auto entry = cache_.find(createText("A.esp", "group"), 100);
+
+  ASSERT_NE(nullptr, entry);
+  EXPECT_EQ("A.esp", entry->name.text());
+  EXPECT_EQ("group", entry->group.text());
+}
+
+TEST_F(SidebarTextCacheTest, findShouldReturnNullIfTheWidthHasChanged) {
+  cache_.insert(createText("A.esp", ""), 100, QStaticText("A.esp"), {});
+
+  EXPECT_EQ(nullptr, cache_.find(createText("A.esp", ""), 99));
+}
+
+TEST_F(SidebarTextCacheTest, findShouldReturnNullIfTheGroupHasChanged) {
+  cache_.insert(createText("A.esp", ""), 100, QStaticText("A.esp"), {});
+
+  EXPECT_EQ(nullptr, cache_.find(createText("A.esp", "group"), 100));
+}
+
+TEST_F(SidebarTextCacheTest, findShouldNotReturnAnotherPluginsEntry) {
+  cache_.insert(createText("A.esp", ""), 100, QStaticText("A.esp"), {});
+
+  EXPECT_EQ(nullptr, cache_.find(createText("B.esp", ""), 100));
+}
+
+TEST_F(SidebarTextCacheTest, insertShouldReplaceThePluginsExistingEntry) {
+  cache_.insert(createText("A.esp", ""), 100, QStaticText("A.esp"), {});
+  cache_.insert(createText("A.esp", ""), 50, QStaticText("A..."), {});
+
+  const auto entry = cache_.find(createText("A.esp", ""), 50);
+
+  ASSERT_NE(nullptr, entry);
+  EXPECT_EQ("A...", entry->name.text());
+  EXPECT_EQ(nullptr, cache_.find(createText("A.esp", ""), 100));
+  EXPECT_EQ(1, cache_.size());
+}
+
+TEST_F(SidebarTextCacheTest, clearShouldRemoveAllEntries) {
+  cache_.insert(createText("A.esp", ""), 100, QStaticText("A.esp"), {});
+  cache_.insert(createText("B.esp", ""), 100, QStaticText("B.esp"), {});
+
+  cache_.clear();
+
+  EXPECT_EQ(0, cache_.size());
+}
+}
+}
+
+#endif
@@ -0,0 +1,160 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_TASKS_PREFETCHED_QUERY_TEST
+#define LOOT_TESTS_GUI_QT_TASKS_PREFETCHED_QUERY_TEST
+
+#include <gtest/gtest.h>
+
+#include <QtTest/QSignalSpy>
+
+#include "gui/qt/tasks/prefetched_query.h"
+
+namespace loot {
+namespace test {
+class PrefetchTestQuery : public Query {
+public:
+  explicit PrefetchTestQuery(bool fail) : fail(fail) {}
+
+  QueryResult executeLogic() override {
+    if (fail) {
+      throw std::runtime_error("Query failed");
+    }
+
+    return true;
+  }
+
+  std::string getErrorMessage() const override { return "Error message"; }
+
+private:
+  const bool fail;
+};
+
+class PrefetchReceiver : public QObject {
+public:
+  void onFinished(QueryResult result) { results.push_back(result); }
+  void onError(const std::string& message) { errors.push_back(message); }
+
+  std::vector<QueryResult> results;
+  std::vector<std::string> errors;
+};
+
+class PrefetchedQueryTest : public ::testing::Test {
+protected:
+  static constexpr int TIMEOUT_MS = 1000;
+};
+
+TEST_F(PrefetchedQueryTest, shouldRunTheQueryWithoutBeingAskedTo) {
+  PrefetchedQuery query(std::make_unique<PrefetchTestQuery>(false));
+  QSignalSpy finishedSpy(&query, &PrefetchedQuery::finished);
+
+  ASSERT_TRUE(finishedSpy.wait(TIMEOUT_MS));
+
+  EXPECT_TRUE(query.isDone());
+
+  const auto result = finishedSpy.takeFirst().at(0).value<QueryResult>();
+  EXPECT_TRUE(std::get<bool>(result));
+}
+
+TEST_F(PrefetchedQueryTest,
+       deliverToShouldCallTheFinishedHandlerImmediatelyIfTheQueryIsDone) {
+  PrefetchedQuery query(std::make_unique<PrefetchTestQuery>(false));
+  QSignalSpy finishedSpy(&query, &PrefetchedQuery::finished);
+  ASSERT_TRUE(finishedSpy.wait(TIMEOUT_MS));
+
+  PrefetchReceiver receiver;
+  query.deliverTo(
+      &receiver, &PrefetchReceiver::onFinished, &PrefetchReceiver::onError);
+
+  ASSERT_EQ(1, receiver.results.size());
+  EXPECT_TRUE(std::get<bool>(receiver.results[0]));
+  EXPECT_TRUE(receiver.errors.empty());
+}
+
+TEST_F(PrefetchedQueryTest,
+       deliverToShouldCallTheErrorHandlerImmediatelyIfTheQueryHasFailed) {
+  PrefetchedQuery query(std::make_unique<PrefetchTestQuery>(true));
+  QSignalSpy errorSpy(&query, &PrefetchedQuery::error);
+  ASSERT_TRUE(errorSpy.wait(TIMEOUT_MS));
+
+  PrefetchReceiver receiver;
+  query.deliverTo(
+      &receiver, &PrefetchReceiver::onFinished, &PrefetchReceiver::onError);
+
+  EXPECT_TRUE(receiver.results.empty());
+  EXPECT_EQ(std::vector<std::string>({"Error message"}), receiver.errors);
+}
+
+TEST_F(PrefetchedQueryTest,
+       deliverToShouldCallTheFinishedHandlerOnceAPendingQueryIsDone) {
+  PrefetchedQuery query(std::make_unique<PrefetchTestQuery>(false));
+  PrefetchReceiver receiver;
+  QSignalSpy finishedSpy(&query, &PrefetchedQuery::finished);
+
+  // The query's outcome is delivered through a queued connection, so it can't
+  // be done yet.
+  ASSERT_FALSE(query.isDone());
+  query.deliverTo(
+      &receiver, &PrefetchReceiver::onFinished, &PrefetchReceiver::onError);
+
+  ASSERT_TRUE(finishedSpy.wait(TIMEOUT_MS));
+
+  ASSERT_EQ(1, receiver.results.size());
+  EXPECT_TRUE(std::get<bool>(receiver.results[0]));
+}
+
+TEST_F(PrefetchedQueryTest,
+       shouldLoadTheGeneralInformationBeforeTheQueryFinishes) {
+  PrefetchedQuery query(std::make_unique<PrefetchTestQuery>(false), []() {
+    GeneralInformation generalInformation;
+    generalInformation.masterlistRevision.id = "abc";
+    return generalInformation;
+  });
+
+  std::optional<GeneralInformation> generalInformationOnFinish;
+  QObject::connect(&query, &PrefetchedQuery::finished, [&](QueryResult) {
+    generalInformationOnFinish = query.getGeneralInformation();
+  });
+
+  QSignalSpy finishedSpy(&query, &PrefetchedQuery::finished);
+  ASSERT_TRUE(finishedSpy.wait(TIMEOUT_MS));
+
+  ASSERT_TRUE(generalInformationOnFinish.has_value());
+  EXPECT_EQ("abc", generalInformationOnFinish.value().masterlistRevision.id);
+}
+
+TEST_F(PrefetchedQueryTest,
+       shouldNotHaveGeneralInformationIfNoGetterWasGiven) {
+  PrefetchedQuery query(std::make_unique<PrefetchTestQuery>(false));
+
+  QSignalSpy finishedSpy(&query, &PrefetchedQuery::finished);
+  ASSERT_TRUE(finishedSpy.wait(TIMEOUT_MS));
+
+  EXPECT_FALSE(query.getGeneralInformation().has_value());
+}
+}
+}
+
+#endif
@@ -101,6 +101,59 @@ TEST(QueryTask, executeShouldEmitAFinishedIfQueryExecutionSucceeds) {
   EXPECT_EQ("1", std::get<PluginItem>(result).name);
 }
 
+TEST(QueryTask,
+     executeShouldEmitLoadedGeneralInformationBeforeTheQueryResultIfGiven) {
+  auto task = QueryTask(std::make_unique<TestQuery>(1), []() {
+    GeneralInformation generalInformation;
+    generalInformation.gameSupportsLightPlugins = true;
+    return generalInformation;
+  });
+
+  std::vector<std::string> emittedSignals;
+  QObject::connect(&task,
+                   &QueryTask::generalInformationLoaded,
+                   [&](GeneralInformation generalInformation) {
+                     EXPECT_TRUE(generalInformation.gameSupportsLightPlugins);
+                     emittedSignals.push_back("generalInformationLoaded");
+                   });
+  QObject::connect(&task, &Task::finished, [&](QueryResult) {
+    emittedSignals.push_back("finished");
+  });
+
+  task.execute();
+
+  EXPECT_EQ(std::vector<std::string>({"generalInformationLoaded", "finished"}),
+            emittedSignals);
+}
+
+TEST(QueryTask,
+     executeShouldNotLoadGeneralInformationIfQueryExecutionThrowsAnException) {
+  bool wasCalled = false;
+  auto task = QueryTask(std::make_unique<TestQuery>(-1), [&]() {
+    wasCalled = true;
+    return GeneralInformation();
+  });
+  auto generalInformationSpy =
+      QSignalSpy(&task, &QueryTask::generalInformationLoaded);
+
+  task.execute();
+
+  EXPECT_FALSE(wasCalled);
+  EXPECT_EQ(0, generalInformationSpy.count());
+}
+
+TEST(QueryTask, getNameShouldReturnTheUnqualifiedNameOfTheQueryType) {
+  const auto task = QueryTask(std::make_unique<TestQuery>(1));
+
+  EXPECT_EQ("TestQuery", task.getName());
+}
+
+TEST(QueryTask, getNameShouldReturnTheTaskClassNameIfQueryIsANullPointer) {
+  const auto task = QueryTask(std::unique_ptr<Query>());
+
+  EXPECT_EQ("QueryTask", task.getName());
+}
+
 TEST(SequentialTaskExecutor, shouldRunEachTaskOnceInSeries) {
   std::vector<Task*> tasks;
   std::vector<std::unique_ptr<QSignalSpy>> taskFinishedSpies;
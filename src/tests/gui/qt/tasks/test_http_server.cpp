@@ -0,0 +1,108 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "tests/gui/qt/tasks/test_http_server.h"
+
+#include <stdexcept>
+
+namespace loot {
+namespace test {
+static constexpr const char* BUFFER_PROPERTY = "requestBuffer";
+static constexpr QByteArrayView HEADERS_END = QByteArrayView("\r\n\r\n");
+
+TestHttpServer::TestHttpServer(const QByteArray& body, const QByteArray& etag) :
+    body(body), etag(etag) {
+  connect(&server,
+          &QTcpServer::newConnection,
+          this,
+          &TestHttpServer::onNewConnection);
+
+  if (!server.listen(QHostAddress::LocalHost)) {
+    throw std::runtime_error("Could not start the test HTTP server");
+  }
+}
+
+QUrl TestHttpServer::getUrl(const QString& path) const {
+  return QUrl(
+      QString("http://127.0.0.1:%1%2").arg(server.serverPort()).arg(path));
+}
+
+int TestHttpServer::getRequestCount() const { return requestCount; }
+
+int TestHttpServer::getNotModifiedCount() const { return notModifiedCount; }
+
+void TestHttpServer::respond(QTcpSocket& socket,
+                             const QByteArray& requestHead) {
+  requestCount += 1;
+
+  bool etagMatches = false;
+  for (const auto& line : requestHead.split('\n')) {
+    const auto separatorIndex = line.indexOf(':');
+    if (separatorIndex == -1) {
+      continue;
+    }
+
+    const auto name = line.left(separatorIndex).trimmed().toLower();
+    const auto value = line.mid(separatorIndex + 1).trimmed();
+    if (name == "if-none-match" && value == etag) {
+      etagMatches = true;
+    }
+  }
+
+  if (etagMatches) {
+    notModifiedCount += 1;
+    socket.write("HTTP/1.1 304 Not Modified\r\nETag: " + etag + "\r\n\r\n");
+    return;
+  }
+
+  socket.write("HTTP/1.1 200 OK\r\nContent-Type: text/plain\r\nETag: " + etag +
+               "\r\nContent-Length: " + QByteArray::number(body.size()) +
+               "\r\n\r\n" + body);
+}
+
+void TestHttpServer::onNewConnection() {
+  while (server.hasPendingConnections()) {
+    const auto socket = server.nextPendingConnection();
+
+    connect(socket, &QTcpSocket::disconnected, socket, &QObject::deleteLater);
+    connect(socket, &QTcpSocket::readyRead, this, [this, socket]() {
+      // A connection may be reused for many requests, and a request may
+      // arrive in many pieces.
+      auto buffer =
+          socket->property(BUFFER_PROPERTY).toByteArray() + socket->readAll();
+
+      auto headersEnd = buffer.indexOf(HEADERS_END);
+      while (headersEnd != -1) {
+        respond(*socket, buffer.left(headersEnd));
+        buffer.remove(0, headersEnd + HEADERS_END.size());
+        headersEnd = buffer.indexOf(HEADERS_END);
+      }
+
+      socket->setProperty(BUFFER_PROPERTY, buffer);
+    });
+  }
+}
+}
+}
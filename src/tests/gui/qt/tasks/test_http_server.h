@@ -0,0 +1,64 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_TASKS_TEST_HTTP_SERVER
+#define LOOT_TESTS_GUI_QT_TASKS_TEST_HTTP_SERVER
+
+#include <QtCore/QByteArray>
+#include <QtCore/QUrl>
+#include <QtNetwork/QTcpServer>
+#include <QtNetwork/QTcpSocket>
+
+namespace loot {
+namespace test {
+// A minimal local HTTP/1.1 server that responds to every request with the
+// same body and ETag, or with 304 Not Modified if the request has a matching
+// If-None-Match header.
+class TestHttpServer : public QObject {
+  Q_OBJECT
+public:
+  TestHttpServer(const QByteArray& body, const QByteArray& etag);
+
+  QUrl getUrl(const QString& path) const;
+
+  int getRequestCount() const;
+  int getNotModifiedCount() const;
+
+private:
+  QTcpServer server;
+  const QByteArray body;
+  const QByteArray etag;
+  int requestCount{0};
+  int notModifiedCount{0};
+
+  void respond(QTcpSocket& socket, const QByteArray& requestHead);
+
+private slots:
+  void onNewConnection();
+};
+}
+}
+
+#endif
@@ -0,0 +1,248 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_TASKS_UPDATE_MASTERLIST_TASK_TEST
+#define LOOT_TESTS_GUI_QT_TASKS_UPDATE_MASTERLIST_TASK_TEST
+
+#include <gtest/gtest.h>
+
+#include <QtTest/QSignalSpy>
+#include <algorithm>
+#include <fstream>
+
+#include "gui/qt/helpers.h"
+#include "gui/qt/tasks/update_masterlist_task.h"
+#include "tests/gui/qt/tasks/test_http_server.h"
+#include "tests/gui/test_helpers.h"
+
+namespace loot {
+namespace test {
+static const int NETWORK_TIMEOUT_MS = 5000;
+
+class UpdateMasterlistTaskTest : public ::testing::Test {
+protected:
+  UpdateMasterlistTaskTest() :
+      rootPath_(getTempPath()),
+      server_(QByteArray("common:\n  - &a 'a'\n"), QByteArray("\"v1\"")) {}
+
+  void SetUp() override { std::filesystem::create_directories(rootPath_); }
+
+  void TearDown() override { std::filesystem::remove_all(rootPath_); }
+
+  std::string getUrl(const std::string& path) const {
+    return server_.getUrl(QString::fromStdString(path))
+        .toString()
+        .toStdString();
+  }
+
+  MasterlistsUpdateResult executeAndWait(UpdateMasterlistsTask& task) {
+    auto finishedSpy = QSignalSpy(&task, &Task::finished);
+
+    task.execute();
+
+    if (finishedSpy.count() == 0 && !finishedSpy.wait(NETWORK_TIMEOUT_MS)) {
+      throw std::runtime_error("Timed out waiting for the task to finish");
+    }
+
+    auto result = std::get<MasterlistsUpdateResult>(
+        finishedSpy.takeFirst().at(0).value<QueryResult>());
+
+    std::sort(result.updates.begin(), result.updates.end());
+
+    return result;
+  }
+
+  std::string readFile(const std::filesystem::path& path) {
+    std::ifstream in(path);
+    return std::string(std::istreambuf_iterator<char>(in),
+                       std::istreambuf_iterator<char>());
+  }
+
+  const std::filesystem::path rootPath_;
+  TestHttpServer server_;
+};
+
+TEST_F(UpdateMasterlistTaskTest,
+       updateMasterlistsTaskShouldFetchEachDistinctSourceOnlyOnce) {
+  const auto sharedUrl = getUrl("/shared/masterlist.yaml");
+  const auto otherUrl = getUrl("/other/masterlist.yaml");
+
+  auto task = UpdateMasterlistsTask({{"a", sharedUrl, rootPath_ / "a.yaml"},
+                                     {"b", sharedUrl, rootPath_ / "b.yaml"},
+                                     {"c", otherUrl, rootPath_ / "c.yaml"}});
+
+  const auto result = executeAndWait(task);
+
+  EXPECT_EQ(2, server_.getRequestCount());
+  EXPECT_EQ(MasterlistUpdateResults(
+                {{"a", true}, {"b", true}, {"c", true}}),
+            result.updates);
+  EXPECT_EQ(readFile(rootPath_ / "a.yaml"), readFile(rootPath_ / "b.yaml"));
+  EXPECT_EQ(readFile(rootPath_ / "a.yaml"), readFile(rootPath_ / "c.yaml"));
+}
+
+TEST_F(UpdateMasterlistTaskTest,
+       updateMasterlistsTaskShouldRecordTheETagAlongsideTheRevision) {
+  auto task = UpdateMasterlistsTask(
+      {{"a", getUrl("/masterlist.yaml"), rootPath_ / "a.yaml"}});
+
+  executeAndWait(task);
+
+  const auto revision = getFileRevision(rootPath_ / "a.yaml");
+
+  EXPECT_EQ("\"v1\"", revision.httpValidators.etag);
+  EXPECT_FALSE(revision.httpValidators.lastModified.has_value());
+}
+
+TEST_F(UpdateMasterlistTaskTest,
+       updateMasterlistsTaskShouldMakeAConditionalRequestIfFilesAreUnmodified) {
+  const auto url = getUrl("/masterlist.yaml");
+
+  auto firstTask = UpdateMasterlistsTask({{"a", url, rootPath_ / "a.yaml"},
+                                          {"b", url, rootPath_ / "b.yaml"}});
+  executeAndWait(firstTask);
+
+  auto secondTask = UpdateMasterlistsTask({{"a", url, rootPath_ / "a.yaml"},
+                                           {"b", url, rootPath_ / "b.yaml"}});
+  const auto result = executeAndWait(secondTask);
+
+  EXPECT_EQ(2, server_.getRequestCount());
+  EXPECT_EQ(1, server_.getNotModifiedCount());
+  EXPECT_EQ(MasterlistUpdateResults({{"a", false}, {"b", false}}),
+            result.updates);
+  EXPECT_FALSE(getFileRevision(rootPath_ / "a.yaml").is_modified);
+}
+
+TEST_F(UpdateMasterlistTaskTest,
+       updateMasterlistsTaskShouldNotMakeAConditionalRequestForAnEditedFile) {
+  const auto url = getUrl("/masterlist.yaml");
+
+  auto firstTask = UpdateMasterlistsTask({{"a", url, rootPath_ / "a.yaml"}});
+  executeAndWait(firstTask);
+
+  std::ofstream out(rootPath_ / "a.yaml");
+  out << "edited";
+  out.close();
+
+  auto secondTask = UpdateMasterlistsTask({{"a", url, rootPath_ / "a.yaml"}});
+  const auto result = executeAndWait(secondTask);
+
+  EXPECT_EQ(0, server_.getNotModifiedCount());
+  EXPECT_EQ(MasterlistUpdateResults({{"a", true}}), result.updates);
+  EXPECT_NE("edited", readFile(rootPath_ / "a.yaml"));
+}
+
+TEST_F(
+    UpdateMasterlistTaskTest,
+    updateMasterlistsTaskShouldNotMakeAConditionalRequestIfValidatorsDiffer) {
+  const auto url = getUrl("/masterlist.yaml");
+
+  auto firstTask = UpdateMasterlistsTask({{"a", url, rootPath_ / "a.yaml"}});
+  executeAndWait(firstTask);
+
+  auto secondTask = UpdateMasterlistsTask({{"a", url, rootPath_ / "a.yaml"},
+                                           {"b", url, rootPath_ / "b.yaml"}});
+  const auto result = executeAndWait(secondTask);
+
+  EXPECT_EQ(0, server_.getNotModifiedCount());
+  EXPECT_EQ(MasterlistUpdateResults({{"a", false}, {"b", true}}),
+            result.updates);
+}
+
+TEST_F(UpdateMasterlistTaskTest,
+       updateMasterlistsTaskShouldReportFailedSourcesAndUpdateTheOthers) {
+  // Reserve a port and then close it so that connections to it fail.
+  QTcpServer closedServer;
+  ASSERT_TRUE(closedServer.listen(QHostAddress::LocalHost));
+  const auto closedPort = closedServer.serverPort();
+  closedServer.close();
+
+  const auto badUrl =
+      "http://127.0.0.1:" + std::to_string(closedPort) + "/masterlist.yaml";
+
+  auto task = UpdateMasterlistsTask(
+      {{"a", getUrl("/masterlist.yaml"), rootPath_ / "a.yaml"},
+       {"b", badUrl, rootPath_ / "b.yaml"}});
+  auto errorSpy = QSignalSpy(&task, &Task::error);
+
+  const auto result = executeAndWait(task);
+
+  EXPECT_EQ(MasterlistUpdateResults({{"a", true}}), result.updates);
+  EXPECT_EQ(1, result.errors.size());
+  EXPECT_EQ(0, errorSpy.count());
+  EXPECT_FALSE(std::filesystem::exists(rootPath_ / "b.yaml"));
+}
+
+TEST_F(UpdateMasterlistTaskTest,
+       updateMasterlistTaskShouldMakeAConditionalRequestIfFileIsUnmodified) {
+  const auto url = getUrl("/masterlist.yaml");
+  const auto path = rootPath_ / "a.yaml";
+
+  for (const auto expectedResult : {true, false}) {
+    auto task = UpdateMasterlistTask("a", url, path);
+    auto finishedSpy = QSignalSpy(&task, &Task::finished);
+
+    task.execute();
+
+    ASSERT_TRUE(finishedSpy.wait(NETWORK_TIMEOUT_MS));
+    const auto result = std::get<MasterlistUpdateResult>(
+        finishedSpy.takeFirst().at(0).value<QueryResult>());
+    EXPECT_EQ(expectedResult, result.second);
+  }
+
+  EXPECT_EQ(2, server_.getRequestCount());
+  EXPECT_EQ(1, server_.getNotModifiedCount());
+}
+
+TEST_F(UpdateMasterlistTaskTest,
+       updateMasterlistsTaskShouldLoadGeneralInformationAfterWritingFiles) {
+  const auto masterlistPath = rootPath_ / "a.yaml";
+  auto task = UpdateMasterlistsTask(
+      {{"a", getUrl("/masterlist.yaml"), masterlistPath}});
+
+  bool wasMasterlistWritten = false;
+  task.setGeneralInformationGetter([&]() {
+    wasMasterlistWritten = std::filesystem::exists(masterlistPath);
+    return GeneralInformation();
+  });
+
+  std::vector<std::string> emittedSignals;
+  QObject::connect(&task, &Task::generalInformationLoaded, [&]() {
+    emittedSignals.push_back("generalInformationLoaded");
+  });
+  QObject::connect(&task, &Task::finished, [&]() {
+    emittedSignals.push_back("finished");
+  });
+
+  executeAndWait(task);
+
+  EXPECT_TRUE(wasMasterlistWritten);
+  EXPECT_EQ(std::vector<std::string>({"generalInformationLoaded", "finished"}),
+            emittedSignals);
+}
+}
+}
+
+#endif
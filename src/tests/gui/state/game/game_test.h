@@ -305,6 +305,23 @@ TEST_P(GameTest, initShouldNotThrowIfGameAndLocalPathsAreNotEmpty) {
   EXPECT_NO_THROW(game.Init());
 }
 
+TEST_P(GameTest,
+       getLoadOrderFilePathsShouldReturnTheActivePluginsFileAndLoadOrderTxt) {
+  Game game(defaultGameSettings, lootDataPath, "");
+  game.Init();
+
+  const auto activePluginsFilePath = game.GetActivePluginsFilePath();
+  const std::vector<std::filesystem::path> expected{
+      activePluginsFilePath,
+      activePluginsFilePath.parent_path() / "loadorder.txt"};
+
+  EXPECT_EQ(expected, game.GetLoadOrderFilePaths());
+
+  if (GetParam() == GameId::tes5) {
+    EXPECT_EQ(localPath / "loadorder.txt", game.GetLoadOrderFilePaths().at(1));
+  }
+}
+
 TEST_P(GameTest, checkInstallValidityShouldCheckThatRequirementsArePresent) {
   Game game = CreateInitialisedGame();
   game.LoadAllInstalledPlugins(true);
@@ -869,6 +886,122 @@ TEST_P(GameTest, pluginsShouldBeFullyLoadedAfterFullyLoadingThem) {
   EXPECT_TRUE(game.ArePluginsFullyLoaded());
 }
 
+TEST_P(GameTest,
+       loadChangedInstalledPluginsShouldNotReloadPluginsIfNothingHasChanged) {
+  Game game = CreateInitialisedGame();
+  ASSERT_NO_THROW(game.LoadAllInstalledPlugins(false));
+
+  EXPECT_FALSE(game.LoadChangedInstalledPlugins());
+  EXPECT_TRUE(game.ArePluginsFullyLoaded());
+}
+
+TEST_P(GameTest,
+       loadChangedInstalledPluginsShouldReloadPluginsIfAPluginWasModified) {
+  Game game = CreateInitialisedGame();
+  ASSERT_NO_THROW(game.LoadAllInstalledPlugins(false));
+
+  const auto pluginPath = dataPath / blankEsp;
+  std::filesystem::last_write_time(
+      pluginPath,
+      std::filesystem::last_write_time(pluginPath) + std::chrono::seconds(1));
+
+  EXPECT_TRUE(game.LoadChangedInstalledPlugins());
+  EXPECT_FALSE(game.ArePluginsFullyLoaded());
+  EXPECT_NE(nullptr, game.GetPlugin(blankEsp));
+}
+
+TEST_P(GameTest,
+       loadChangedInstalledPluginsShouldReloadPluginsIfAPluginWasAdded) {
+  Game game = CreateInitialisedGame();
+  ASSERT_NO_THROW(game.LoadAllInstalledPlugins(true));
+
+  std::filesystem::copy(dataPath / blankEsp, dataPath / "new.esp");
+
+  EXPECT_TRUE(game.LoadChangedInstalledPlugins());
+  EXPECT_NE(nullptr, game.GetPlugin("new.esp"));
+}
+
+TEST_P(GameTest, metadataShouldBeStaleIfItHasNotBeenLoaded) {
+  Game game = CreateInitialisedGame();
+
+  EXPECT_TRUE(game.IsMetadataStale());
+}
+
+TEST_P(GameTest, metadataShouldNotBeStaleAfterLoadingIt) {
+  Game game = CreateInitialisedGame();
+  game.LoadMetadata();
+
+  EXPECT_FALSE(game.IsMetadataStale());
+}
+
+TEST_P(GameTest, metadataShouldBeStaleIfTheUserlistIsCreatedAfterLoadingIt) {
+  Game game = CreateInitialisedGame();
+  game.LoadMetadata();
+
+  std::ofstream out(game.UserlistPath());
+  out << "plugins: []";
+  out.close();
+
+  EXPECT_TRUE(game.IsMetadataStale());
+}
+
+TEST_P(GameTest, metadataShouldNotBeStaleAfterSavingUserMetadata) {
+  Game game = CreateInitialisedGame();
+  game.LoadMetadata();
+
+  game.SaveUserMetadata();
+
+  EXPECT_FALSE(game.IsMetadataStale());
+}
+
+TEST_P(GameTest,
+       saveUserMetadataShouldReplaceTheUserlistWithoutLeavingATempFile) {
+  Game game = CreateInitialisedGame();
+  game.LoadMetadata();
+
+  std::ofstream out(game.UserlistPath());
+  out << "plugins: []";
+  out.close();
+
+  PluginMetadata metadata(blankEsm);
+  metadata.SetGroup("default");
+  game.AddUserMetadata(metadata);
+  game.SaveUserMetadata();
+
+  auto tempPath = game.UserlistPath();
+  tempPath += ".tmp";
+
+  EXPECT_FALSE(std::filesystem::exists(tempPath));
+
+  game.LoadMetadata();
+  EXPECT_TRUE(game.GetUserMetadata(blankEsm).has_value());
+}
+
+TEST_P(GameTest, estimateMemoryUsageShouldBeZeroIfTheGameIsNotInitialised) {
+  Game game(defaultGameSettings, lootDataPath, "");
+
+  EXPECT_EQ(0, game.EstimateMemoryUsage());
+}
+
+TEST_P(GameTest, estimateMemoryUsageShouldIncreaseWhenPluginsAreLoaded) {
+  Game game = CreateInitialisedGame();
+  const auto initialEstimate = game.EstimateMemoryUsage();
+
+  game.LoadAllInstalledPlugins(true);
+
+  EXPECT_LT(initialEstimate, game.EstimateMemoryUsage());
+}
+
+TEST_P(GameTest, unloadShouldDiscardTheGameHandle) {
+  Game game = CreateInitialisedGame();
+  game.LoadAllInstalledPlugins(true);
+
+  game.Unload();
+
+  EXPECT_FALSE(game.IsInitialised());
+  EXPECT_EQ(0, game.EstimateMemoryUsage());
+}
+
 TEST_P(GameTest,
        GetActiveLoadOrderIndexShouldReturnNulloptForAPluginThatIsNotActive) {
   Game game = CreateInitialisedGame();
@@ -41,6 +41,17 @@ public:
     }
   }
 
+  int GetUnloadCount(const std::string& folderName) {
+    auto it = unloadCounts_.find(folderName);
+    if (it == unloadCounts_.end()) {
+      return 0;
+    } else {
+      return it->second;
+    }
+  }
+
+  void SetGameDataSize(size_t size) { gameDataSize_ = size; }
+
 private:
   std::vector<GameSettings> FindInstalledGames(
       const std::vector<GameSettings>& gamesSettings) const override {
@@ -73,7 +84,19 @@ private:
     }
   }
 
+  void ReuseGameData(gui::Game&) override {}
+
+  void UnloadGameData(gui::Game& game) override {
+    unloadCounts_[game.GetSettings().FolderName()]++;
+  }
+
+  size_t EstimateGameDataSize(const gui::Game&) const override {
+    return gameDataSize_;
+  }
+
   mutable std::map<std::string, unsigned int> initialiseCounts_;
+  std::map<std::string, unsigned int> unloadCounts_;
+  size_t gameDataSize_{0};
 };
 
 GameSettings createSettings(GameId gameId) {
@@ -280,6 +303,95 @@ TEST(GamesManager, setCurrentGameShouldNotInitialiseGameData) {
   EXPECT_EQ(0, manager.GetInitialiseCount(TEST_GAMES_SETTINGS[1].FolderName()));
 }
 
+TEST(GamesManager,
+     initialiseCurrentGameDataShouldInitialiseGameDataThatIsNotCached) {
+  TestGamesManager manager;
+  manager.LoadInstalledGames(
+      TEST_GAMES_SETTINGS, std::filesystem::path(), std::filesystem::path());
+
+  manager.SetCurrentGame(TEST_GAMES_SETTINGS[1].FolderName());
+  manager.InitialiseCurrentGameData();
+
+  EXPECT_EQ(1, manager.GetInitialiseCount(TEST_GAMES_SETTINGS[1].FolderName()));
+}
+
+TEST(GamesManager,
+     initialiseCurrentGameDataShouldReuseCachedDataWhenSwitchingBackToAGame) {
+  TestGamesManager manager;
+  manager.LoadInstalledGames(
+      TEST_GAMES_SETTINGS, std::filesystem::path(), std::filesystem::path());
+
+  manager.SetCurrentGame(TEST_GAMES_SETTINGS[1].FolderName());
+  manager.InitialiseCurrentGameData();
+  manager.SetCurrentGame(TEST_GAMES_SETTINGS[2].FolderName());
+  manager.InitialiseCurrentGameData();
+  manager.SetCurrentGame(TEST_GAMES_SETTINGS[1].FolderName());
+  manager.InitialiseCurrentGameData();
+
+  EXPECT_EQ(1, manager.GetInitialiseCount(TEST_GAMES_SETTINGS[1].FolderName()));
+  EXPECT_EQ(1, manager.GetInitialiseCount(TEST_GAMES_SETTINGS[2].FolderName()));
+  EXPECT_EQ(0, manager.GetUnloadCount(TEST_GAMES_SETTINGS[1].FolderName()));
+  EXPECT_EQ(0, manager.GetUnloadCount(TEST_GAMES_SETTINGS[2].FolderName()));
+}
+
+TEST(
+    GamesManager,
+    initialiseCurrentGameDataShouldUnloadTheLeastRecentlyUsedGameIfTheBudgetIsExceeded) {
+  TestGamesManager manager;
+  manager.LoadInstalledGames(
+      TEST_GAMES_SETTINGS, std::filesystem::path(), std::filesystem::path());
+  manager.SetGameDataCacheBudget(15);
+  manager.SetGameDataSize(10);
+
+  manager.SetCurrentGame(TEST_GAMES_SETTINGS[1].FolderName());
+  manager.InitialiseCurrentGameData();
+  manager.SetCurrentGame(TEST_GAMES_SETTINGS[2].FolderName());
+  manager.InitialiseCurrentGameData();
+
+  EXPECT_EQ(1, manager.GetUnloadCount(TEST_GAMES_SETTINGS[1].FolderName()));
+  EXPECT_EQ(0, manager.GetUnloadCount(TEST_GAMES_SETTINGS[2].FolderName()));
+
+  manager.SetCurrentGame(TEST_GAMES_SETTINGS[1].FolderName());
+  manager.InitialiseCurrentGameData();
+
+  EXPECT_EQ(2, manager.GetInitialiseCount(TEST_GAMES_SETTINGS[1].FolderName()));
+  EXPECT_EQ(1, manager.GetUnloadCount(TEST_GAMES_SETTINGS[2].FolderName()));
+}
+
+TEST(
+    GamesManager,
+    initialiseCurrentGameDataShouldNotUnloadTheCurrentGameIfItExceedsTheBudget) {
+  TestGamesManager manager;
+  manager.LoadInstalledGames(
+      TEST_GAMES_SETTINGS, std::filesystem::path(), std::filesystem::path());
+  manager.SetGameDataCacheBudget(5);
+  manager.SetGameDataSize(10);
+
+  manager.SetCurrentGame(TEST_GAMES_SETTINGS[1].FolderName());
+  manager.InitialiseCurrentGameData();
+
+  EXPECT_EQ(0, manager.GetUnloadCount(TEST_GAMES_SETTINGS[1].FolderName()));
+}
+
+TEST(GamesManager, loadInstalledGamesShouldKeepCachedDataForUnchangedGames) {
+  TestGamesManager manager;
+  manager.LoadInstalledGames(
+      TEST_GAMES_SETTINGS, std::filesystem::path(), std::filesystem::path());
+
+  manager.SetCurrentGame(TEST_GAMES_SETTINGS[1].FolderName());
+  manager.InitialiseCurrentGameData();
+  manager.SetCurrentGame(TEST_GAMES_SETTINGS[2].FolderName());
+  manager.InitialiseCurrentGameData();
+
+  manager.LoadInstalledGames(
+      TEST_GAMES_SETTINGS, std::filesystem::path(), std::filesystem::path());
+
+  manager.SetCurrentGame(TEST_GAMES_SETTINGS[1].FolderName());
+  manager.InitialiseCurrentGameData();
+
+  EXPECT_EQ(1, manager.GetInitialiseCount(TEST_GAMES_SETTINGS[1].FolderName()));
+}
+
 TEST(GamesManager,
      getFirstInstalledGameFolderNameShouldReturnNulloptIfNoGamesAreInstalled) {
   TestGamesManager manager;
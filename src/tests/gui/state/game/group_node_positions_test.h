@@ -78,6 +78,10 @@ class LoadGroupNodePositionsTest : public GroupNodePositionsFixture {};
 
 class SaveGroupNodePositionsTest : public GroupNodePositionsFixture {};
 
+class LoadGroupLayoutCacheTest : public GroupNodePositionsFixture {};
+
+class SaveGroupLayoutCacheTest : public GroupNodePositionsFixture {};
+
 TEST_F(LoadGroupNodePositionsTest,
        shouldReturnAnEmptyVectorIfFileDoesNotExist) {
   const auto positions = LoadGroupNodePositions(rootPath_ / "missing.bin");
@@ -208,6 +212,81 @@ TEST_F(SaveGroupNodePositionsTest, shouldWriteNamesPrefixedWithTheirLengths) {
   EXPECT_EQ(-3.0, *reinterpret_cast<const double*>(&bytes[35]));
   EXPECT_EQ(-4.5, *reinterpret_cast<const double*>(&bytes[43]));
 }
+
+TEST_F(LoadGroupLayoutCacheTest, shouldReturnNulloptIfFileDoesNotExist) {
+  EXPECT_FALSE(LoadGroupLayoutCache(rootPath_ / "missing.bin").has_value());
+}
+
+TEST_F(LoadGroupLayoutCacheTest, shouldThrowIfFileIsAGroupNodePositionsFile) {
+  const auto path = rootPath_ / "cache.bin";
+
+  SaveGroupNodePositions(path, {});
+
+  EXPECT_THROW(LoadGroupLayoutCache(path), std::runtime_error);
+}
+
+TEST_F(LoadGroupLayoutCacheTest, shouldThrowIfFileHasNoGraphHash) {
+  const auto path = rootPath_ / "cache.bin";
+
+  writeBytes(path, {'\x4C', '\x47', '\x4C', '\x43', '\x1'});
+
+  EXPECT_THROW(LoadGroupLayoutCache(path), std::runtime_error);
+}
+
+TEST_F(LoadGroupLayoutCacheTest, shouldAcceptDataWrittenBySave) {
+  const auto path = rootPath_ / "cache.bin";
+
+  GroupLayoutCache originalCache{
+      0x0123456789ABCDEF,
+      {GroupNodePosition{"default", 1.1, 2.2},
+       GroupNodePosition{"DLC", -3.0, -4.5}}};
+
+  SaveGroupLayoutCache(path, originalCache);
+
+  const auto cache = LoadGroupLayoutCache(path);
+
+  ASSERT_TRUE(cache.has_value());
+  EXPECT_EQ(originalCache.graphHash, cache->graphHash);
+
+  ASSERT_EQ(2, cache->positions.size());
+
+  EXPECT_EQ(originalCache.positions[0].groupName,
+            cache->positions[0].groupName);
+  EXPECT_EQ(originalCache.positions[0].x, cache->positions[0].x);
+  EXPECT_EQ(originalCache.positions[0].y, cache->positions[0].y);
+
+  EXPECT_EQ(originalCache.positions[1].groupName,
+            cache->positions[1].groupName);
+  EXPECT_EQ(originalCache.positions[1].x, cache->positions[1].x);
+  EXPECT_EQ(originalCache.positions[1].y, cache->positions[1].y);
+}
+
+TEST_F(SaveGroupLayoutCacheTest, shouldThrowIfFileCannotBeOpened) {
+  const auto path = rootPath_ / "missing.dir" / "cache.bin";
+
+  EXPECT_THROW(SaveGroupLayoutCache(path, {}), std::runtime_error);
+}
+
+TEST_F(SaveGroupLayoutCacheTest, shouldReplaceAnExistingCache) {
+  const auto path = rootPath_ / "cache.bin";
+
+  SaveGroupLayoutCache(path, GroupLayoutCache{1, {}});
+  SaveGroupLayoutCache(path, GroupLayoutCache{2, {}});
+
+  const auto cache = LoadGroupLayoutCache(path);
+
+  ASSERT_TRUE(cache.has_value());
+  EXPECT_EQ(2, cache->graphHash);
+}
+
+TEST_F(SaveGroupLayoutCacheTest, shouldNotLeaveATemporaryFileBehind) {
+  const auto path = rootPath_ / "cache.bin";
+
+  SaveGroupLayoutCache(path, GroupLayoutCache{1, {}});
+
+  EXPECT_TRUE(std::filesystem::exists(path));
+  EXPECT_FALSE(std::filesystem::exists(rootPath_ / "cache.bin.tmp"));
+}
 }
 }
 
@@ -27,6 +27,8 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <boost/locale.hpp>
 #include <fstream>
 
 #include "gui/state/game/helpers.h"
@@ -208,6 +210,126 @@ TEST_F(
   EXPECT_EQ(dataPath / filename, pluginPath);
 }
 
+class GetFileFingerprintsTest : public CommonGameTestFixture {
+protected:
+  GetFileFingerprintsTest() : CommonGameTestFixture(GameId::tes5se) {}
+};
+
+TEST_F(GetFileFingerprintsTest, shouldReturnNulloptForAPathThatDoesNotExist) {
+  const auto path = dataPath / "missing.esp";
+  const auto fingerprints = GetFileFingerprints({path});
+
+  ASSERT_EQ(1, fingerprints.size());
+  EXPECT_EQ(std::nullopt, fingerprints.at(path));
+}
+
+TEST_F(GetFileFingerprintsTest, shouldReturnTheSizeAndWriteTimeOfAFile) {
+  const auto path = dataPath / blankEsm;
+  const auto fingerprints = GetFileFingerprints({path});
+
+  ASSERT_EQ(1, fingerprints.size());
+  ASSERT_TRUE(fingerprints.at(path).has_value());
+  EXPECT_EQ(std::filesystem::file_size(path), fingerprints.at(path)->size);
+  EXPECT_EQ(std::filesystem::last_write_time(path),
+            fingerprints.at(path)->lastWriteTime);
+}
+
+TEST_F(GetFileFingerprintsTest, shouldDetectWhenAFileHasBeenModified) {
+  const auto path = dataPath / blankEsm;
+  const auto before = GetFileFingerprints({path});
+
+  std::filesystem::last_write_time(
+      path, std::filesystem::last_write_time(path) + std::chrono::seconds(1));
+
+  EXPECT_NE(before, GetFileFingerprints({path}));
+}
+
+class ScanForPluginCandidatePathsTest : public ::testing::Test {
+protected:
+  ScanForPluginCandidatePathsTest() :
+      rootPath_(getTempPath()),
+      dataPath_(rootPath_ / "Data"),
+      externalDataPath_(rootPath_ / "External") {}
+
+  void SetUp() override {
+    // Filenames are case-folded using Boost.Locale.
+    boost::locale::generator gen;
+    std::locale::global(gen("en.UTF-8"));
+
+    std::filesystem::create_directories(dataPath_);
+    std::filesystem::create_directories(externalDataPath_);
+  }
+
+  void TearDown() override { std::filesystem::remove_all(rootPath_); }
+
+  const std::filesystem::path rootPath_;
+  const std::filesystem::path dataPath_;
+  const std::filesystem::path externalDataPath_;
+};
+
+TEST_F(ScanForPluginCandidatePathsTest,
+       shouldOnlyFindFilesWithPluginOrGhostedPluginExtensions) {
+  touch(dataPath_ / "a.esp");
+  touch(dataPath_ / "b.ESM");
+  touch(dataPath_ / "c.esl.ghost");
+  touch(dataPath_ / "d.bsa");
+  touch(dataPath_ / "e.ghost");
+  touch(dataPath_ / "f.esp.bak");
+
+  auto paths = ScanForPluginCandidatePaths({dataPath_});
+  std::sort(paths.begin(), paths.end());
+
+  EXPECT_EQ(std::vector<std::filesystem::path>({dataPath_ / "a.esp",
+                                                dataPath_ / "b.ESM",
+                                                dataPath_ / "c.esl.ghost"}),
+            paths);
+}
+
+TEST_F(ScanForPluginCandidatePathsTest, shouldSkipDirectories) {
+  std::filesystem::create_directory(dataPath_ / "a.esp");
+
+  EXPECT_TRUE(ScanForPluginCandidatePaths({dataPath_}).empty());
+}
+
+TEST_F(ScanForPluginCandidatePathsTest, shouldSkipDataPathsThatDoNotExist) {
+  touch(dataPath_ / "a.esp");
+
+  const auto paths =
+      ScanForPluginCandidatePaths({rootPath_ / "missing", dataPath_});
+
+  EXPECT_EQ(std::vector<std::filesystem::path>({dataPath_ / "a.esp"}), paths);
+}
+
+TEST_F(ScanForPluginCandidatePathsTest,
+       shouldOnlyFindTheFirstFileWithACaseInsensitivelyEqualFilename) {
+  touch(externalDataPath_ / "A.esp");
+  touch(dataPath_ / "a.esp");
+  touch(dataPath_ / "b.esp");
+
+  const auto paths =
+      ScanForPluginCandidatePaths({externalDataPath_, dataPath_});
+
+  EXPECT_EQ(std::vector<std::filesystem::path>(
+                {externalDataPath_ / "A.esp", dataPath_ / "b.esp"}),
+            paths);
+}
+
+TEST(GetPluginValidationConcurrency,
+     shouldReturnTheMaximumIfTheDriveIsNotRotational) {
+  EXPECT_EQ(8, GetPluginValidationConcurrency(false, 8));
+  EXPECT_EQ(8, GetPluginValidationConcurrency(std::nullopt, 8));
+}
+
+TEST(GetPluginValidationConcurrency,
+     shouldReturnAtMostTwoIfTheDriveIsRotational) {
+  EXPECT_EQ(2, GetPluginValidationConcurrency(true, 8));
+  EXPECT_EQ(1, GetPluginValidationConcurrency(true, 1));
+}
+
+TEST(GetPluginValidationConcurrency, shouldReturnAtLeastOne) {
+  EXPECT_EQ(1, GetPluginValidationConcurrency(false, 0));
+}
+
 TEST(GetExternalDataPaths,
      shouldReturnAnEmptyVectorIfTheGameIsNotAMicrosoftStoreInstall) {
   const auto dataPath = std::filesystem::u8path("data");
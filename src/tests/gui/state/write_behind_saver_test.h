@@ -0,0 +1,140 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2022    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_STATE_WRITE_BEHIND_SAVER_TEST
+#define LOOT_TESTS_GUI_STATE_WRITE_BEHIND_SAVER_TEST
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+
+#include "gui/state/write_behind_saver.h"
+
+namespace loot {
+namespace test {
+using std::chrono::milliseconds;
+
+TEST(WriteBehindSaver, shouldNotHaveAPendingSaveByDefault) {
+  WriteBehindSaver saver(milliseconds(10), []() {}, nullptr);
+
+  EXPECT_FALSE(saver.HasPendingSave());
+}
+
+TEST(WriteBehindSaver, scheduleShouldSaveInTheBackgroundAfterTheDelay) {
+  std::atomic<unsigned int> saveCount{0};
+  WriteBehindSaver saver(
+      milliseconds(10), [&]() { saveCount += 1; }, nullptr);
+
+  saver.Schedule();
+
+  for (unsigned int i = 0; i < 200 && saveCount == 0; i += 1) {
+    std::this_thread::sleep_for(milliseconds(10));
+  }
+
+  EXPECT_EQ(1, saveCount);
+}
+
+TEST(WriteBehindSaver, scheduleShouldCoalesceRequestsMadeWithinTheDelay) {
+  std::atomic<unsigned int> saveCount{0};
+  WriteBehindSaver saver(
+      milliseconds(60000), [&]() { saveCount += 1; }, nullptr);
+
+  saver.Schedule();
+  saver.Schedule();
+  saver.Schedule();
+
+  EXPECT_EQ(0, saveCount);
+  EXPECT_TRUE(saver.HasPendingSave());
+
+  saver.Flush();
+
+  EXPECT_EQ(1, saveCount);
+  EXPECT_FALSE(saver.HasPendingSave());
+}
+
+TEST(WriteBehindSaver, flushShouldDoNothingIfNoSaveIsPending) {
+  std::atomic<unsigned int> saveCount{0};
+  WriteBehindSaver saver(
+      milliseconds(60000), [&]() { saveCount += 1; }, nullptr);
+
+  saver.Flush();
+
+  EXPECT_EQ(0, saveCount);
+}
+
+TEST(WriteBehindSaver, flushShouldThrowAndKeepTheSavePendingIfTheSaveFails) {
+  bool shouldFail = true;
+  WriteBehindSaver saver(
+      milliseconds(60000),
+      [&]() {
+        if (shouldFail) {
+          throw std::runtime_error("error");
+        }
+      },
+      nullptr);
+
+  saver.Schedule();
+
+  EXPECT_THROW(saver.Flush(), std::runtime_error);
+  EXPECT_TRUE(saver.HasPendingSave());
+
+  shouldFail = false;
+
+  EXPECT_NO_THROW(saver.Flush());
+  EXPECT_FALSE(saver.HasPendingSave());
+}
+
+TEST(WriteBehindSaver, aFailedBackgroundSaveShouldBeReportedToTheErrorHandler) {
+  std::atomic<bool> errorReported{false};
+  WriteBehindSaver saver(
+      milliseconds(10),
+      []() { throw std::runtime_error("error"); },
+      [&](const std::exception&) { errorReported = true; });
+
+  saver.Schedule();
+
+  for (unsigned int i = 0; i < 200 && !errorReported; i += 1) {
+    std::this_thread::sleep_for(milliseconds(10));
+  }
+
+  EXPECT_TRUE(errorReported);
+  EXPECT_TRUE(saver.HasPendingSave());
+}
+
+TEST(WriteBehindSaver, destructorShouldPerformAPendingSave) {
+  std::atomic<unsigned int> saveCount{0};
+  {
+    WriteBehindSaver saver(
+        milliseconds(60000), [&]() { saveCount += 1; }, nullptr);
+    saver.Schedule();
+  }
+
+  EXPECT_EQ(1, saveCount);
+}
+}
+}
+
+#endif